@@ -0,0 +1,1225 @@
+// Synthesized drum sounds: pitch swept sines for the kick and toms, high
+// passed noise for the hats and clap, tone plus noise for the snare.
+
+#include "AudioSampleDrums.h"
+
+PROGMEM
+const unsigned int AudioSampleDrumKick[1379] = {
+0x02001588,0xc158cbbd,0x6238545a,0x5f59644c,0x6b66736a,0x73747873,0x747a707b,0x7c767373,
+0x797b7a76,0x7876767b,0x7b797a7c,0x7b7c787a,0x7b797977,0x737a7579,0x73717675,0x7072736e,
+0x6a6d6a71,0x66676468,0x57495e5e,0xaf495451,0xd0d5b0b7,0xdbe2dfda,0xe4e6e6e5,0xebecebed,
+0xf2f2eeed,0xf6f2f2f3,0xf7f7f7f6,0xf8f9f8f7,0xf9f8f8f9,0xfbf9f9f9,0xf8f8f9f8,0xf8faf9f9,
+0xf8f8f9f9,0xf6f7f7f7,0xf2f4f4f5,0xf0f1f2f2,0xe8eaefef,0xe5e6e7e8,0xdbdae0e2,0xc9cbcdd8,
+0x401fb7b9,0x534e4b46,0x615e5c55,0x68666362,0x6e6d6b6a,0x7170706e,0x74737271,0x76757474,
+0x76767676,0x78787777,0x78787878,0x78797878,0x78787878,0x77777777,0x75767676,0x74747475,
+0x71727373,0x6e6f7071,0x696a6c6d,0x62646667,0x595c5f61,0x4b4f5356,0x012a3942,0xcbc5bbb1,
+0xdad7d5d1,0xe3e2e0de,0xe8e7e6e4,0xedecebea,0xf1f0f0ef,0xf3f2f2f1,0xf4f4f4f3,0xf5f5f5f5,
+0xf6f6f6f6,0xf7f7f7f7,0xf7f7f7f7,0xf7f7f7f7,0xf6f6f6f7,0xf5f5f5f6,0xf3f4f4f5,0xf2f2f3f3,
+0xf0f0f1f1,0xebedeeef,0xe6e8e9ea,0xe1e3e4e5,0xd8dbdde0,0xcacfd2d5,0x9eb3bdc5,0x443e321b,
+0x55525049,0x605d5a57,0x65636261,0x69686766,0x6d6c6b6a,0x70706f6e,0x72727171,0x73737372,
+0x74747474,0x75757575,0x76757575,0x76767676,0x75767676,0x75757575,0x74747575,0x73737474,
+0x72727273,0x70707171,0x6d6e6f70,0x696a6b6c,0x65666768,0x60616264,0x575a5c5e,0x4c505355,
+0x313b4247,0xbab0991c,0xd0cbc6c1,0xd9d7d4d2,0xe1e0dedb,0xe5e4e3e2,0xe9e8e7e6,0xedecebea,
+0xf0efeeed,0xf1f1f0f0,0xf2f2f2f1,0xf3f3f3f2,0xf4f4f3f3,0xf4f4f4f4,0xf4f4f4f4,0xf4f4f4f4,
+0xf4f4f4f4,0xf3f4f4f4,0xf3f3f3f3,0xf2f2f2f2,0xf0f1f1f1,0xeeeff0f0,0xebecedee,0xe8e9e9ea,
+0xe4e5e6e7,0xe0e1e2e3,0xd9dbdddf,0xd0d2d4d7,0xc0c4c9cd,0x129fb0b8,0x433d352a,0x514f4b47,
+0x59575553,0x605f5d5b,0x64636261,0x67666665,0x6a6a6968,0x6d6c6c6b,0x706f6e6e,0x71707070,
+0x71717171,0x72727272,0x73737272,0x73737373,0x73737373,0x73737373,0x73737373,0x72727272,
+0x71727272,0x70717171,0x6f707070,0x6d6e6e6f,0x6a6b6c6c,0x6868696a,0x65656667,0x61626364,
+0x5c5e6060,0x5557595a,0x4c505253,0x3c424549,0x911b2c35,0xc0bab2a7,0xcecbc7c4,0xd6d4d2d1,
+0xdddbd9d8,0xe1e0e0de,0xe4e3e3e2,0xe7e6e6e5,0xeae9e8e8,0xecebebea,0xeeededec,0xf0efefee,
+0xf0f0f0f0,0xf1f1f1f0,0xf1f1f1f1,0xf2f1f1f1,0xf2f2f2f2,0xf2f2f2f2,0xf1f1f1f2,0xf1f1f1f1,
+0xf0f1f1f1,0xf0f0f0f0,0xefefeff0,0xededeeee,0xebebecec,0xe8e9eaea,0xe6e7e7e8,0xe3e4e5e5,
+0xe1e1e2e3,0xdcdddfe0,0xd6d7d9da,0xd0d1d3d4,0xc3c7cacd,0xaeb5bbc0,0x2b1e84a1,0x43403a34,
+0x4f4c4946,0x55545251,0x5b595856,0x605f5d5c,0x62626160,0x65646463,0x67666665,0x69696868,
+0x6b6a6a6a,0x6c6c6c6b,0x6e6e6d6d,0x6f6f6e6e,0x70706f6f,0x70707070,0x70707070,0x70707070,
+0x70707070,0x70707070,0x70707070,0x6f6f7070,0x6e6e6f6f,0x6d6d6d6e,0x6b6c6c6c,0x6a6a6a6b,
+0x68686969,0x66666767,0x64646565,0x61626263,0x5e606061,0x595b5c5d,0x54565758,0x4f505253,
+0x4447494c,0x33383e41,0x970c212c,0xbab5b0a6,0xc7c5c2c0,0xd1cfcdca,0xd5d4d3d2,0xdad9d8d7,
+0xdfdedddb,0xe1e1e0e0,0xe3e3e2e2,0xe5e5e4e4,0xe7e7e6e6,0xe9e8e8e7,0xeaeae9e9,0xebebebea,
+0xecececeb,0xedededec,0xeeededed,0xeeeeeeee,0xeeeeeeee,0xeeeeeeee,0xeeeeeeee,0xeeeeeeee,
+0xedededee,0xecededed,0xecececec,0xeaebebeb,0xe9eaeaea,0xe8e8e9e9,0xe6e7e7e7,0xe5e5e5e6,
+0xe3e3e4e4,0xe1e1e2e2,0xdedfe0e0,0xdadbdcdd,0xd6d7d8d9,0xd1d2d4d5,0xcacdcfd0,0xc1c3c6c8,
+0xb1b5babe,0x148ba0a9,0x37322c23,0x4442403b,0x4d4b4846,0x5251504f,0x57555453,0x5a5a5958,
+0x5e5d5c5b,0x6160605f,0x62626261,0x64646363,0x65656564,0x67666666,0x68686767,0x69696868,
+0x6a696969,0x6a6a6a6a,0x6b6b6b6b,0x6b6b6b6b,0x6c6c6b6b,0x6c6c6c6c,0x6c6c6c6c,0x6b6b6b6b,
+0x6b6b6b6b,0x6a6a6b6b,0x6a6a6a6a,0x69696969,0x68686869,0x67676768,0x65666666,0x64656565,
+0x63636364,0x61626262,0x60606061,0x5c5d5e5f,0x595a5a5b,0x55565758,0x51525354,0x4b4d4f50,
+0x4446484a,0x383c4042,0x222a3135,0xa4998315,0xb9b5b1ac,0xc4c2c0bd,0xcbcac8c6,0xd1d0cfcd,
+0xd5d4d3d2,0xd8d7d6d5,0xdbdadad9,0xdededddc,0xe0e0e0df,0xe2e1e1e1,0xe3e3e2e2,0xe4e4e4e3,
+0xe5e5e5e4,0xe6e6e6e5,0xe7e7e7e6,0xe8e7e7e7,0xe8e8e8e8,0xe9e8e8e8,0xe9e9e9e9,0xe9e9e9e9,
+0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe8e8e9e9,0xe8e8e8e8,0xe7e7e8e8,0xe7e7e7e7,0xe6e6e6e6,
+0xe5e5e5e6,0xe4e4e4e5,0xe3e3e3e4,0xe2e2e2e2,0xe0e1e1e1,0xdedfe0e0,0xdcdcddde,0xd9d9dadb,
+0xd6d6d7d8,0xd2d3d4d5,0xcfd0d1d2,0xc8cacccd,0xc2c3c5c7,0xb7babdc0,0xa3a9b0b3,0x1e118799,
+0x34312c26,0x413e3b38,0x47454442,0x4d4c4a49,0x5151504f,0x54545352,0x57575655,0x5a595958,
+0x5d5c5b5b,0x5f5e5e5d,0x60606060,0x61616161,0x62626262,0x63636363,0x64646463,0x65656464,
+0x65656565,0x66666665,0x66666666,0x66666666,0x67666666,0x67676767,0x67676767,0x66666666,
+0x66666666,0x66666666,0x65656666,0x65656565,0x64646465,0x63646464,0x63636363,0x62626262,
+0x61616161,0x60606060,0x5d5e5f5f,0x5b5c5c5d,0x59595a5a,0x56575758,0x53545555,0x51515253,
+0x4c4e4f50,0x47484a4b,0x41434445,0x373a3d40,0x282e3134,0x8a0c1922,0xada7a298,0xbab7b4b1,
+0xc2c1bfbc,0xc8c6c5c3,0xcdcccac9,0xd1d0d0ce,0xd3d3d2d1,0xd6d5d5d4,0xd8d7d7d6,0xdadad9d9,
+0xdcdcdbdb,0xdededddd,0xe0e0dfdf,0xe1e0e0e0,0xe1e1e1e1,0xe2e2e2e1,0xe3e2e2e2,0xe3e3e3e3,
+0xe3e3e3e3,0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,
+0xe4e4e4e4,0xe3e3e3e4,0xe3e3e3e3,0xe2e2e3e3,0xe2e2e2e2,0xe1e1e1e2,0xe0e1e1e1,0xe0e0e0e0,
+0xdededfdf,0xdcdcdddd,0xdadbdbdc,0xd8d9d9da,0xd6d6d7d7,0xd4d4d5d5,0xd1d2d3d3,0xcfd0d0d1,
+0xcacbcccd,0xc5c6c7c9,0xc0c1c2c4,0xb7b9bcbe,0xaaafb2b4,0x8996a0a5,0x2520170a,0x34322f2a,
+0x3e3b3937,0x43424140,0x48474645,0x4d4b4a49,0x50504f4e,0x52525151,0x54545353,0x56565555,
+0x58585757,0x5a5a5959,0x5c5b5b5a,0x5d5d5c5c,0x5e5e5e5d,0x605f5f5f,0x60606060,0x61616060,
+0x61616161,0x61616161,0x62626262,0x62626262,0x62626262,0x62626262,0x62626262,0x62626262,
+0x62626262,0x62626262,0x61616162,0x61616161,0x60616161,0x60606060,0x5f606060,0x5e5e5f5f,
+0x5d5d5d5e,0x5b5c5c5c,0x5a5a5b5b,0x58595959,0x56575758,0x55555556,0x53535454,0x51515252,
+0x4e4f5050,0x4a4b4c4d,0x46474849,0x41434445,0x3b3d3f40,0x32343739,0x24282c30,0x840d171f,
+0xa6a19b92,0xb3b1aeaa,0xbbb9b7b5,0xc2c1c0be,0xc6c5c4c3,0xcac9c8c7,0xcdcccccb,0xd0d0cfce,
+0xd2d2d1d1,0xd4d3d3d3,0xd5d5d5d4,0xd7d7d6d6,0xd8d8d8d7,0xdad9d9d9,0xdbdbdada,0xdcdcdbdb,
+0xdddddddc,0xdededddd,0xdfdedede,0xdfdfdfdf,0xe0e0e0df,0xe0e0e0e0,0xe0e0e0e0,0xe0e0e0e0,
+0xe0e0e0e0,0xe0e0e0e0,0xe0e0e0e0,0xe0e0e0e0,0xe0e0e0e0,0xdfdfdfdf,0xdedfdfdf,0xdededede,
+0xdddddddd,0xdcdcdcdc,0xdbdbdbdb,0xd9dadada,0xd8d8d9d9,0xd7d7d7d8,0xd5d6d6d6,0xd4d4d5d5,
+0xd2d3d3d3,0xd1d1d1d2,0xcecfd0d0,0xcbcccccd,0xc7c8c9ca,0xc3c4c5c6,0xc0c1c2c3,0xb9babcbe,
+0xb1b3b5b7,0xa3a7abaf,0x839198a0,0x221c150b,0x302d2925,0x37353432,0x3e3d3b39,0x43424140,
+0x46454443,0x49494847,0x4d4c4b4a,0x504f4e4d,0x51515050,0x53525251,0x54545353,0x55555554,
+0x56565655,0x57575757,0x58585858,0x59595959,0x5a5a5a5a,0x5b5b5b5a,0x5c5b5b5b,0x5c5c5c5c,
+0x5c5c5c5c,0x5d5d5d5d,0x5d5d5d5d,0x5d5d5d5d,0x5d5d5d5d,0x5d5d5d5d,0x5d5d5d5d,0x5c5d5d5d,
+0x5c5c5c5c,0x5b5c5c5c,0x5b5b5b5b,0x5a5a5b5b,0x595a5a5a,0x58595959,0x57585858,0x56575757,
+0x55565656,0x54545555,0x53535354,0x51525252,0x50505151,0x4e4f4f50,0x4b4c4c4d,0x4849494a,
+0x45454647,0x41424344,0x3d3f4041,0x36383a3b,0x30323335,0x23262a2d,0x0a131a20,0x9d969082,
+0xaba8a5a1,0xb4b2b0ae,0xbab8b7b5,0xc0bfbdbc,0xc3c2c1c1,0xc6c5c4c4,0xc9c8c7c7,0xcbcbcac9,
+0xcecdcdcc,0xd0d0cfcf,0xd1d1d1d0,0xd2d2d2d2,0xd3d3d3d3,0xd4d4d4d4,0xd5d5d5d5,0xd6d6d6d6,
+0xd7d7d7d6,0xd8d7d7d7,0xd8d8d8d8,0xd9d9d8d8,0xd9d9d9d9,0xd9d9d9d9,0xdadadada,0xdadadada,
+0xdadadada,0xdadadada,0xdadadada,0xd9d9dada,0xd9d9d9d9,0xd9d9d9d9,0xd8d8d8d9,0xd8d8d8d8,
+0xd7d7d7d7,0xd6d6d7d7,0xd5d6d6d6,0xd5d5d5d5,0xd4d4d4d4,0xd3d3d3d3,0xd2d2d2d2,0xd0d1d1d1,
+0xcfd0d0d0,0xcccdcece,0xcacbcbcc,0xc7c8c9c9,0xc5c5c6c7,0xc2c3c3c4,0xbfc0c1c1,0xb9bbbcbd,
+0xb3b5b6b8,0xacafb1b2,0xa0a3a6a9,0x8590969b,0x1c161006,0x29262321,0x32302f2c,0x37363533,
+0x3d3c3a39,0x4140403e,0x43434241,0x46454544,0x48484747,0x4b4a4a49,0x4d4c4c4b,0x4f4f4e4d,
+0x50505050,0x51515151,0x52525251,0x53535252,0x54535353,0x54545454,0x55555554,0x55555555,
+0x56565656,0x56565656,0x57565656,0x57575757,0x57575757,0x57575757,0x57575757,0x57575757,
+0x57575757,0x56565657,0x56565656,0x56565656,0x55555555,0x55555555,0x54545454,0x53535454,
+0x52535353,0x52525252,0x51515151,0x50505051,0x4e4f4f50,0x4c4d4d4e,0x4a4b4b4c,0x4849494a,
+0x46464747,0x43444545,0x41424243,0x3e3f4040,0x393a3b3c,0x34353637,0x2e303132,0x2426292b,
+0x14191e21,0x8f85040e,0xa19e9994,0xaba9a6a4,0xb2b1b0ae,0xb7b6b5b4,0xbcbbb9b8,0xc0bfbebd,
+0xc2c2c1c1,0xc4c4c3c3,0xc6c6c5c5,0xc8c8c7c7,0xcacac9c9,0xcccccbcb,0xcececdcd,0xd0cfcfce,
+0xd0d0d0d0,0xd1d1d1d0,0xd2d1d1d1,0xd2d2d2d2,0xd3d3d2d2,0xd3d3d3d3,0xd3d3d3d3,0xd4d4d4d4,
+0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,0xd4d4d4d4,
+0xd3d3d4d4,0xd3d3d3d3,0xd3d3d3d3,0xd2d2d2d2,0xd2d2d2d2,0xd1d1d1d1,0xd0d0d1d1,0xd0d0d0d0,
+0xcececfcf,0xcccdcdce,0xcbcbcccc,0xc9c9caca,0xc7c7c8c8,0xc5c6c6c6,0xc3c4c4c5,0xc1c1c2c3,
+0xbebfc0c0,0xbabbbcbd,0xb6b7b8b9,0xb1b2b3b5,0xaaacafb0,0xa1a4a6a8,0x91969a9f,0x0f06828b,
+0x201d1814,0x29272522,0x312f2d2b,0x35343332,0x39383736,0x3d3c3b3a,0x40403f3e,0x42424141,
+0x44434343,0x46454544,0x47474746,0x49494848,0x4a4a4a49,0x4c4c4b4b,0x4d4d4d4c,0x4e4e4e4e,
+0x504f4f4f,0x50505050,0x50505050,0x51515151,0x51515151,0x51515151,0x52525252,0x52525252,
+0x52525252,0x52525252,0x52525252,0x52525252,0x52525252,0x51525252,0x51515151,0x51515151,
+0x50515151,0x50505050,0x50505050,0x4f4f4f4f,0x4d4e4e4e,0x4c4c4d4d,0x4b4b4c4c,0x494a4a4a,
+0x48484949,0x46474748,0x45454646,0x43434444,0x41424243,0x3f404041,0x3c3d3e3f,0x38393a3b,
+0x34353637,0x30313233,0x2a2c2d2f,0x22242628,0x14181c20,0x85020a11,0x9a96928d,0xa4a2a09e,
+0xacaaa8a6,0xb1b1b0ae,0xb5b4b3b2,0xb9b8b7b6,0xbcbbbaba,0xc0bfbebd,0xc1c1c0c0,0xc3c2c2c2,
+0xc4c4c4c3,0xc6c5c5c5,0xc7c7c6c6,0xc8c8c8c7,0xcac9c9c9,0xcbcacaca,0xcccbcbcb,0xcdcccccc,
+0xcdcdcdcd,0xcececece,0xcfcfcece,0xcfcfcfcf,0xd0d0cfcf,0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,
+0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,0xcfcfcfcf,0xcfcfcfcf,0xcececece,0xcdcdcece,
+0xcccdcdcd,0xcccccccc,0xcbcbcbcb,0xc9cacaca,0xc8c9c9c9,0xc7c7c8c8,0xc6c6c6c7,0xc4c5c5c5,
+0xc3c3c4c4,0xc2c2c2c3,0xc0c0c1c1,0xbebebfc0,0xbabbbcbd,0xb7b8b9ba,0xb4b5b5b6,0xb0b1b2b3,
+0xaaacaeb0,0xa4a5a7a9,0x9a9da0a2,0x89909396,0x110b0482,0x1e1b1714,0x26242221,0x2c2b2927,
+0x3130302e,0x34343332,0x37373635,0x3a3a3938,0x3d3d3c3b,0x40403f3e,0x41414140,0x43424242,
+0x44434343,0x45454444,0x46464545,0x47474746,0x48484847,0x49494848,0x4a494949,0x4a4a4a4a,
+0x4b4b4b4a,0x4b4b4b4b,0x4c4c4c4b,0x4c4c4c4c,0x4c4c4c4c,0x4c4c4c4c,0x4d4d4d4c,0x4c4c4d4d,
+0x4c4c4c4c,0x4c4c4c4c,0x4c4c4c4c,0x4b4b4c4c,0x4b4b4b4b,0x4a4a4b4b,0x4a4a4a4a,0x49494949,
+0x48484849,0x47474848,0x46464747,0x45454646,0x44444545,0x43434344,0x42424243,0x40414141,
+0x3f3f4040,0x3c3d3d3e,0x393a3b3b,0x36373839,0x34343536,0x31313233,0x2c2d2f30,0x2627292a,
+0x20212324,0x14171a1d,0x00060c11,0x93908b85,0x9f9c9996,0xa5a4a2a1,0xabaaa8a7,0xb0afaead,
+0xb3b2b2b1,0xb6b5b4b4,0xb8b8b7b6,0xbbbabab9,0xbdbdbcbc,0xc0bfbfbe,0xc1c0c0c0,0xc2c2c1c1,
+0xc3c3c2c2,0xc4c4c3c3,0xc5c4c4c4,0xc5c5c5c5,0xc6c6c6c6,0xc7c7c7c6,0xc7c7c7c7,0xc8c8c8c8,
+0xc8c8c8c8,0xc9c9c9c8,0xc9c9c9c9,0xc9c9c9c9,0xc9c9c9c9,0xc9c9c9c9,0xc9c9c9c9,0xc9c9c9c9,
+0xc9c9c9c9,0xc9c9c9c9,0xc8c8c8c8,0xc8c8c8c8,0xc7c7c7c8,0xc7c7c7c7,0xc6c6c6c6,0xc5c5c6c6,
+0xc4c5c5c5,0xc3c4c4c4,0xc3c3c3c3,0xc2c2c2c2,0xc1c1c1c1,0xbfc0c0c0,0xbdbebebf,0xbbbbbcbd,
+0xb8b9baba,0xb6b7b7b8,0xb3b4b5b5,0xb1b2b2b3,0xadaeb0b0,0xa8a9aaac,0xa3a4a5a7,0x9b9ea0a1,
+0x90939698,0x0381868c,0x14110e09,0x1f1c1917,0x24232220,0x29282726,0x2e2d2c2b,0x31313030,
+0x34333332,0x36363534,0x38383737,0x3b3a3939,0x3d3c3c3b,0x3f3e3e3d,0x40403f3f,0x41414040,
+0x42414141,0x42424242,0x43434343,0x44444343,0x44444444,0x45454544,0x45454545,0x46464545,
+0x46464646,0x46464646,0x46464646,0x46464646,0x46464646,0x46464646,0x46464646,0x46464646,
+0x46464646,0x45454546,0x45454545,0x44454545,0x44444444,0x43434444,0x43434343,0x42424242,
+0x41414242,0x40414141,0x3f404040,0x3e3e3e3f,0x3c3c3d3d,0x3a3a3b3b,0x38383939,0x36363737,
+0x33343435,0x31323233,0x2e2f3031,0x2a2b2c2d,0x25262728,0x20212324,0x181a1c1f,0x0d111315,
+0x85800408,0x94918e8a,0x9d9b9896,0xa3a2a09f,0xa7a6a5a4,0xacaba9a8,0xb0afaead,0xb2b1b1b0,
+0xb4b3b3b2,0xb6b5b5b4,0xb8b7b7b6,0xbab9b9b8,0xbbbbbaba,0xbdbdbcbc,0xbebebebd,0xc0c0bfbf,
+0xc0c0c0c0,0xc1c1c1c1,0xc2c1c1c1,0xc2c2c2c2,0xc2c2c2c2,0xc3c3c3c3,0xc3c3c3c3,0xc3c3c3c3,
+0xc4c4c4c3,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,0xc3c3c4c4,0xc3c3c3c3,
+0xc3c3c3c3,0xc2c3c3c3,0xc2c2c2c2,0xc2c2c2c2,0xc1c1c1c1,0xc0c1c1c1,0xc0c0c0c0,0xbfbfbfc0,
+0xbdbebebe,0xbcbcbdbd,0xbabbbbbb,0xb9b9b9ba,0xb7b7b8b8,0xb5b5b6b6,0xb3b4b4b4,0xb1b2b2b3,
+0xafb0b0b1,0xabacadae,0xa7a8a9aa,0xa3a4a5a6,0x9ea0a1a2,0x95979a9c,0x8b8f9193,0x05018287,
+0x12100d09,0x1b191715,0x21201f1d,0x25242322,0x29282726,0x2d2c2b2a,0x30302f2e,0x32313130,
+0x34333332,0x35353434,0x37363636,0x38383837,0x3a393939,0x3b3b3a3a,0x3c3c3c3b,0x3e3d3d3d,
+0x3f3e3e3e,0x403f3f3f,0x40404040,0x40404040,0x41414140,0x41414141,0x41414141,0x41414141,
+0x41414141,0x42424241,0x42424242,0x41414242,0x41414141,0x41414141,0x41414141,0x41414141,
+0x40404141,0x40404040,0x40404040,0x3f3f3f3f,0x3e3e3e3e,0x3d3d3d3d,0x3b3c3c3c,0x3a3a3b3b,
+0x3939393a,0x37383838,0x36363737,0x34353535,0x33333334,0x31313232,0x2f303031,0x2c2d2d2e,
+0x28292a2b,0x25252627,0x21222324,0x1b1d1f20,0x14161719,0x090d1012,0x84810206,0x918f8c88,
+0x98979593,0x9f9e9c9a,0xa3a2a1a0,0xa6a6a5a4,0xaaa9a8a7,0xadacabab,0xb0afafae,0xb1b1b1b0,
+0xb3b3b2b2,0xb4b4b4b3,0xb6b5b5b5,0xb7b7b6b6,0xb8b8b7b7,0xb9b9b9b8,0xbababab9,0xbbbbbbba,
+0xbcbcbcbb,0xbdbdbcbc,0xbdbdbdbd,0xbebebebe,0xbfbebebe,0xbfbfbfbf,0xbfbfbfbf,0xbfbfbfbf,
+0xc0c0c0bf,0xc0c0c0c0,0xbfbfc0c0,0xbfbfbfbf,0xbfbfbfbf,0xbfbfbfbf,0xbebebebe,0xbebebebe,
+0xbdbdbdbd,0xbcbcbdbd,0xbbbcbcbc,0xbabbbbbb,0xb9bababa,0xb8b9b9b9,0xb7b8b8b8,0xb6b6b7b7,
+0xb5b5b5b6,0xb3b4b4b4,0xb2b2b3b3,0xb1b1b1b2,0xafb0b0b0,0xacadadae,0xa9aaaaab,0xa6a7a7a8,
+0xa3a3a4a5,0x9fa0a1a2,0x999b9c9e,0x93949697,0x898c8f91,0x03008286,0x100d0a06,0x16151311,
+0x1c1b1918,0x2120201e,0x24232322,0x27262625,0x2a292828,0x2d2c2b2b,0x2f2f2e2d,0x31303030,
+0x32323131,0x33333332,0x34343433,0x35353535,0x36363636,0x37373737,0x38383838,0x39393938,
+0x3a393939,0x3a3a3a3a,0x3b3b3a3a,0x3b3b3b3b,0x3b3b3b3b,0x3c3c3c3c,0x3c3c3c3c,0x3c3c3c3c,
+0x3c3c3c3c,0x3c3c3c3c,0x3c3c3c3c,0x3c3c3c3c,0x3b3b3b3b,0x3b3b3b3b,0x3a3a3b3b,0x3a3a3a3a,
+0x3939393a,0x38393939,0x38383838,0x37373737,0x36363636,0x35353535,0x34343434,0x33333333,
+0x31323232,0x30313131,0x2e2f3030,0x2c2d2d2e,0x292a2b2b,0x27272829,0x24252526,0x21222223,
+0x1d1e2020,0x17191a1c,0x12131516,0x080b0e10,0x82000306,0x8d8b8885,0x94939190,0x9a989795,
+0x9f9e9c9b,0xa2a1a1a0,0xa5a4a3a3,0xa7a7a6a5,0xaaa9a8a8,0xacababaa,0xaeaeadad,0xb0b0afaf,
+0xb1b1b1b0,0xb2b2b2b1,0xb3b3b3b2,0xb4b4b3b3,0xb5b4b4b4,0xb5b5b5b5,0xb6b6b6b6,0xb7b7b6b6,
+0xb7b7b7b7,0xb8b8b7b7,0xb8b8b8b8,0xb8b8b8b8,0xb9b9b9b8,0xb9b9b9b9,0xb9b9b9b9,0xb9b9b9b9,
+0xb9b9b9b9,0xb9b9b9b9,0xb8b9b9b9,0xb8b8b8b8,0xb8b8b8b8,0xb7b8b8b8,0xb7b7b7b7,0xb6b6b7b7,
+0xb6b6b6b6,0xb5b5b5b6,0xb4b4b5b5,0xb3b4b4b4,0xb3b3b3b3,0xb2b2b2b2,0xb1b1b1b1,0xb0b0b0b0,
+0xaeaeafaf,0xabacadad,0xa9aaaaab,0xa7a7a8a9,0xa5a5a6a6,0xa2a3a3a4,0xa0a0a1a2,0x9b9c9d9f,
+0x9697989a,0x91929395,0x888b8d90,0x01818386,0x0b080603,0x1211100d,0x17161513,0x1c1b1918,
+0x201f1e1d,0x22222121,0x25242423,0x27262625,0x29282827,0x2b2a2a29,0x2d2c2c2b,0x2f2e2e2d,
+0x3030302f,0x31313030,0x32313131,0x32323232,0x33333333,0x34333333,0x34343434,0x35353434,
+0x35353535,0x35353535,0x36363636,0x36363636,0x36363636,0x36363636,0x36363636,0x36363636,
+0x36363636,0x36363636,0x36363636,0x35353535,0x35353535,0x34353535,0x34343434,0x33343434,
+0x33333333,0x32323233,0x31323232,0x30303131,0x2d2d2e2f,0x292a2b2c,0x26272829,0x24242526,
+0x21212223,0x1d1e2020,0x191a1b1c,0x15161718,0x11121314,0x0d0f1011,0x08090b0c,0x04050607,
+0x02020304,0x00000101,0x00000000,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumSnare[1104] = {
+0x0200113a,0xcb6ff162,0x78bbd166,0xd96372e5,0x63553d73,0x656cd07c,0x6c657cad,0x736b5cc1,
+0xa3674a60,0x6b60ca7a,0x6fd072e0,0xb56760eb,0x58de5aa5,0x6aeb73e4,0xebaf85df,0xd067eb6b,
+0x4ce633d3,0x55d1f452,0x6b91e51e,0x5fafddea,0xd09554e5,0x73f5589b,0xde6dd9f3,0xee63e5cf,
+0xca4bf057,0x5defc8e7,0xc644f3d5,0xfada63f5,0xe6cde6c8,0xc8d7e941,0xf3dd4de1,0xe04de2c3,
+0xf24c9465,0x6bdb70d0,0x78ba38e3,0x6d5951d3,0x6c3d8161,0x5f6fb674,0x71496a60,0x7570dc71,
+0x6277e768,0x650f926a,0x6dd85a6f,0x67e54e53,0xd2d45da8,0xe963e267,0x63f24847,0x65f86df2,
+0xc8a2e2e9,0xe44be7dd,0xe2d0f162,0x9b44f266,0xddec4feb,0xf15856d3,0xd5ea5142,0xca61d255,
+0xe5d652f0,0x4bef5e59,0xf46ef08d,0x51f15631,0xa8ea4fe1,0xb4cad9c0,0xe666e64d,0xf264c5d8,
+0xe770ed6a,0x28ed5850,0xd756106d,0x4063c260,0x6c581167,0x453a76d1,0x6a617058,0xcf72633d,
+0x5c645a76,0xbb4872d8,0x9961b676,0x51e573d5,0x5559dc62,0x55e964e9,0xb3f0c32f,0xdad2f065,
+0xe7e0d522,0x60eadfcc,0xf1c5e5da,0xda4df22a,0xf1d2deb9,0xc7dde555,0xd8c8c453,0xe158c4e8,
+0x6405d732,0x63e467e4,0xdd44abe5,0x70dcb160,0xeb72dce2,0x6737d122,0x2ad4bbc5,0xbe67e669,
+0x6bee6cec,0x59bbb545,0x53c962e5,0x5d2669b7,0x44644b2e,0xd4702311,0x64696427,0x4b665a30,
+0xc1675a12,0xd4626e41,0x50e36169,0x496b1964,0xe0c15ee0,0x54c8ee6c,0x59d157e4,0xe1d84beb,
+0xe0c7d3e7,0xc1e4e2c2,0xead3f596,0x289edfd7,0xe4e0bae2,0xda3deed6,0xd754eb42,0x63dccea5,
+0x60e1d10f,0xe6c94554,0x6ad4c26f,0x60e14c22,0x0c6533b0,0xce6259c3,0xec63cd61,0x58544e63,
+0x0552a7d0,0x5bec5752,0xe66ce866,0x52de5268,0x4ea964a4,0x8b625cc2,0x335fe157,0x64dc6646,
+0x5fe7595d,0x6de3655d,0xe76256d1,0x5139ac5b,0x67dcb25f,0xb564dad4,0xe8d263e7,0xf0d265db,
+0xc1ddd359,0xd342f0c9,0xcfd99ff0,0xbadbe6e6,0xf0d557e9,0x58ebd640,0x90dbe6d1,0xe74edc54,
+0xe6604ac0,0x65e267b0,0x586253dd,0x61ca4fd1,0x55476942,0x60d35b12,0xd1665046,0x87694956,
+0x49663b2f,0xdd5c51d4,0x575fa341,0xda6356df,0xdc3e60a0,0x4e4461c8,0xc550d2ca,0x305f364b,
+0xe661d737,0xd752c969,0x226aeb63,0x61e15ed7,0x61caa9d0,0xe869e4b7,0x462bae33,0xdbdadcb7,
+0xd7c64bce,0xcdd5e94f,0xd6e45ae0,0xc3d0dedb,0xe3e548d6,0x44b7c6db,0xdf53e9c1,0xb3e1c2b3,
+0x5fd3a15e,0x61c3dbb2,0x6292d04a,0xb4406acc,0x514e3359,0xa261a36b,0x31563e66,0x816eab5c,
+0x5bcf5641,0x61e1673f,0xd0333260,0x5bd25f25,0x4cc359d2,0xec60e143,0xc85ae867,0x5cc4dc52,
+0xdcd23fd1,0xdd45e162,0xc4255346,0xdcbb4acb,0xe0320e4e,0x44d1a12a,0x59dbca50,0xc4e35ce3,
+0x58d63913,0xcc4de6bc,0xc859dcd2,0xd3cb32ef,0x5eed4893,0xe661dbe4,0xd532cecc,0xc847abb3,
+0xab4742c6,0xc0ae60d3,0x68a69519,0x466bcfb3,0x5fc168de,0x5a59c060,0x674064ba,0x5dd166d7,
+0xad615242,0x5863d667,0xbf624ddb,0x5f3fd95e,0xe1af60dd,0x60e65150,0xe0ccbdc2,0xc75ae962,
+0x40d743dd,0x48e261e6,0x30e141d9,0x5fdc4fe1,0xbf55d3d0,0xb159e8b6,0xdc64e0c6,0xd0de3c2f,
+0x0dcfe263,0xc0ded162,0xdbc3d05f,0x4de95441,0x61e863d7,0x5ae3c7c7,0x4bd5b6ce,0xd860e144,
+0x4244a8c3,0x2ecf51aa,0x55b0e05a,0xc157943c,0x315ec36a,0x61bf4e4d,0x58515fc4,0x4c6257ca,
+0x4252d957,0x513e4b64,0xb65947a5,0x4f02263d,0x954cd3ba,0xadca2d9a,0xe854c2b1,0xc0d857c8,
+0xd6d1d5b2,0xb1e4c35b,0xcc5ad8d2,0xb843c5e3,0x51d0cad8,0x4fe4bfb5,0xd2d0d148,0x5ee05abf,
+0x1351c5c1,0xc055d7ce,0xdac25ec0,0xc6453635,0x57db5036,0xdb055bd1,0x434ad648,0x33cbca12,
+0x4e3dd053,0x51c2ce4c,0x42d759c5,0x3fda5949,0x464a4632,0x3b49ba58,0x60c4505a,0x51c164d1,
+0x65343aa2,0x479558c9,0x554b3ab7,0xc160d288,0x599e43ca,0xa4bac7c9,0xbe49a9b6,0xe0d394c7,
+0x8fbfb9cb,0xd4d3d605,0xd8ddd652,0xe449e45a,0xe048d646,0x8451b3d1,0xb5d5b2d4,0x55e460c7,
+0x5444bec8,0x2f54a2da,0xdb5fc5ac,0x2a4e3c3b,0xc947473f,0x50dc61c9,0xd64656a9,0xd3ab5945,
+0xbdc83f5a,0x32b3c557,0x444bc049,0xd853a72d,0x3c1f5b4b,0xac4eb29e,0x628c46c9,0xc54743cf,
+0x433a445d,0x2a5d93cf,0x5ea930be,0x1fcf50c5,0xd4384442,0xbc4fc948,0x51c1c7c7,0xb0cfd9c3,
+0xd453e554,0xb7cfc6c3,0xc4e454dc,0xceb4c942,0x97c7e5a0,0x203adf47,0xc54140dd,0x57c48ad1,
+0x50cbb2c0,0x56cb4bbf,0x4c42b2ae,0x63dc55b3,0xd2549a04,0xc247554c,0x43ceb75d,0x30aa5834,
+0x2561c049,0x4c9701b8,0xb72559b8,0x4431d839,0xb05549b9,0xb71fd839,0xbb52ba45,0xc22ba54e,
+0xbb2a0951,0x50bcb221,0x2459cb3d,0xc5c5870b,0xde415030,0x3ba246b4,0x50d456d3,0x55c3b7d8,
+0x43e021d3,0xe2c31695,0x38d84a14,0xdf56d0e0,0x3294ce20,0x49dbc3bd,0xdb4a40e0,0x4ccc3100,
+0xdb5bd3ac,0x16b2c456,0x50bba661,0xa0bb3447,0x398e574f,0x524bb94c,0x58d35eca,0xc160ba42,
+0x11484c9e,0xcd5940c1,0x2e355540,0xb159b0d4,0xba4bc5bc,0xb6d94846,0x3726d452,0x2ea3d650,
+0xcb4039c7,0x4eb2d54b,0x53db4bbd,0x4cc2c6b0,0x369dc52e,0x3cc3bfb1,0xd0134212,0x0043bac4,
+0xd73844d3,0x2022d449,0xe04d96d9,0xc3288d22,0xaddacb2f,0x45d13dba,0xd150d198,0xb139d54c,
+0x40d74ec3,0xc7c3522c,0xd0444a46,0x2b44bb59,0x3e35573d,0x34c23c24,0x9f3c2e5f,0xc0b15b3b,
+0x60a23d50,0x51d32a30,0x253856b4,0x2ea1d227,0xc2c38856,0xc732d751,0xa63fd35a,0x11c441c4,
+0xd34fddaa,0xde4daf9b,0xd255c93d,0xcf31c127,0x29b13c93,0xbcb74ad3,0x9bd028bc,0x51b1bd32,
+0x49cbb69d,0x3ecac017,0x51b8b8bd,0x81d739c2,0x3132ce32,0x92c843b2,0xc8cb2fb0,0x9bd3bb59,
+0xa9cd4827,0x3641c94c,0x2944aca9,0x30293b38,0x97295bae,0xb75849bf,0xcc415788,0x48b74151,
+0x37343f4d,0x5a2ead99,0x55d33434,0x52a63ccb,0x4cc9108f,0xcc123cd3,0xd44ec51a,0xb43590b6,
+0xd3c030c0,0xc0aece2d,0xc64223bd,0xb9369bd3,0xa741a4d1,0x3bd04ed0,0xd04cbdb1,0x2a3c2193,
+0xa632bbba,0xccb70340,0x4cb6ad42,0xa0b749cc,0x063c0e3e,0xb345cbb5,0xc1a6c946,0xb5b72147,
+0x3f2cc444,0xa52334a0,0x494f99b4,0x4b2333ce,0x3dd046ab,0x31354138,0x4d40c153,0xbe4530ac,
+0x37b85ba8,0x44b654c1,0x04c552b7,0x3a28cd51,0x4b24d449,0xb03e3dd2,0xd04fd38f,0xcd38c93e,
+0xd02cbfc4,0x1dc947a8,0xccb826d6,0xc4c445a0,0xc9a31fa5,0x99d350d0,0xb38a3bb5,0xb449c29a,
+0x012848b8,0x2841d424,0xd0364aac,0xc1034945,0x412e44b9,0xd45232c8,0xb850c44f,0xcb50cd4a,
+0x411925a9,0xcc43ca4d,0x49c12248,0x9e4a99a0,0x3c131fc6,0x00254345,0xb12351cc,0x35c0ba4d,
+0x402b4b14,0xcb5727d0,0x50ce4f25,0xc923ba30,0xb92e0b4b,0xcc411ec3,0xc043189b,0xc6c844bd,
+0xabce252d,0xcdc9329f,0x07a1c530,0x20c238d3,0xc691c80a,0xc3a923b3,0xb1b6c042,0xce820746,
+0x52c948b1,0x3c30b9aa,0x07463bc2,0x3036be11,0x452150a1,0x32ba46b3,0xbb4a3ca2,0x479344be,
+0x9f471f82,0x924f10c8,0x43c1a227,0x27c5b142,0x48bdbc50,0x31b09036,0xc24041cc,0xcba74fad,
+0xb9424623,0xbe45cd39,0xc03dab30,0xa8370549,0x3fbc4fcc,0xc747c2c3,0xc437c54e,0xbf9f33b6,
+0xca2982bb,0xce842bb4,0x39d14409,0x3031c0ca,0xb543d1b7,0xc2b711b8,0x4220ca3f,0xb42ba5bc,
+0x3dc42da6,0xad8a53b6,0x49c14fbf,0xb8382386,0x363fa44c,0xa1293bbf,0x33858052,0x4341c843,
+0x21a32300,0x184ab245,0xbc38c729,0x4241b437,0x48a0beae,0xce864dd0,0x80b7ba4f,0x8737a528,
+0xac4bbbc6,0x4d91c790,0xcd411dc5,0x2841c63f,0xad2c45c6,0xb1b5249d,0x8eb29d31,0x40a11fc4,
+0xd246c5ab,0x4bbc28a3,0xc139a2ca,0x3aa4b993,0xc1ad23cd,0xc12c32a4,0x48cf4cc1,0x1fc344d0,
+0x03b73827,0x4aac2a0a,0x9c4213c8,0xa84bc342,0x1c37c049,0x9644963d,0x363ab041,0xa991253a,
+0x272e2e2e,0xc347ad45,0x44110c22,0xa344b596,0xb2102ab2,0xc54230bb,0x0044c52d,0xb912a0c4,
+0xb43faca7,0x90aca038,0x4906ceae,0xb29bb8ac,0xb737b89d,0x31b847af,0x41b830c5,0xb3a53bc6,
+0x318738b4,0x3d179ac6,0x88c637c5,0x34beb342,0xae1fc43a,0xb849c108,0x47a6a2b4,0x982dc0a4,
+0xc247a8b8,0x2c15c03c,0xb03e1142,0xb651ba8e,0xab4ec540,0x46a6389d,0x46b645a9,0xbf3b3221,
+0x1c44a242,0x47ad8e1b,0x41c11927,0xb5832c9d,0xa5a73995,0x389ccb33,0x45ca44bd,0xad3eaec8,
+0x30aa10ba,0xabafa2c2,0x1e3bc623,0xb7b4b6b3,0xa03035a1,0xb8873ec7,0x231fc634,0x40a8b328,
+0x30ab06be,0xa733b62d,0x30c44cbd,0x24a4c639,0xbdb54493,0x22b52f2e,0x36acbc41,0xc02339bd,
+0x9f3bad3c,0x13b7b134,0x39c42641,0xac3d3194,0x3bb62232,0x31292da1,0x32bf47b5,0x45bc3143,
+0x8fc24ec6,0xc244bc48,0x3aa9332b,0x3cab3997,0x9344c3a0,0x18b89bb6,0xb832a1a8,0xc81fb333,
+0xc091bc41,0xb222ba31,0xc93085c1,0xbe06ae3a,0xc623a202,0xb72db433,0xc04190a1,0x30bba63b,
+0xbcb149be,0xb32a0438,0x45bbac42,0x2a3abc21,0xbd46c41a,0x3ba49240,0xb3072d90,0x22aa8629,
+0x411aad13,0xa10e9d11,0x3ac0221e,0xb232c33f,0x46c3412c,0x44bc2216,0xb13f24b9,0x3384b92a,
+0x44ba4595,0xb13fb6a7,0x0145b52f,0xa7b222a4,0xb8a63628,0x8dbb2616,0xc641b532,0x19bf963a,
+0x36b4bb31,0x93c43bc6,0xb31323af,0xb4b640c1,0x1333c626,0x31c2a8a0,0x02ae2db0,0xbf2f070f,
+0x43919681,0x3f30c21d,0xbe1b260d,0xb3332fa1,0xb5313132,0x219f3117,0xc2254318,0xac9b2045,
+0x470dc03d,0xc09b42c0,0x3bb73d19,0xa92db40e,0x9017a740,0xa99744ba,0xa52e951a,0xa4ac2ca8,
+0xb79d333a,0x98091b30,0xb1272615,0x20ba982d,0xa71d0b11,0x2db4ae40,0x2a33c323,0xbca334bf,
+0xa5b83aad,0x9d081e87,0xb80fc1ae,0x21af8210,0xadb233b7,0x40b3b630,0x96be10a2,0xb042bb32,
+0x2229b79a,0xb438c13b,0x0f229e46,0x3d9423b5,0x441d29b0,0xbe42b105,0xba39321d,0xb0319c42,
+0x9d4021a3,0x8220b630,0x3bb7983f,0x37a434bd,0xa1b68c8e,0x41bf0c3a,0x191db90b,0x26a1ad28,
+0xa136b6ad,0x12a40a99,0x30b41a32,0x042431c0,0xb140a8b3,0x32a9af03,0x0caa33a4,0x40bd1ba7,
+0xa2b591b5,0xb6a09337,0x21a6221d,0x36c239c3,0x2027b8a3,0x242fc219,0xbb823ebf,0x221096a1,
+0x32b0262a,0x34b929b5,0xb94023ad,0xb01b2e2a,0xa09b3d24,0xc0400e36,0x373a0e2a,0x8f37b68b,
+0xa6039f3e,0x27922129,0xb63930b1,0x9312281c,0x30b62caf,0x1a911cba,0xc13fbf2c,0x1eb1933f,
+0xc12cb706,0xbc0fa33a,0x04042f9c,0xbe2d2cb7,0xa8ac1535,0x95b00291,0xb73b9d20,0x8b29ad33,
+0x28a5aaa4,0x35c033a9,0x301209ad,0x9035bb8c,0x35b184b3,0xac1824ad,0x29b2a109,0xb73e16b1,
+0x36ad29a5,0x2c3207ac,0x83903dc0,0x2731aa06,0x38b43d92,0x1c9f1815,0x9125b633,0x16381537,
+0x3ca722af,0xbc3da59a,0xbe352b23,0x36b1341e,0x330c21c0,0x051d33bd,0xac2bbea4,0xa62e05a1,
+0x3baa0bb4,0x952daea7,0x2a9e90bf,0xaa1e9f99,0xc12226a7,0xac34ae2d,0xaf25a12c,0xb1a02b82,
+0x3ebe3ca4,0xaa27a602,0x9aac9b1a,0x30a9a737,0xa43680a7,0x03ac1018,0x162f9185,0xa0b12fb4,
+0x38af1538,0x1731aba4,0x94af3cb7,0x9b11221d,0x111e379b,0x22b933a0,0x9f123680,0x411aae2e,
+0x8d37b807,0x2b972c17,0x39b926a0,0x1e9635b0,0x2215aba1,0x12872eb9,0xaf0a1eaf,0x09b61620,
+0x96b7229c,0x37b51786,0xb1af14b4,0x39b41022,0x18b1a1b1,0x23b22203,0x9f1223a3,0x33b29920,
+0xb21f259c,0xb42fb331,0x120ca83b,0x83319391,0xb33723b1,0x349b270d,0x8318ba11,0x222d9626,
+0x211583b8,0x2b882798,0x23b10a24,0x0b2631af,0x993811b6,0xb133b416,0xa2ab1638,0x9da52739,
+0xb1203107,0x0fb03991,0xaf242e91,0x2907ac2b,0x138fa01a,0x9eae810d,0xaca22dad,0xbe30b73b,
+0x95a02520,0x9e33b0a5,0xac148aab,0x94169498,0x1eaf26b0,0xa0862ca9,0x170990ac,0xb9282fb2,
+0xa12ca438,0xa1a31007,0xab911137,0x1e8e1227,0x2ba2320b,0xa434b304,0xa7210923,0xa02da02b,
+0xa0b3291e,0x1f18a53a,0xb132ad11,0x10ab1527,0x2b118187,0x9e9a3ab6,0x152da412,0x0ba116ac,
+0x1e999b32,0x202798aa,0x8a9d27a7,0x0027a72d,0xa436a6a7,0x24990f00,0xa1a939ba,0xb3a79029,
+0x170da32e,0x99b231b6,0x170988a4,0x8402b823,0xb11ea718,0xb20e2b9a,0x36b23096,0xa51fafa0,
+0x0c2f2108,0x82008d93,0x2d83901d,0x27261ba9,0x900f1bad,0x27ac2e20,0xaf222790,0x132e9c2a,
+0x101510a6,0xa5860631,0x2c219d11,0x319a23b6,0x31a919ae,0x0091209a,0xaf2386ab,0x969f9e36,
+0xb11a29a2,0x229e2e87,0xae932ea6,0x2496061a,0x1daf1094,0x33af0202,0xa331a3a6,0x1d978914,
+0x269d1bb7,0x8706a0aa,0xac8d9721,0x929ea427,0x1ca11803,0xaf0f2ba4,0x2cb635a1,0xb226a10f,
+0x83011a2e,0xa62512a4,0x031e958a,0x3214ab35,0x249b9597,0x30a63307,0xb13791ad,0x309a8f34,
+0x28a330a1,0x0f24a909,0x1031ae85,0x28848fac,0x2ca731a7,0x19a0a2a0,0xae841913,0x90862da3,
+0x139d8910,0xaea232b2,0x2ca42503,0x248415b0,0x97992bb0,0x9b958f22,0xab2414aa,0x2502a129,
+0x09a19281,0xaba28f25,0x2805b432,0xab9129a8,0x1fa30830,0x0d21a39a,0x201eae9e,0xa01f99a2,
+0xa82ea221,0x092ab231,0x128227a4,0x922523a2,0xb02d179e,0xa0031329,0x899e3219,0x32129f1d,
+0x9518a703,0x971f1d20,0xa7a31723,0x31a92910,0xac3482b2,0x14a88010,0x94841f84,0xb22217ab,
+0xb61e160d,0x1982a02a,0x22a124b2,0x29a0a290,0x14129691,0xa90c23b0,0xa22bab2b,0xa3908f22,
+0xa218110c,0xa21fad26,0x279a1104,0x9b239807,0x9f1aaa12,0x25ae2d12,0x85171e98,0x2aa80112,
+0x180aa597,0x9531ae20,0x0a029285,0x18209721,0xac3400ae,0x918ea02d,0x06a41a26,0xa3872c21,
+0xa0210c18,0x19971711,0x1ea39621,0x14139f19,0xb12b9696,0x8922b130,0xaa151296,0xa12807a0,
+0x1a93a408,0x0bb11997,0x18a61019,0x1ca123ae,0x210294a4,0xa1a61288,0x9823a82c,0x2615a287,
+0x9988239b,0x1322b224,0x24ab30a3,0x9110129a,0xa580268b,0x0c12b031,0xae22120f,0x109f0a24,
+0x9a8b230f,0x9f241da1,0x29a71a82,0x231ea609,0x18911ca6,0x9428008f,0x8614a81f,0xa220a226,
+0xa42a9621,0x18949e28,0x97129521,0x942aa308,0x98229f00,0x91982897,0x24a0950d,0x829c9c8f,
+0x9d912ca5,0x19b01796,0x129e1897,0x93a0a614,0xa38ca22b,0xb02e9101,0x9f090f17,0xaf1d8121,
+0x85159215,0x24a32d91,0x27aa040f,0x8e04911c,0x158e9522,0x15249505,0x2021a68f,0x8d1520a5,
+0xa32a9892,0xa5158522,0xa810942e,0x011c9b24,0x05a22498,0xa42aa417,0x2280a925,0x2395159b,
+0x87a28303,0x8f24a022,0x108e8a1b,0x21929196,0x868a8383,0x21919d18,0x9a02068f,0x89831092,
+0x9b179710,0x10961280,0x8a800192,0x9282010f,0x84040784,0x85848005,0x01018200,0x00000080,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumClosedHat[442] = {
+0x020006e4,0xd8ea5b2e,0xf470e672,0x6ef56161,0xc572f85f,0x69e468e1,0x56da62eb,0xd46236e1,
+0x50f375d5,0x646bf055,0x6ff67cf8,0x485ddae5,0x1765e852,0xe16110e3,0xe168d259,0x70e05ee1,
+0xf275f2be,0xc36aef71,0x28f37bf0,0xe9b24a58,0xe550525f,0x63d6db64,0xdedc6ee6,0xf476ef6b,
+0x6fcae46a,0xd061c0e4,0xe973d8c3,0xe6da6eda,0xe2484a5f,0x73f2585b,0x64e65ee8,0xf36f32dd,
+0x65f16559,0xde4763e0,0x5de63928,0xb2e1594e,0xe068e75d,0x70f169b5,0xcd53d0e2,0x5ce76144,
+0x628235d5,0xf26a28e8,0xc459c064,0x52ec75e9,0x5ad256db,0xe16eee56,0x3b6ae540,0x62c056e7,
+0x5053d1d8,0xdad969e4,0x31e16140,0x49bbe162,0x62e1cb57,0xd2b95cdb,0x5ad4d05a,0xd05dd944,
+0x53d84592,0xd1de6ee2,0xbd3dd659,0x14bbb059,0x43e561d4,0xe035c960,0x68e9624c,0xb760b9e3,
+0x63f069e0,0x4fbacd4c,0xda5956e4,0xe453a142,0x61bad463,0x57b85ae8,0x5b2bc8d3,0xdcb151db,
+0xdeda5a59,0xe03e2760,0xed6dea64,0x4fd6ba68,0xd4d764da,0x5eddc863,0xdc52d33d,0x504ac451,
+0xb4d864e4,0x534b989a,0x65d6b2d3,0xd4534be2,0x403cc0a1,0xd44cb404,0x33e25735,0x5fe05047,
+0xbdc25de0,0xc2cd5cbe,0x57d3a641,0x53dc4dc2,0xdf45b034,0xe12b5443,0xd533c360,0xc8c22256,
+0xb0bb4e35,0xd251c01b,0xd64f8b3c,0x9420a84a,0xb349da4b,0x3ecd2c40,0xb13583b1,0xb74fc640,
+0x48d75bcf,0xc6c84cc2,0xd452d158,0xe55b9837,0x5de24a57,0x24ae36c0,0xc04144d3,0xd8a12346,
+0x28d54556,0x36313dac,0xd8aa56d5,0xa020af58,0x412db1b1,0x44d24bc4,0x2e32b710,0x52d643b5,
+0x06a4ca39,0x82b43f27,0xc7a840b0,0x47c7c454,0xc2b349b6,0x46c6ac41,0x94c89241,0xbf48191e,
+0x33431ac3,0xd250c0bc,0xd0434426,0x8ca04ec0,0x25d658c4,0xc4ac4b11,0xbdb1a53a,0x90bf094e,
+0xaad15015,0x54d33142,0x32ca51cd,0x2fb547c8,0xa104c343,0xc71b43b6,0x43bac34f,0xa643cb31,
+0xb2c64b8c,0xaab341a4,0x853fbd35,0x3ac5329c,0xb32fc643,0xb71449ba,0xc4a448c0,0xa4c03047,
+0x99a3a634,0x43b5c249,0x102fa8b0,0x46d258cd,0xca4ec0b5,0xa238cb4e,0x44a5c341,0x34c54eca,
+0x13c13bb1,0x30ada233,0xb620b939,0xb336151a,0x2ca3b932,0x30ca47a0,0xc88e43b0,0x0c9cb64a,
+0x37b942ad,0xc3402ec3,0x39c23c80,0xc541c93e,0xc142b743,0x22a12400,0x3622c336,0x3bc835a5,
+0x2483c138,0xa031189a,0x3fbc43be,0xb5a438bd,0x2933aa30,0xc24ec1a5,0xb48c3db4,0x22b82c30,
+0xb53fb721,0xada1330e,0x3fb1221d,0xb13d36c8,0x8c922bb1,0x40b8b238,0xbd41a3af,0xb712b438,
+0x46c83e32,0x38c442c3,0x3526c33a,0xbc41acb9,0x1c10a22d,0xc33a8d95,0xacac1037,0xad90bb45,
+0x3fadb740,0xb232b086,0x42b91320,0x41c74ac6,0xac3da6af,0xb83032b6,0xc32738a3,0xb0231835,
+0x34bb35a7,0x29b68922,0x1930c53a,0x9f111f88,0x2aa931ab,0x45bf3bb4,0x32b43dc6,0x8ea030aa,
+0xa231b20d,0xc2202215,0xb033bd44,0x2307b235,0xc4332db0,0x43b7883d,0x31c042c4,0x9837ac94,
+0xaa00909a,0x3cad9835,0x19b33bc0,0x9d27ba35,0x3aba230e,0x31ad2ba8,0xb32e31bc,0xb5251c90,
+0xbd38b83a,0x35b2b441,0x37a5b32d,0xb03191b0,0xa1b23500,0x17aa0b2d,0x35ba1422,0xb4a61c0b,
+0x9229b740,0xa9a71124,0x3ca2af36,0x3fbe3abc,0x2aa022b6,0xb12aa484,0xad3ab630,0x172bb022,
+0xab202bb1,0xb4369d05,0x31a11d13,0x96a316ac,0x37bb1c2d,0x170a15a5,0x13b537b0,0x1ca62313,
+0xa58c28a5,0x94a6892d,0x9326b230,0x9721ae27,0x9f35b82f,0x299e22a2,0xb333a1a6,0x8e25a62e,
+0x260fa18a,0x0820ab07,0x94982097,0x1929a817,0x9b9b1ea3,0x2caf2517,0x960d1aa3,0xae34a200,
+0x1218a01c,0x22a0039b,0x16a2a225,0xa1a0101c,0xad218625,0x1d14af2f,0x30b52c9f,0x2120969c,
+0x9b2896a9,0x09828788,0xae1e9613,0x248fa733,0x110722a9,0x1ba530ac,0x918c29a7,0x0a96168f,
+0x9c0b2293,0x21952ca6,0x22ab2dae,0xa32eb11c,0xa82eab24,0xa727ae2a,0x991fac31,0x0ea82e9c,
+0x0286a524,0x9622aa24,0x2aa71913,0x829d2aae,0x9d299704,0x11100399,0x121eac1b,0x98a12aa1,
+0x03a4280d,0x92a62a99,0x288fa92e,0x219d13a4,0x9223aa15,0xa425a31d,0xa1848d1d,0x25a21023,
+0x219c22a7,0x8c0a1aa2,0x17001ea0,0x9c02089b,0x85209e20,0x20a42199,0x9c219c00,0x92161385,
+0x10921191,0x900a9083,0x0e098c14,0x9e801292,0x22979a24,0x890f0e9d,0x9b1c0b89,0x1f1b9c83,
+0x951213a5,0x18070181,0x0521a192,0x8c8a1496,0xa1041304,0x00948621,0x9e10991b,0x96128a1d,
+0x9d110107,0x8a010c0e,0x9517a31f,0xa01e9011,0x00890f12,0x99121296,0x05911307,0x95179c14,
+0x82961a05,0x00188e81,0x92098690,0x1ea41a0e,0x078c0683,0x84149684,0xa01d900d,0xa3208d0c,
+0x87149d1f,0x85129412,0x91110f94,0x06848406,0x83059514,0x9c1b8782,0x100b840b,0x1c9b199d,
+0x00030a96,0x9c149005,0x95159b20,0x0b971509,0x8f020d89,0x1211960e,0x0e900392,0x01139c11,
+0x03848004,0x91841390,0x10928015,0x0f83888b,0x0993870e,0x88049414,0x01038c13,0x109a1f97,
+0x80940f84,0x04059213,0x108e8708,0x94139710,0x80819113,0x86920f0c,0x95851006,0x0803981b,
+0x1294880e,0x04810483,0x0b930f89,0x04038a03,0x15981183,0x0a809080,0x09848381,0x88010182,
+0x83109311,0x88840a89,0x93110102,0x0e078305,0x8d881195,0x13960f0d,0x0c099180,0x8586038e,
+0x95120306,0x1790850f,0x0d040c97,0x040f8b90,0x088d0287,0x0b8f0208,0x8f021291,0x0c87840b,
+0x04068584,0x118e0084,0x10900888,0x8b8c0e88,0x8507810f,0x880e038b,0x83040084,0x890d910c,
+0x83060682,0x840f8e82,0x82020104,0x880b8289,0x84860206,0x048f0807,0x92080484,0x848a8513,
+0x0d930c09,0x0c868380,0x05058a82,0x85068581,0x8b0e8b04,0x8e040304,0x82860607,0x068b0881,
+0x05830101,0x01850688,0x00048100,0x06848082,0x01028500,0x01820381,0x81810484,0x80820201,
+0x00810001,0x00000080,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumOpenHat[2206] = {
+0x02002274,0xe674f458,0x6063ee6a,0xd7b857f0,0x7bf4cc6e,0xd26458f5,0xe45368ee,0x77f84964,
+0xb35f4ae5,0x1c3063ec,0x6e60e9b0,0x77f164f1,0x51a167f6,0xea284aca,0xba43d566,0xda4e61c4,
+0xca4dc2ca,0x4ff36752,0x56c5c855,0xe4e05ebf,0xf970db69,0xde6eeb73,0xd94d63de,0xd061b6c4,
+0x67ed68d2,0xd773edc2,0xd557de40,0xcce571d1,0xf77cf567,0x6fed3468,0xfb6d60ea,0xf472e16f,
+0xdb69ee69,0x43d0ce62,0x71f96ed3,0xdfdcca57,0xa763f375,0xe3d053bd,0xed6ef272,0xf070ea70,
+0x78f76b2e,0xe971e1e7,0xe477fc73,0x5af273d5,0xde5250da,0x5fda415d,0xc45066ef,0x542151e1,
+0x65ef5acd,0x7158ee53,0x4b62e1ef,0xd1de6adb,0xebd668c2,0xf074ef73,0x4ce867c9,0x166aec65,
+0x5950a5e5,0x70f15cd9,0x58c0aed4,0x365ee0a7,0xc754eb4b,0x62afe469,0xdf64d9cc,0xd95f61dd,
+0x505cd1c1,0x66db5ce5,0xe673d4e1,0x09c9cd41,0x48e66425,0xaad865bd,0xed5864e5,0xb4d5e673,
+0x66e3b964,0x20db56d6,0x57e35d99,0xe86446dd,0xf375f770,0x6ce3605a,0xd966c2f0,0x61cfd561,
+0xd1df62e2,0xd96ef56e,0xc466f471,0x77f97af0,0xe36bdee2,0x26382dc2,0x64d3dd60,0xea4264e8,
+0xf571e76b,0xe630e675,0xf176ee70,0x50c166d7,0x6cd3e655,0xc3e474f3,0xe462f071,0x3369dc54,
+0x34cf59e6,0xb0cd60ce,0xe0db662f,0xf072e65a,0x4464f06c,0xd85a54df,0x591fdf40,0xe453bb83,
+0xd75bea66,0x6ae2c165,0xe15b5ce6,0xd3e172e8,0x4ed48d64,0xd9e06ee3,0xcbd89167,0x60df5345,
+0xd3875ee1,0x5446cc44,0xa0ae48de,0x70ebb559,0xd1b44ae0,0xaac765bf,0xd14fe046,0xf074f065,
+0x61d65055,0xea6167f3,0x4bf16655,0xc143c952,0x3ec0ef6b,0x76e4eb70,0x5fec65ef,0x6ce96cd8,
+0x6df172f2,0x41e052e0,0x53b9313c,0x72f25cc5,0xed69d4dc,0xf272ef6d,0xbe834f54,0x61f15b4d,
+0x6563ed53,0x5f4356f2,0xdf69e6d2,0xbbb5558e,0x2b6cf161,0x55f176ed,0xdc615adc,0x5bf378ee,
+0xe471ec62,0xbf5c57df,0x67f173ea,0xe35e3eda,0xa4c3e167,0xad59d953,0xce5541c7,0x52e255d5,
+0xd0923e55,0x4ad3d148,0xdb63e062,0xc2cf60d6,0xb1e2603e,0xe773f161,0xc3612290,0xe8e173ea,
+0xb0b3d76f,0x47e55c54,0x65d858de,0x74f24cc7,0x71f674f0,0xd062d4de,0x6add59c7,0x4c4fe2d4,
+0xdde16ada,0xf066dc67,0xf275f674,0xcf27c16a,0x1be671e1,0x75f2445e,0x44e45ae6,0xe971f166,
+0xf25e5341,0xf574f473,0x4c44e373,0x61ef73eb,0x1feb71e5,0x63e96887,0xdc38a0dc,0x5fdae470,
+0xdc56332d,0xf167cbb1,0x61d43e66,0x61d1c4d4,0xd3cb5adb,0xe183e36b,0xcad85365,0x5750e55a,
+0xe6514ad6,0x6bd7da66,0xd556debd,0xdf71f05d,0xd365ea64,0x46e66fe0,0x67d5d558,0xe4655fed,
+0x32cf1f9a,0xd454263c,0xd75d4fdc,0xc8d5cc59,0xbb64e569,0x6bb7acd6,0x6aa9d0e5,0xb2944ce6,
+0x25e060a0,0x56b4dc54,0x3fbec343,0xbede64d9,0xb9cc5f44,0xb8c83ec8,0x64ec5a54,0x875fdebf,
+0x63e1de59,0xe572f462,0x70d9d559,0xf373dfe2,0x949fb864,0xb4eb70da,0x255be164,0x5b61dfc9,
+0xe365b6e9,0x5ceb6243,0x73edc959,0x25245aef,0x69eada61,0xa5d657c8,0xe86ef062,0x615de968,
+0x3a1b66f2,0xda6815e3,0xed5fb5b8,0xd952d76e,0xd52e60d3,0x46f16eb5,0xf469be50,0x00dba46c,
+0xe1c960ba,0x3506405e,0xe8629bdc,0xdb60a859,0x52d644b8,0x4f4bda51,0x6ae761e4,0x44bf5ce4,
+0x5ef067d4,0xdf3859c7,0xc74ddd5c,0x5330e25d,0x4f64ef57,0xd453cad2,0x4265e153,0x2e5840e6,
+0xd25556e4,0x54e369df,0xe767e452,0xde67ea63,0x52d4e26c,0xb257e958,0x56bfe566,0x69d2cab3,
+0x4950ddce,0xbc5357df,0xcce070eb,0xe547165b,0x35b60962,0xce67d6d2,0x2dc834b4,0x40d2c55a,
+0xad67e74e,0xc36ad6d3,0xe95262e5,0xdd43a05c,0x57b5dd63,0xe35f2bd8,0xe4d34b5f,0xd2b24460,
+0xdd67ed66,0x9964e45d,0x64cb66ea,0xef68c8e5,0xd2d1ae67,0xe25c3d57,0xe7624fd9,0x39bfde69,
+0x61d72609,0x61e46fe7,0xd15ab9e0,0xc162dc3d,0x52d6c552,0x445ad0c7,0xdc5bd6bd,0xaf51b84f,
+0x72f36cdc,0x51eb65e8,0xda60e564,0xd0c253ad,0xd3d85a44,0x61db3d5c,0xd4581cd9,0xe1b96add,
+0x3660e860,0x3c3f14c2,0x6fdecf2a,0x6835c6e2,0x53ab62f1,0x29a0c0ce,0xc85aa2d0,0xd33e222b,
+0x63e94c56,0xe370e92d,0xdae46dcd,0xd553ea70,0xd7dc6245,0x4ae15d50,0x66bae155,0xe257bfd8,
+0xc562e05c,0x64d4a438,0xe33861e9,0xc8d83f62,0xe3d4603a,0xdb13c267,0xa151e167,0x4ecf46d1,
+0xb3db4d36,0xe061e563,0xe865d451,0xd350d35d,0xe348ba56,0x58da515a,0xd39e6aea,0xc7c857cc,
+0xeb552b53,0xc0b83f60,0x67ce4fc8,0x4f014ce8,0x4ad055da,0x6496d645,0xb4d368f0,0xdc32b153,
+0x2de05057,0xe1d260a2,0xd758e66a,0x5b9fc25b,0xe466dfd4,0xe666db60,0x44d33653,0xcf4cd345,
+0xe75b4237,0xd3435ec0,0x6fded756,0xdf52d1d6,0xc025c060,0xda63d83f,0xa562e457,0x56d420cc,
+0x69e33d3a,0x3f0d58e7,0x57e326b2,0xd558e462,0x4ece60cf,0xddd55dd0,0x65d5e16e,0x59bbc7d0,
+0xd556d6b6,0x61e65752,0x42dc56da,0x494de35f,0xa9d74dc2,0x59d93a45,0xa4da1a37,0x5cd0e266,
+0x66e964d3,0xb3c63cdc,0x65e65e33,0xbf62e1c4,0xe04c51d3,0xdd592f50,0xc1d868dd,0x6ee43d57,
+0xeb555cef,0x3bd34b5f,0x3be13144,0x22e1395b,0xb938c155,0x5edcc84e,0xd4b7d856,0xe467e565,
+0x58cdd764,0x41bfc59f,0x60e056c2,0xdf564dda,0x61ea6215,0xe365c4c7,0xd766db4c,0xa35cde1b,
+0x64e7572b,0x69e452d4,0x425de1d0,0xe1ce62dd,0xd65bd563,0xd153df5c,0xdf5bd13f,0xe0d34a5d,
+0xc247cf65,0x5ce361c7,0x54db48cd,0x614bdb32,0xd8863be0,0xda54e167,0x4561e45a,0x649acec5,
+0x64eb6eee,0xbc50c2d5,0xd353d44c,0x64e25b30,0xc4564ee6,0x63dc60da,0x554150e8,0xb551cfd1,
+0xc153b49f,0x5eea6bdc,0x50da5ad1,0x67d344ca,0xe35651ea,0x5c25df63,0xde5f40db,0xc1d15dce,
+0x61de563d,0xcb60c0da,0x2de261d8,0xe158d45f,0xd562e65e,0x5fe8564d,0x50e54415,0x68d4d960,
+0xb9bb34de,0xdd63da4f,0x61bf8444,0xe166d9db,0xe964e062,0xeb60d05e,0xdf55cb65,0x5348e25e,
+0xc7464fd8,0xce4b47cd,0x4cd93731,0xd0dd583b,0xe356bd59,0x4054e05c,0xd055d541,0x9eca51b0,
+0x59d363d9,0x4c4cc6d4,0x2e44cbc0,0x21c5a2af,0xba61ea60,0x60d3ca4d,0x65d922c9,0x60ca54e3,
+0xb0d14de0,0x5748d558,0x62d964ea,0x4466e4d1,0xd9555be6,0xd3b75cd0,0xa0a2582b,0x420051db,
+0xe0dd69db,0x5bd0475e,0xe258cdd2,0xc6b23f57,0x4bc4de60,0xb4352231,0x2660e121,0xb659e24a,
+0xd25043d0,0xe367e250,0x4935d45c,0x320760e1,0x60e564e0,0x51ce34b5,0xc24eb6d0,0x3a4ee154,
+0xc5d652a3,0xdacb4454,0xea6eea68,0xcc6ae965,0x50b8b4c7,0x59d3da54,0x583ed335,0x43d865e7,
+0xda36d146,0x60d9da69,0x56cfc843,0xd34a60e2,0x4ccf5ed2,0xd05141d5,0x56da56c2,0xcba84fd2,
+0x3ca4b952,0x4ad0cd3d,0x2ede5b30,0x3542d63a,0x60e12349,0xc03c50d7,0xa951dd3a,0x3431c243,
+0xdc51d044,0xc2504e13,0x9154c2d0,0x8013b4ac,0xd3abd85f,0x9049d95d,0x93d7324c,0x53cab951,
+0xd960de3e,0x93e065c5,0x57dd5785,0xdd4352d2,0xaaa53942,0xa54e40c1,0x4f39c5c8,0xadb65fda,
+0xb4375fe0,0x455be23d,0x9261e09f,0x593220d3,0xa43042dd,0xe55244cc,0xc648df67,0xc254e45e,
+0x5bd6db60,0xb056c91c,0xe155a9ce,0xcd48a355,0xd12d56ba,0x48d34eb5,0xce5bd538,0x58d049af,
+0x5ad65ade,0x68e761dc,0x4be361e3,0xdb5edd55,0x49d55031,0x9bb645bc,0xb82ebc43,0x50a5b936,
+0x61c859e0,0xd55bcbdc,0x4fd0c853,0x47df4938,0xdf3755bd,0xbfa2c15a,0xd7591a96,0xd063d225,
+0xc4a356d2,0xd6403820,0x2e3de162,0xc8b53b29,0xc347ca51,0xd05fd72f,0xe365e45c,0x54df5547,
+0x40c32fac,0x33cf1d90,0xd652bb40,0x43be944a,0xd1a054d2,0x5849d955,0x12d655dd,0x50e45a39,
+0xc7c4b54a,0x5bbed862,0x5adb54dd,0x9328ce3c,0x5de765d3,0x55d131b2,0xbdb74cd2,0x4e5be55a,
+0x58e15de1,0xe054b0b9,0x5331d35c,0xc965dcc8,0xd94832c7,0xd55bd159,0x45d256c2,0x4bd25bce,
+0xd93c59de,0x61d6c85d,0x442948dc,0xb44fadd0,0x4adc62d5,0x8b59d82c,0xbdbb5eda,0x62dd4032,
+0xd4503cdd,0xd050d152,0xa45ce760,0xe061d1a8,0xcab35236,0xc659d651,0xbc5fd2bb,0xd8509dbe,
+0xe043384d,0x413fd860,0x50c84bd0,0xe968dabc,0xdb61e064,0x61e15b13,0x48c053e0,0x46c94fd4,
+0x46b045c3,0xdf564eda,0x9bd862ba,0x3e16d54c,0x36c04038,0x3c1255dc,0x61d0d441,0xb41e49da,
+0x2f36ad2e,0x37d036bf,0x4132d555,0xd549d843,0xbe07c35f,0x67e966d0,0xb9c854dc,0x56dd60c9,
+0x53c749d0,0xdb4550d9,0x46cc8054,0x5751d5a2,0xe360ccd7,0x64e24b5a,0x5bdf5fe2,0xde41a6c0,
+0x1ac9cc63,0x5236d856,0xb1c522cc,0x5ddb4c4a,0x62e25ddc,0x4ee160de,0xe160d740,0x30b24a46,
+0x27d961d4,0xc864de3e,0x58c757d6,0x58d855de,0xaa41cdb7,0x4106d453,0xd751b5ac,0xd749254a,
+0xd2cc5db8,0x4626d05b,0xd44037ce,0xd9553b2e,0x51d5c051,0xa950d746,0x53c4a43b,0x49c302c6,
+0x51c2aab2,0xc851d586,0xce55db58,0x5ee05534,0x3c1a21d5,0xd058d482,0xc64b2a34,0x2d3b3ad0,
+0x41d647a0,0xac50ce32,0xb9124fc7,0xd75130c3,0x46de5c3c,0xc0c35ad4,0x96af55c3,0xb945ca21,
+0xc144d04d,0xb656e15a,0xd4ba5ace,0x97bbbf57,0x4ac30142,0x13c088be,0xd32f2640,0xd24bc552,
+0x265ae157,0xce58cabf,0x4f2624ba,0x43d85edb,0x45a9d047,0xcb53d94b,0xcea357c6,0x58e25839,
+0x4cdf52cb,0xd526cc54,0x19c83853,0xd048a831,0xd04a3233,0x5bdd52b9,0x3857e02f,0xd359b0c6,
+0xb43f15b0,0xd352c02b,0xc7b04e09,0xcfa14327,0x2547dc5d,0x3d4dd42e,0x42d155d2,0x99d34226,
+0x56c2c750,0xda1cb0b2,0x3e34ce61,0xa72847d2,0x50c237c3,0xc5d052c6,0xc5bfaf57,0x50bb3246,
+0xd72031d0,0x4547e064,0xe25609ca,0xc52a4350,0x55b53dc0,0xb657c8d0,0xce4e43d1,0x1e50b0a7,
+0xd08353d5,0xa3c95234,0xb34fd342,0x3544d546,0x5bc6c93f,0xc959d3c5,0x592fbd0e,0x92c557e0,
+0x122629aa,0x5ac88cae,0xd74b55e0,0x4041d750,0x4cbdd24e,0x4ae161d3,0x350cbc41,0x49d85ad1,
+0x212ece43,0x2e383cc4,0x50d15bd6,0x49d044d0,0xb42e31b9,0xaf36c547,0xb148ce34,0x1a26a314,
+0x0d30b72f,0xd852d033,0x2ca6be55,0x62e255b6,0x4e2433d7,0x42c253db,0x40c221c0,0xd159dc4f,
+0x412cd34f,0x1fb82c1d,0x59a7c782,0x4dce49d4,0xd2b04ac1,0xc883824f,0x47d0453d,0xd646b39a,
+0xc73b3e46,0x459954d0,0xc859c3cc,0xd654c2a9,0xbf56df5a,0x36b1c94a,0x5ad248b7,0x2746d0c3,
+0x55db50bd,0x37c6ad9f,0xe05bd850,0x4eb6d461,0x36bb03c5,0xc84a9732,0x4647d134,0x64d837c8,
+0x53d553df,0xc905b6a8,0xd561e15e,0xc954c43c,0x54d959c5,0x8abb50d6,0xc13fa439,0x2fd759be,
+0xd43f41a9,0x54d43e48,0x4fd95eda,0xa6d054be,0x9150a3b2,0xd561c7c7,0xd05ab2bc,0x44d256c6,
+0x38c6c648,0xca40ae39,0x3057df53,0xc14cb1c8,0xbf54d64a,0xd352a6b9,0x5fdd4747,0x50284ce0,
+0xa04dcccf,0x0c45ca3a,0xc64b35c7,0xcb8a56cb,0x53d6333c,0x49d554c2,0xd04ca4c5,0xcc10a54c,
+0xc939cd55,0xc053d153,0xb62a43c7,0xb08cc744,0x53d55215,0x58d436c6,0x4ba12ac7,0x51c543d3,
+0xb84dc8be,0xde5bcf3e,0xc760dc56,0xc73a40c9,0x27d24d36,0xc0c03f24,0x4dc21c44,0x3bd151cb,
+0x4b9829a3,0x51ba45d5,0xd7529fd3,0x4db7d860,0xb22ac836,0xbdc550af,0xd3a0463b,0xce59d051,
+0xbbc053c8,0xc055d94e,0x52c1cf51,0x39b131c7,0xb538b4ac,0x52ceb74a,0x222186c6,0x204dd94d,
+0xa9c34bc5,0xd23cc34b,0xc323c754,0x41c4aa4f,0xce56db4a,0x3905c148,0x2ad650be,0xc556d752,
+0xaf48c525,0xc143b38c,0xbe433cb2,0x11ca55c8,0x3e1f38b5,0x4c2c8ac8,0xd03e47d8,0xd250c54f,
+0x58c01234,0xba5cd3cb,0x12ac16ab,0xbad05dcb,0xc34ed046,0x13ce2b4a,0xbc391422,0x3cb4a53b,
+0x3da235bd,0xc842bcb8,0x4eba3739,0x3aa9c0c2,0x57b2cf4b,0xb2af41d4,0x52cea73b,0x47c6a101,
+0x51c9b83d,0x50cb20c3,0xcba6a620,0xc451d657,0xcd51cf4a,0xdc55d048,0x3abf414f,0x25a052d5,
+0x45b5c430,0x4ab3c632,0x37c84cc6,0x4dd74291,0x42b63412,0x4438b4c9,0xd154d0a6,0x59ccc652,
+0x343906cf,0xbea942cd,0xde5ad955,0xc24bcf5a,0xd221952d,0xd12e2851,0x8fc3423a,0xd44ad351,
+0xd451c051,0xc051ca44,0xd955cc3b,0xaa9fb14e,0xc0cd5034,0xbe1a43a4,0x4122bb45,0x40d44acc,
+0xc325ca50,0xc757d44f,0x24af2ca1,0xca22201e,0x4a96bc4a,0x50dd5bd5,0x382ccf40,0x4e00c933,
+0xc44c44d6,0xca48bc9c,0x2dcb4643,0x3cc243c1,0xd13bc941,0xa3c13252,0xd252c82b,0xc74ecc50,
+0x2fb31440,0x1747c7a8,0x9dc64ab2,0x4138b823,0x4fdd5ad3,0x5acfbc41,0xc94c13d4,0xa431bf49,
+0x1e32a5a7,0xbe4bb6aa,0xc03b4acb,0x41ba2e96,0xc3af8890,0xcb082a48,0x4044d050,0xb1cf55d4,
+0x46c1ba50,0xd040a4a5,0xd151d251,0xcd9db351,0xd857d558,0xd559d454,0x17cb5125,0xad4420b1,
+0x51c51eb7,0xaea23dc3,0x28b74ec2,0x312413b3,0xd157d123,0x35a3b142,0x1cc753cd,0x40cd3335,
+0x4fc9c949,0xd59c48b9,0xbd3dc354,0xd158c934,0xcb4d43c0,0x2acc4fb9,0x28c24eb8,0x2ed044a7,
+0x27cd3d3d,0x34c6bc47,0xce4fba3f,0x94a447b0,0xbaa052cf,0x2e0ca734,0x312f1bb7,0x4ec24ed0,
+0xcc3354d9,0xa9c84fb0,0xa234993c,0x3eb2c53d,0x47c430a8,0x200e3dc7,0x4acb3bb1,0xb7aca006,
+0xd257c942,0xbc4fca39,0x56c1c445,0xc24046d8,0xd05bd644,0xd34730ad,0x393fbf4d,0xa139a6c9,
+0xa61da128,0x42d453c2,0xc756d145,0xc749b8b3,0x42cf874b,0x0487ac30,0x32c64ab0,0x9dc64bba,
+0x3acb4413,0xca4dc528,0x47c1ce53,0x2487c238,0x38c138aa,0xb13bb826,0xc5271b2b,0xb53db83a,
+0x48c24ebf,0x50b639cb,0xb33841d7,0xa6c84399,0xc357da54,0x4dce44c1,0x46bec539,0xa4ca4bb6,
+0x40a8b240,0xcfbd52c8,0x8197a150,0x48c94ac0,0xcf3135c5,0x4ea3bd4f,0x440041d3,0xb340b3c6,
+0x3a45c231,0x99bc4ed3,0x35aa9a34,0x1e333ac5,0x8c4cabc3,0x40c550d1,0x3b32c490,0xb752d631,
+0x30c01535,0xc39d44b8,0x4bd4521f,0x4b201bc8,0x49b787cb,0xb745bba6,0xbe2041b1,0x343bbc0c,
+0x4b41d12c,0xca8c53d7,0xbf2549a5,0xb5b64cbf,0x3c9d2c32,0x53d451d1,0x27342dc6,0xbc46aebd,
+0x52bab428,0xb3a4b0bf,0x9042d052,0xcb4f3fca,0xc30c51c6,0x52d44024,0x14d14dc0,0x4abcc04a,
+0xcea751d1,0xc29cb551,0x9043b744,0x47d150ca,0xc4889185,0x91b43442,0x98c44fbe,0x52cd429b,
+0x94be43cc,0x3dc02c28,0xcf50c730,0x082e1528,0xc33c39b6,0x3db11500,0x44841cc1,0xc015b4a6,
+0x38c11846,0xc742b3a0,0x4726c84b,0x9183a1c2,0x2327c546,0xc5c455ca,0x48d34941,0xc44ccf21,
+0x45b8c751,0x99c251cb,0xa81d4ac1,0x35b83ebd,0xcb452ab8,0x22162a1a,0x22b642be,0xd34fb194,
+0x3ec5ae4c,0x3dc29535,0x149544c2,0xc3af41ba,0x1042c347,0xc450c883,0xc650c931,0x50b4c44b,
+0x4433b7c7,0x4fcd4acb,0x40bc44cd,0x2db247c7,0xd045bd8b,0x3123c852,0x319f1799,0xbe44b6b1,
+0xb1c452b6,0xbab33d1f,0x3fc54aa1,0x402bbca1,0x9e39b3ad,0x0644c0a9,0x34c74cbb,0xb89b42c4,
+0xcea12c3f,0x91b09c4e,0x3ab62b13,0x19cb4bb8,0x46c23d8a,0xb847c0ba,0x353dd144,0xb438cb3d,
+0x0b34ba39,0x3ab80107,0xd44142c6,0xbd3cc050,0xbf53d246,0xa8bf48c2,0xb63ec242,0x43cc3f33,
+0xb1322dc4,0xa24cd343,0x43a2b62e,0x3420c0a9,0xa63911b6,0xcf45c331,0xcf43b248,0xb730b84a,
+0x22cc478b,0x33b5b642,0x40beab3b,0xb2b545c1,0xb239c740,0xb3b40743,0x49c22233,0x3841caa1,
+0x392eb2b0,0x48c495b8,0x2ac741a7,0xc7bb4db5,0xd14bb244,0x8dc6433c,0x49d0470b,0xcc45a2b9,
+0x3fa32035,0x32a5c114,0x37bbb93c,0x3bc63b16,0xacb41ea6,0xc649ca4c,0xa7239c33,0x4ab8a620,
+0x28be43c6,0x09a13db9,0x40bec243,0x52c20105,0xc83a49d6,0x1d00b441,0xbb43c12c,0xb747ca38,
+0xa5be392e,0xc840152b,0x26ae2f25,0x3bcf50b8,0x2742c70d,0x2a2416a8,0x40b233c0,0xac4fc1b8,
+0xa21ca0b5,0x4122b238,0xc23820c7,0x1240ce47,0x50bec341,0x02c552d3,0x9740c23d,0xc1b843bb,
+0xbe3aa842,0xbc3ab439,0x3eb0c345,0xd14235be,0x0c1bb448,0x4ad04181,0xb1c14ac3,0xba33bf43,
+0xbf423694,0xbdb647c0,0xb09fb548,0x30b1362b,0x98a027b5,0x47c22a30,0x392ab3be,0x3db9af9e,
+0x42d148a2,0xca45c42b,0xce4bc249,0x43bcbc48,0x88a1bc2f,0x068d2030,0x1b0eb311,0x383abe1b,
+0x41c83abd,0xc3aa38a6,0x89a80346,0x40c34abe,0xb2ba4ec9,0x37a13d9f,0x26ad45cb,0xb144c40c,
+0xa585aa3a,0x4ad44fb8,0x39abb42a,0x1c2017b8,0x45ca45b4,0xbd1cb693,0xa246cf4c,0x47c89931,
+0x51c93eb7,0xc14136d0,0x33b80a21,0x3c10be32,0xa4a637b9,0xadbb4abd,0xca46b83d,0x46cc4035,
+0x3fb882b4,0x2c30c735,0x1ebc49bd,0xaf9d46c2,0x34c443af,0x973bb283,0x4203b722,0x351445d0,
+0xc63634c9,0xa24bcc49,0x3c2f88be,0x22c94ac8,0xba95bc45,0xcb2da846,0xb430b349,0xb9992c0d,
+0x1117b041,0xc02622a1,0x2547d149,0x342faab6,0xc2af40c0,0x8041c44b,0x35c136ba,0xb330b42d,
+0x3bc33426,0x3cc840a9,0x952bc335,0x23bd132e,0x3dc0352a,0x25c149c8,0x2e2cc238,0xcf4aada8,
+0x0528a438,0x19b139a0,0xbbba47c1,0xc13c9d41,0x38a942b8,0xb4bb3ebc,0x35ae2737,0x15c44ac4,
+0xa645c840,0x42bb21a9,0x2d3db9a9,0xc743afba,0x89b39743,0xb702b642,0xc5361331,0x33b21c3c,
+0x9db443c2,0xbf02bd43,0xbfb44235,0x2bc03835,0xb835ac14,0x8f48c233,0x38b03ac1,0x41ad45c9,
+0x9d42c2b9,0x45b7a831,0x25a132c3,0xd04332b6,0x33ca383e,0xb93ec944,0xc0332821,0x28a5902f,
+0x1f2834b9,0x9db547c4,0xc93b3bb6,0x04b33f31,0x409a82a6,0x40b641c8,0xa209a9af,0xc14ac742,
+0xb82bb330,0x9b2cc446,0x1d1cbb39,0x4ec30919,0xa41e40cc,0xa82732b6,0x47a28788,0xa5c146cd,
+0x14b01b38,0x3c91c23e,0x21b782a3,0x35b93d0e,0xab3b36c7,0x3d9b34b9,0xa23089c2,0xb0c1449b,
+0x45c83634,0xc245c0a4,0x3441cc46,0xc52933c1,0x38be2c3e,0xb9b03ab2,0x45bfb749,0xaab544c2,
+0x4096258d,0xbf32a8b9,0xc21a392c,0x2b8eb139,0xb83130ab,0x3bb330a7,0xd050c491,0x8d30173a,
+0xb2c146c0,0xc644c748,0xc23ec64a,0x349ab544,0xcd51cb27,0x27a5b244,0xba41c02b,0x4fcc4020,
+0xcd48adc3,0x2db1b14c,0x9e1c26af,0xb3302eb6,0xca43c744,0x36afa246,0xc64423be,0x40c53a1b,
+0x1cb82083,0x2ec01c28,0x2934bc35,0x451591b8,0x811a92c4,0xa691b236,0x41c22629,0xa733aaa1,
+0x2130be2c,0x3f8736ba,0x3faf95c0,0x1fb03fbe,0x3cc548ba,0x13b44bc8,0xbc323fc1,0x3ebd43af,
+0x13c147c5,0x99af312b,0x05c44fc1,0x9bbf4297,0xc147bc38,0x44c32d84,0xa6a2b41e,0xa492aa40,
+0x3c9a1c20,0xcc3b3eca,0x90a1313c,0x4dc19e16,0xc0a041c8,0x3bc08844,0x3e1bb496,0x33c74bc6,
+0x29b23db2,0x86103bbc,0xc94bb3ab,0xaab2163c,0xaca52c2d,0x43c0a43e,0xc741a4b3,0xc94ac747,
+0x130bb142,0x888438b6,0xbc2924b0,0xb730b541,0x19c14013,0x13c74022,0xa5b63427,0xb416b33f,
+0x43c5392c,0x8bbc35b6,0x40c5382d,0x201621b6,0x310c23b2,0xad22aaab,0xc22cae39,0xb5a83a32,
+0xa344c842,0xc040b992,0xbe41b940,0x3dc747a3,0x2d1fada7,0x401999af,0x3105abb5,0xae3430bc,
+0xa81727af,0xa73ead24,0x91a83bb7,0x17963bb1,0x320240c3,0x36b541c4,0x152e16b7,0x0632a7ac,
+0xbb2317af,0xb633ba42,0x98100735,0xb533aa9d,0xb11f301b,0xa12b33a9,0xb22734b9,0xba2d9013,
+0xb0be4121,0xab30c547,0x89b93430,0xa3359814,0xb42841c1,0xa13eb91e,0x39bf40b1,0xc148bf90,
+0xbc3c16a0,0xae36c23b,0x30b03012,0xa7a938b2,0xc13e1ca1,0xa345c73e,0x95a135ba,0xc440c843,
+0xbc39c54b,0x87a52630,0x18190191,0x10ba3390,0xb72c38ab,0xb73bb20e,0xb31cb13a,0xaf1e9737,
+0xa48d0d24,0x0f9d221f,0x0c38aca1,0x0aaa16a0,0xb135a919,0xb73b911d,0x43b53cb6,0x3dc342c4,
+0xb02ca494,0x0c131b91,0x1641c226,0x3fc244bf,0xb4ae42c2,0xb28a8639,0xbb11a736,0xb19b9340,
+0x04b7973f,0x1ac13030,0x37b61231,0x25b21ea7,0xb235b229,0xb33fc134,0xaf2d1815,0x47b58818,
+0x3733b4bd,0x3ebc43c4,0x29b742c6,0x46b6b133,0x0c9e3ec9,0xb845bd27,0x35a0ae17,0x2dc13da6,
+0xbf21908d,0xa207903e,0xbd252698,0x1440c644,0x20b43fc1,0x3eb8a033,0xbb9a3dc0,0xa932be42,
+0x2736c43e,0x1d9a33bb,0x45c038b1,0x34c04ac9,0xbf3734c0,0x98b93620,0x3fb2a737,0xc240afaa,
+0x2c28ac36,0x28a435c1,0xb7b538a3,0x2fa7b045,0x06b743bc,0xbd892f95,0x44c13733,0x41be1dba,
+0x32c23eb4,0xb4379713,0x08a220a3,0x1c159320,0xb13db610,0x15318796,0x23a911b1,0xae3fc236,
+0x0429068e,0x2faf29a6,0xa28638bf,0x03a61127,0xb121b032,0xbb25852a,0xa132b940,0x98ac37af,
+0x2ac1272f,0xb227b736,0xa01dad39,0x38c2271b,0x3717b027,0x983dbab3,0x41c52b17,0x202dad9a,
+0xa29e16a9,0xaf361019,0x999281a0,0x232fb536,0x93a62eb3,0xb443bc26,0x0537a605,0xb1a729b1,
+0x93b1133d,0x0207851c,0x2cb00015,0x1485af2b,0x3ac2379c,0x29b130ac,0x0a9a33ae,0xa63cb981,
+0xa0aa2023,0xb130b229,0xb235bd3e,0xb731a831,0x9f35b531,0x2fad24a0,0x20ab190a,0xc43135b5,
+0x2eac2537,0x1516a1aa,0x9141c330,0xb141ada7,0xc441a8a3,0x12b33732,0x322a9da5,0xb637afad,
+0x889f172b,0x94ab3dac,0x3ea41091,0xa33eb3b5,0xa12011a7,0xc135b937,0xa51fbe44,0x38b62c28,
+0xa4ba3db9,0x31a2bb42,0x38b49016,0x2fa594a2,0xb2ad42b9,0xba3abb3b,0x2bb09734,0x13149a23,
+0xbf42b5a5,0xba35102f,0xb0822080,0x44c10c38,0x20b63dc1,0xc21a2611,0x9c1ba93d,0x44c22824,
+0xa630a2b4,0xb145c230,0x43c02b9e,0x993eb5a9,0xa43396a9,0xb12f33b5,0xa6b037a0,0x2a1d8f18,
+0x2c2ba6a4,0x3c15a1b4,0x0f0b93b6,0x37b633a8,0xb7320caa,0x19b03017,0xb139b91a,0x3ab3b13b,
+0x96b93ab0,0xa8a29d35,0x2ea93314,0x3ebc37b5,0x4093a8af,0xbf40b4b2,0x3091a036,0xbc38b595,
+0xba26212d,0x09b42c2c,0x2534be32,0xa08b23ad,0x24ba3ba6,0xac069224,0xbc36b437,0x2098a536,
+0x91b441b1,0x9e8638b4,0x9b319e1c,0xa3aa3ab5,0xa338b72f,0x39c544b1,0x3e87af02,0x951b9fb9,
+0xa5b62430,0x0a38ba3b,0xc08141c1,0xa4a2003e,0x18178e24,0x1f2892b0,0x28b0898f,0x32c13383,
+0xb6998b28,0x0720a334,0x0f0db12c,0x17bd40b0,0x3822bb34,0xa4b942c0,0x9b22b93c,0x2386b636,
+0xb82e0786,0x3db40c26,0xbf42b6a4,0x38c24186,0x843cbaa0,0x29b32fa6,0x0eaf2798,0xc038b630,
+0xb9a63034,0x96a5103b,0x10a90921,0xa7242105,0xc33524ac,0xb720a23e,0x0c34be3f,0xba39b50f,
+0x37a40332,0x28af29b7,0x37c140af,0x2924b092,0x27af0ba4,0x0d828d1c,0xaa3597a3,0x1538b30a,
+0x33111cb6,0xa59937bf,0x36b6812d,0x9b81a50f,0x1eb82a23,0x8f33ab24,0xc141a3b0,0xb3022529,
+0x3918c241,0x9739bda4,0x3da39c20,0xa933a0ba,0xb63db528,0xb1140812,0x2711bd41,0x31afa019,
+0x1b3cc126,0xa11305b2,0x3a14b938,0xa4953cc3,0x36b32900,0xaab033b1,0x8f22b93d,0x8221961a,
+0x28a68c12,0x22a98aa0,0xc133b232,0xa238c144,0xb29b2aa0,0x8ca1aa3f,0xb136a91c,0x2dbe3118,
+0xb72fb631,0xb135bb3f,0x309d1f00,0x30c03db5,0xbc220400,0x23998e39,0xa09227b0,0x3513a023,
+0xba3c9eb9,0x34b32326,0x26a4999f,0x3290b12f,0x3fbb32b5,0x1b33b5a8,0x24b125a5,0x19198712,
+0x873399ae,0xb93eb2a4,0x8333bc3e,0x339221b1,0x33ac00ac,0x150c89a0,0x849dad28,0x30bd2a1f,
+0xbd3dc033,0xa9202426,0x8081159b,0x311cb82f,0xb42f14af,0x30ba2e0c,0xb73fc131,0x95b7361d,
+0xa7a62c1e,0xa5912a18,0x2b06b130,0xb6a035b0,0x18b0262f,0xae32b028,0x2cb63590,0x0f27a89b,
+0x30b20014,0xa6ad36a3,0x13089321,0xa3022ba4,0x202fb024,0x44c23eba,0x8f1288b4,0x3ab431a5,
+0x01b13cbb,0xa234a915,0x2ba720a3,0xa20da413,0x95912a1e,0x3cbf41b5,0x1fab34ba,0xc02f2cad,
+0x1bac993d,0x20aa8716,0x29b01122,0x82249a83,0x39b12dae,0x272cafae,0x27238aa9,0x9a9d26b4,
+0x35a4b33a,0x388705b1,0x26a53bc2,0xae2d02b0,0x29ab9833,0xa90322ae,0x1d8c9231,0xb53595a8,
+0x20ad3494,0x20a0020f,0x95338caa,0x3cbe38b1,0x2bae2fb3,0xa3af36ab,0x35ae2e09,0x252fabb0,
+0x95151ab2,0x1c2cbe33,0x97b034a5,0x8b9ca62d,0xb640ba34,0xad38a408,0x2824ac15,0xab942db3,
+0xb2899032,0x11a30531,0x06a2a931,0xb530a828,0x842ca32f,0x26289fab,0x2ab535b6,0x9522b82e,
+0xb020b133,0x2e99a032,0xa51a909f,0xa2269e1d,0x8ba20321,0xab39b62f,0xb2222bae,0xb21ea533,
+0xa735b836,0x269a1307,0xa735aaa2,0x14989525,0x3792a28d,0x14a692a6,0x9a25ad2c,0x8d9aa72f,
+0x23a69a26,0xb52d8384,0x9cad2028,0xab32b535,0x220dae2f,0xb02eaa93,0xb03bbf39,0xa6181e83,
+0x20ac0d29,0x2b1112a6,0x1faa22ab,0x2fad8b21,0xb79037b4,0x3181b43d,0x2a20b296,0x15b739b1,
+0x25ab2c99,0x0320a616,0x18b63cb0,0x23bb3aa3,0x1387ab28,0xa317b031,0x37b82d05,0x9b27ad03,
+0x3ebd35a3,0x179430bb,0x141ca517,0xad341cb1,0x8a9c868c,0x22a9ae37,0x1ba52407,0x11b0238f,
+0x2f9ca62a,0xa62a11a7,0x31b031a8,0x271612ae,0xaa890ca8,0x92ad3023,0xaaa22712,0x2585942e,
+0xb51133b6,0x9aa51334,0x9386971f,0x1e26b12f,0xa428b085,0xb2969430,0x22960534,0x319b09a9,
+0x33b01faa,0x130211a2,0x942787a5,0x0da633a8,0x30ac0786,0xad8d219a,0x0632b531,0x8b1da408,
+0x35b938ac,0x121b1aad,0x212ba4a0,0xb38527b1,0xa3ad2f2e,0x2b97a732,0x9f1ba098,0xa52b0e15,
+0x05a217a0,0x0b21b434,0x21b335a7,0xb412239c,0x96a3212e,0x218da323,0x3199068c,0x210921b6,
+0x28a92cac,0xbb2722a9,0xa59f9137,0x028b0c2c,0x281a82a5,0xa032b096,0xa50d30ad,0x31b22810,
+0x9e34b68b,0xa19c8824,0xa2951522,0xa605b036,0xb934af33,0x83a12328,0x2603a21c,0x34ab31b3,
+0xab9630b6,0xa39b2027,0x92af2225,0x140eac30,0x34afa72d,0xae37a7a2,0xad1a31ab,0xac301109,
+0x209e2ca4,0x14862eb1,0x078e8d9d,0xaf22ae2d,0x2383932e,0x26a227ae,0xad34a1a2,0x868f860a,
+0x82011917,0x20a02caa,0xb33aaf99,0xa733b832,0x2126b32f,0xaf3119af,0x24a62899,0xb12929b1,
+0x02a08c27,0x0026b42d,0xa3a030a4,0xb12aab30,0x35b73218,0x102182b0,0x9d2eac95,0x1e16a726,
+0xa032b187,0x170a9e16,0xb62db123,0x34b82432,0x061e1dad,0x252995a8,0x130786b0,0xb2202197,
+0x8d9e9e30,0x0020a123,0x14b232a0,0x1304a020,0x04139380,0xa10ca019,0xaf3ab52d,0x2ab537a1,
+0x9aa432ab,0xb09b2118,0x14a08733,0x9d9a0514,0x2cae9d2d,0x2430b929,0x1d2ba0ae,0x27b034b4,
+0x2905aa1b,0x01a10da5,0x95159a24,0x37ac9f26,0xb52998aa,0x2486102b,0xaa339ca9,0x211f9183,
+0x952e91af,0x2a919780,0x9e101ba6,0x27af30a2,0x32b4309f,0x9d9b20ab,0x28a0a130,0xab2515aa,
+0x84a51628,0xaa250b95,0x2ea8a631,0xae209b82,0x189baa35,0xa5178313,0x19a72111,0x1b8daf2a,
+0xa5118c0a,0x96129e2c,0x349b8e00,0x839212b0,0x1cb22918,0x1415ac23,0xa8820202,0xa915a834,
+0x32b6301a,0x269596a1,0x0a249b91,0x84911ea9,0x9431b429,0xb037b114,0x2ca02b97,0x32b020ad,
+0x082cb103,0x9225ac82,0x26a6a027,0x34a79115,0x97841db1,0xa3229e20,0x31a42894,0xa48731b7,
+0x9b032388,0xae33b127,0xa3832491,0xa633b531,0x1b29b021,0x1b0717a7,0xad2b90a5,0x818f1e18,
+0xb427109a,0x27a78d30,0x35ac27a6,0x069703ab,0xa08a021b,0x18140214,0x32b030ae,0xa11128b2,
+0x2aa931a1,0x11a130b3,0xa1229a0a,0xa1201892,0xad132496,0x2aaa1e1b,0x0b2db415,0x9b248599,
+0x15aa32a5,0xa08228a0,0x0625109d,0x978e22a6,0x18a82603,0x0f8e1b93,0x9a1e8299,0xb235a508,
+0x2dae2416,0x90a030ad,0x29a81e8d,0xa42b9a91,0x0a29909a,0x1b991ba3,0x25a10290,0xb531a490,
+0xab30a630,0xa9082ca1,0x03840f1e,0xb422179a,0x8e158e2d,0x08aa2397,0x30ac1f1b,0xa5309ba5,
+0xa0211ba3,0x9d2db025,0x100da820,0x16079e20,0x17a221a5,0x2ca38d20,0x90092ab4,0xb3260e85,
+0x279ea130,0x07058899,0x16a22ea1,0x9e1b8f9a,0xa5208316,0xaa982112,0x1024b335,0x92059682,
+0xac2fa313,0xaa2bb331,0x191fb232,0x1c929e0d,0x2a9421a0,0xa19e30b5,0xa286a330,0xa0952222,
+0x23b0329e,0x14a30909,0x971ca821,0x30b0151e,0x23a622a5,0x2fad0a85,0x8224a493,0x0122a20a,
+0xa593900b,0x98a01e26,0x1ba80326,0xa4041a87,0x129f210c,0xad2a8994,0x229d2011,0x93ac33af,
+0x9e20aa2d,0x0d06170e,0x931a0ea4,0xb32e0399,0xa3130a25,0xa3289314,0x34ad1986,0x241193a6,
+0x34ac18a6,0xa42b12ae,0x9e148c90,0xb028a92b,0x9e108327,0x249c0415,0x929329a8,0xa88b2a9b,
+0x84a0231b,0x210d0895,0x26ab2aaa,0x21979189,0x888f9b02,0x2694061c,0xb132a0a3,0x912ead29,
+0xb02b8f9e,0x26950223,0x102103aa,0xa032a994,0xa28f31a9,0x2b929f20,0xa22281a9,0xb335b52f,
+0x05a32321,0x1c831590,0x08a223a6,0xa5912001,0x2ba38229,0x2ea421ac,0xa01f13ac,0x16a9101e,
+0x8121a723,0x22861ea4,0x33b431ac,0xa61203a6,0x2c9c9b28,0x8d169c9a,0x0793100a,0xa4808615,
+0x0395a630,0x1822a925,0x18a625a3,0x16139d07,0x248d21a4,0xb12c94a5,0xa1150624,0x8914a120,
+0xa1219207,0x81911580,0x99968d1b,0xae1e9527,0x170f9022,0x31a10692,0x80279fa9,0x158a23a6,
+0x099d8b89,0x1b9e1019,0x140aa514,0x959a9315,0x0c9ca12f,0x95029724,0xa5251d9a,0x18229988,
+0x0f05a085,0x24a31c8c,0xa51c1ba5,0xa0259109,0x98239e17,0x9f26a71b,0xa5880e0d,0xaa249726,
+0x1caa1723,0x12a4218a,0x281eaa18,0x960904a8,0xaa191d8b,0xa122a129,0x95210e92,0x1ca329a2,
+0x29a89211,0x849b1286,0x9ea12d9d,0x13989328,0x8c22a113,0xa4091b99,0xa6861615,0xa0859e2f,
+0x851ba92c,0x1b929c1a,0x0f958107,0x0b9b1f93,0x0e94168e,0x110a9e12,0x1999148f,0x06060694,
+0x870c0093,0x1293840f,0x8e810986,0x80068d11,0x82008202,0x00008102,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumClap[1104] = {
+0x0200113a,0xd25accd1,0x6fee73d5,0xd847d4e3,0x50d8d362,0x66e9624e,0x412cbcdc,0x424453cb,
+0x57dc45de,0xb2bde557,0xc3443f4e,0xe151d761,0x62dc5012,0x50c554d4,0xdb2362e0,0xbb5adb40,
+0x49a1a050,0x49474ce5,0xca1e53d8,0x3dad2341,0x54dd5dde,0xd34739c1,0x13bf413f,0x47dd4822,
+0xca57d848,0x1da551b7,0xb13d000e,0xc14f10d6,0x33d14f80,0xc4a2bf4c,0xcc4ac34d,0xb047120f,
+0x3028c9ab,0x1f06c041,0x4ac450c1,0x2505ba98,0x93bd51c8,0xb632a327,0x1e24a7ae,0xb2183097,
+0xc8342f23,0x901b43a3,0x3a31b0b8,0x3eb239c1,0x37b13fc7,0xba3c9ea6,0x2cb08425,0x24ba0d31,
+0x2c21b911,0xa630b32c,0x10b81627,0x2da73dad,0xb72e2cbd,0xb4942a2a,0xaa0f9022,0x9f26a93b,
+0x4bd35cb3,0x70f11465,0xf1739ff0,0x6fef5066,0xd8b364e3,0x63d9cd45,0xd15ee421,0x36d74f45,
+0x4a3667d6,0x50a1b4e1,0x5c57dea8,0xe85551e2,0xc744e167,0xb4464198,0xd3cb60d9,0x44c65b4e,
+0x3dadc1dd,0xdc5ce35f,0x35c1649d,0xa45bb6d9,0xd6ac51d4,0xc851de61,0x36d7463b,0x3b47af36,
+0x31acba97,0x57d04ac8,0x30c093b5,0x48d039b2,0x55d54aa9,0x10d10825,0xc8a450b0,0xd149c647,
+0xc145c553,0xce994cc2,0x2a378327,0x1cc23b14,0xbe92352b,0x1118b5a9,0x3ec12734,0x8f8b0439,
+0x4cbc0bb8,0xa24abac1,0x3ea5bb9b,0xb42533b6,0xc91e133a,0x34b52e38,0xbe3933be,0x31b337b0,
+0x81ab1532,0x9d9b26aa,0x3eb41d92,0x0230a89b,0x8fb212a7,0xaa31b43d,0x13bc152c,0x6cc9e127,
+0xfbcb7ce6,0xc0f54e73,0x32f47159,0xea42e071,0xc9506021,0xbf90c868,0x73e55de2,0x9e4b59ed,
+0x5a5ac4f0,0xf069b4d7,0x72e25c3c,0x57ee5ed6,0x56e461aa,0x6de1e85f,0xc16061e4,0xe972b6f1,
+0x5cd654ba,0xb84567df,0x3b41ed44,0x6cdd62dd,0x64ab38eb,0x1054d0d0,0xd660ed58,0xe4c86cbb,
+0x3b93e665,0xdfc7b168,0x6ae1d165,0x6fed5fe1,0xe2d565e7,0xcd5e3259,0xd16354e4,0xe865c8d2,
+0x4f413250,0xac4bc3bb,0xc768c9db,0xbbbe54df,0xc7db61c7,0xe35fb052,0xc8da6ac3,0x39b6d35f,
+0xdc6ae13c,0xe1c24740,0x4c43d261,0x643127e2,0x434593d5,0x8363e325,0xd961d6dc,0xe45457c0,
+0x53ce4f56,0x573de396,0xda3a50db,0xd738584b,0x5db22cd3,0x5144cf2c,0xcd1248e0,0x53ca5ba3,
+0x2d4f22db,0xc5ca51c1,0x3dd25ab7,0x50a057de,0x332b4fdb,0x11cac2ae,0x405bd950,0x60d352d9,
+0xc4dc46c8,0x2f9c415b,0xd05943e0,0x55c2d84f,0x42861b25,0x3acec4a5,0x86a54bd0,0xa64cdd52,
+0x48b24c95,0x203602b4,0x4f8fcccb,0xd05fd10a,0xcc4d44d6,0xe24fa24a,0xd1544406,0xb934501f,
+0xa0b1c925,0x51cf49c7,0xbd54cea7,0xd4164541,0xda144d3f,0xd05db200,0xd61057c6,0x3151bf46,
+0x38c0d79b,0x4ac23f49,0x4a9e37d2,0x55aeb1c3,0x2c5eced2,0xd345cbc2,0x43af3b1b,0x4db8b23e,
+0xc958bbd1,0x59d555cd,0xb13c35cb,0x53b4d545,0x4cd0c73b,0xd64e40c7,0xcea0c659,0x42c05041,
+0x9ad434b4,0xc55386b5,0x319a2fbc,0x4ece4c39,0xc99bbdbc,0x49c5c04a,0xc78b4cc5,0x44b1ce59,
+0xcb3046d1,0xbe571592,0xb196c23f,0x59c638b1,0x2154c0cf,0xc71056d7,0xb054c4bc,0xb93dc047,
+0x53d14005,0xa652c5ca,0x52c43ed0,0xafcc9f96,0x54baab4a,0xcf42bdc1,0x244cd451,0xc61252c0,
+0xcb5117cb,0xbcb7320e,0xc29d223a,0x52d62b57,0xcb202297,0xc2a94e9a,0x83cd3405,0xd433084b,
+0xc13dd655,0x31294d34,0x43d41286,0x54c94dc5,0xd33391af,0xb240c452,0xc059ceb3,0x50ae42ca,
+0xb15cc1d2,0x55d04dd4,0x3b47b6ca,0xc150cfba,0xb8a90a4f,0x4341cb37,0xcfb752d8,0x56cda155,
+0xc4c023c0,0xd0264e2f,0x4a38d44d,0xc256cea4,0xbcb23532,0x304a24c0,0x35c1c391,0xd04acf3a,
+0xa546383f,0xb940c2c1,0xb348db54,0xc9b11d3f,0x0b2ed25a,0x56b283b4,0xd74bc3b5,0xb62b2951,
+0x92bb4ecf,0xbfb7a342,0x32bbc453,0x3e34c53a,0xc230ada3,0xb1b21051,0x51a340d0,0x459f13c0,
+0xd354bfca,0xb545a644,0xcab2b739,0xb3873612,0x37c33b49,0xca3c06c4,0x4fc2924d,0x2abca6ad,
+0xc4c24320,0x32b1bb4e,0x4130a5ae,0xd1bc1917,0xc956d555,0x1f44a621,0xd052d027,0x44c61733,
+0x4db2a7ba,0x23a150cb,0xb71c4ac4,0xb6c450c5,0x432b170f,0x15c33ccf,0x4ba79f3f,0x9e1015d4,
+0xc448a340,0xc54643b7,0x32d150c2,0xa7b69248,0xbda145c1,0x1f0bc84c,0xc0379538,0x55c4860d,
+0x228247cd,0x44cc31ad,0xc99a54c9,0x1042c131,0xd45307cb,0x1ac73b44,0x45bcc247,0xd04d95b8,
+0xbf50c94d,0x8acf50c6,0x54d5244e,0x55c819c5,0xb1c250d2,0xce9ca550,0x4143c343,0x33c83ac0,
+0xc11538ac,0x12c73a31,0x46d03343,0x2120b3c5,0x3ad29253,0xd1268240,0xacb43738,0xb3499128,
+0x3ab232c0,0x409ec432,0x3aa53bcc,0x4591b2a3,0xd352c6a4,0xc441a938,0xc4459497,0xa5151347,
+0xc6c352c2,0x2939cc4d,0xc631b340,0xc843c549,0xac50b41b,0x3a26ba92,0x4838c9a8,0xb8ca39b0,
+0x4221a142,0x1a39c2b0,0xca3732bf,0xb2391230,0xc14e36c3,0x92a2b2b6,0xb726a748,0x1fc8b248,
+0x9dcb4233,0xc9413227,0xad33b441,0x2ea932b7,0x3c1f45be,0x291d42d3,0x1a440ccd,0x29c82a93,
+0xa84b972d,0x9030a8a1,0x334121c5,0x98b536b9,0xa9c151c8,0x49bb2caf,0x34c03a86,0x48c8aa84,
+0x33131ec2,0x3345c932,0xc342abc7,0x42c85080,0xb446c5b8,0xbd438cac,0xaac0469f,0xaa3132a8,
+0x81c2b840,0xc2824339,0x1b24c148,0x02c6aa2c,0xc6480730,0x3c1093ad,0xcc4633c6,0xb03cc34d,
+0xa5cb51c4,0x3bc24436,0x2bb487c2,0xcd40c44c,0x46bba346,0xa813b1b1,0xa4b13d31,0x3b2b99c0,
+0x4cc640ac,0x3daf47d0,0xb0954acc,0xb4a0a131,0xc437c643,0xcc4a0f2e,0x0c3dc648,0x33cd262a,
+0x34a73235,0x47c03ac2,0x3dca4bcf,0xa62da939,0x1cb3339a,0xc28650cb,0xa7a33bb8,0x3a82a042,
+0xbcb248cb,0x15c5bc49,0x02d03d43,0xcb2fa147,0x48ada441,0x8c2bb28e,0x4dcf3db3,0x3b31a5c1,
+0xb8971fb2,0x10c0ae40,0x3db43798,0x972146c0,0x0eb83dc2,0xb1b946b1,0x38359a1d,0x46bac027,
+0x9c44c800,0xba4bc092,0x3616b584,0x301f3db8,0xbb32b1b2,0x45a1c344,0x8929c1b2,0xb64d05b3,
+0xc63838c0,0x439c3020,0x22c031c4,0x48b0c546,0x2e8dc52e,0x2634a302,0x36203bca,0xb1c54dc8,
+0xb532b534,0x31321a34,0x93c331b7,0x36b88e45,0x2ac349c7,0xc98548b8,0x2030b941,0x35b7c03a,
+0xa64dc223,0x8a21b4aa,0x1443c742,0xae9c46c3,0x30b6bb30,0x21b9428a,0xc83e31c1,0x30953283,
+0xad9ba83b,0x93351483,0x2031b1bd,0x40a4c841,0x3cb43fbe,0xb73ba5b4,0x45c53a13,0x86c43cb7,
+0x37911289,0x3b35c430,0xc6a537b7,0x3cbd4133,0x9d28bfb2,0xbeb33634,0xb04ac848,0x209893b0,
+0x41c63c21,0xb130b015,0x3432c62f,0xa339c529,0xb9062eab,0xba1ba142,0xb83b3eab,0x1ac23ab5,
+0xb4451a87,0x40b3b11c,0x48a3a1b3,0x46a5b6a5,0x38a3b887,0x9242acaf,0x23a144c3,0xc13cc28e,
+0x0b121883,0x46c1aa3d,0x44be41c2,0x40b48ab3,0xa4b045c5,0x863bb682,0xa136a69e,0xa39305ad,
+0xb23cbe43,0xb73c20b0,0xbb47bb2d,0xc343c034,0xbdaf2a39,0x949d9944,0x9c0d2dbf,0x9a21c23f,
+0x03c64380,0xa183ba43,0x2932bb38,0x9bb138c1,0x4424c444,0xa22f35c8,0xc039bd36,0x25be4020,
+0xc7100b2c,0xa1be3e33,0xa6af3f07,0x2c8717a7,0x23143ab7,0x41bf29a8,0xba2d21c0,0xb59a8242,
+0x350d03a2,0x1e2832b5,0x2935b6a1,0x9337bdb0,0xb43d2eb8,0x14b49537,0x34ba38b3,0x28042893,
+0x30c1928b,0x3eb6af2c,0x132298b9,0xa1322583,0x9d1788a7,0xa632b93b,0xb026229d,0xb634b325,
+0x92aa4012,0x96ad2db1,0x3f9bb935,0x2a2f85b0,0xa83fbaa8,0xad2ac433,0x9a852228,0x9db22534,
+0xb280a531,0x37bc202f,0x281f8b05,0xc09b8407,0x95a5803b,0xa60a8094,0xb633a83d,0x35c48236,
+0x31b82d19,0x25101ab8,0x20a09ab0,0x20ba8640,0xa5b02290,0xa69f3338,0x37152eb7,0x2ba918b2,
+0xab8b42ba,0x28c335ab,0x34b92632,0x2cac9b26,0x1aa7b415,0x3cc53b09,0x112582b5,0xbd34b730,
+0x32a28a2d,0x378392a3,0x1b052db2,0xa2a2a003,0x0007c33b,0xa910362c,0xa52ebf28,0x30c02f25,
+0x21260db4,0x40c241b5,0xc13412b5,0x833aad33,0x00bc3ab7,0xbc372805,0xbc2d1721,0xa341a31d,
+0xa6269fa7,0x0bbb2e80,0x29c14114,0x0d251183,0xae40bb1a,0xb726b010,0x972ab541,0xb633ad07,
+0xc233b23d,0xb2330702,0x368ab133,0x34bba42a,0x953ebe31,0xa6a7a192,0xa0419409,0x1fad33ad,
+0x16bb42ba,0xb1231405,0x38a6992c,0x35ac33bc,0x21a530b5,0x12299790,0x273209bf,0x22af8987,
+0xb937b30b,0x2f0c9334,0x239a999c,0xa821b088,0x2b1bb43e,0x31ae85b2,0x9e1c2197,0xb59c38a8,
+0x33acb23a,0xae130f88,0x3c8fc037,0x20b032b8,0x34b02080,0xb53cae84,0x1eb541b1,0x23991022,
+0xa5b10d04,0x94122a05,0x2c1a22b6,0xa724199e,0x1c31b213,0xb538b0a0,0x2e15a321,0xbd8b29a5,
+0x36bb0b3f,0x3bb28999,0x1eb116b4,0xbb38b83c,0xb823a734,0x2ca09936,0x35a118b2,0xbc133db4,
+0x1238c039,0x37b0a00b,0x9009b08e,0xa739b72f,0x888e808e,0x261dac17,0x8530af95,0x302ea699,
+0x241b9eb8,0x962a9a1b,0xb8951522,0x94223388,0x1624b393,0xb1119113,0x13ac8125,0x3181a031,
+0x1f0fa98d,0xad99ac20,0x9423b837,0xb48ea337,0x24bb3822,0x36839a95,0xaa329fa6,0x2799b220,
+0xa6b03ca5,0x9d32b236,0xb336b820,0x23ba9a39,0x219ba936,0x33912eb2,0x85a135c0,0x30b42218,
+0x102eb192,0x9521a693,0x1891b22e,0x240ab329,0x95993392,0x341da399,0xa222a792,0x103bb71c,
+0xafa216a1,0x9d1e1914,0x989834ac,0x00138022,0xba109c24,0xb734af36,0x35b01920,0x8110b821,
+0x33b12606,0xab29b01c,0x81a1a82e,0xbd232e1a,0xaa36b438,0xa98a33a0,0x32a6268a,0xb621a800,
+0x8e828825,0x9294b430,0xa53bb334,0xb72f1ba9,0x250d8d2a,0x26aa24b3,0x1c2c08ab,0x1d33b09c,
+0xb635b802,0x23aaa235,0x0da92f91,0x2480ac03,0x8ba6a32d,0x26ae9c32,0x092db033,0xb9341cbc,
+0xa9292014,0x04942da1,0xa3a333ab,0xb11da733,0x2202231f,0xb31023b0,0x37b32921,0x2a0a99a3,
+0xa41e18b1,0x128d2918,0x34a192aa,0x169734b8,0xa12913b4,0x98b03384,0x280d0e02,0x060130b3,
+0x9e2eb08f,0x149e191d,0x8da12988,0x3086ab8f,0x828a83a3,0x0c1ba318,0xa70d36a0,0xab09a227,
+0x90ae892f,0x91080d20,0x842427a0,0xb8161ea5,0x83b21030,0x34b28038,0xa4a024b1,0xaa8fa636,
+0xa11d2b1d,0xa19b871a,0xab31a111,0x0d96b12d,0xb126032a,0x3287b52d,0x8f249e9f,0x1c8aa11d,
+0x26089b86,0x16a610a5,0x9ba5192a,0xb91a1a20,0x2ca72504,0x2612a498,0x1e14b126,0xa715a020,
+0xab9d3091,0x9132b130,0x3296aa19,0x9a9b2ab7,0x35b73411,0xa4a325b0,0x118bab2f,0x9c20af33,
+0x348ea000,0x34b631ac,0xa8a30183,0x2daf0b31,0x13af2eb3,0x92892723,0x28b336b1,0x240a9694,
+0xb00231ac,0xa9a3231d,0xb030a72c,0x22249e25,0x1416a59c,0xa4001ea6,0x2029ab2c,0x97a121a3,
+0x9f83220c,0x2492a00a,0x2b9c16a5,0x22918aa6,0x8a09a82c,0xa294309c,0xaa9a2017,0x301d0692,
+0x0625a4a4,0xa58b8415,0x09139087,0x14299c10,0x2d9b919e,0x281109af,0x3392a29e,0x9e91880e,
+0x2a95ad20,0x9a9f1b8b,0x91a3972d,0x14879723,0x2fa59e22,0x1607a0a5,0xa2a834a0,0x1db10630,
+0x19829220,0xac3485ad,0x31a28312,0x94992aac,0x28a32b94,0x0927a69a,0x970ca489,0xa92dab26,
+0x23a22996,0x9d950520,0xa11dab23,0xb21b9b2e,0x9534a322,0x14258eac,0xa32b0dab,0x10159483,
+0x1797279c,0x31b11a90,0x9397a28a,0x9c970d30,0xaf9732a2,0x08aa300d,0x2b1e859d,0x2686a098,
+0x952313ac,0x8618a411,0xad289500,0x27989724,0x92959c1c,0x932b8d8a,0xa98823a3,0x15aa8b30,
+0x911ca72c,0xa231a701,0x029a8a18,0x239a1ea1,0x07208f91,0xa02802ab,0x33a78421,0x1f9826b1,
+0xa098038a,0x1ba32782,0x2eab2002,0xa9a01f9c,0x9323b031,0x23a12d94,0x1323a89e,0xac2e9e98,
+0x9909a52b,0xa62a8c13,0x8e9831a0,0x1108a48b,0xa0948f29,0xa126ad30,0x070a23a1,0x0031a193,
+0x9b878d84,0x2d9f1295,0x121982a6,0x92951604,0xa41d981e,0x952222a2,0x31a40a98,0x999012ac,
+0xa1902403,0x2aab2910,0xa112129c,0x0519a422,0x98191192,0x141904a2,0x0e2aa400,0x218b89a6,
+0xa42f10a8,0x20a6131d,0x021f21ab,0x9b069486,0x20a39c25,0x238c819f,0x260815a1,0xa02baf03,
+0x11969719,0xa6100f14,0x22b10329,0x2e9e199a,0x1e8aac05,0x0a1ea219,0xac2318a5,0x30a00419,
+0xb01c1eab,0x9520942c,0xa32d90a6,0x8b209d13,0xaa28a820,0x9529a627,0x931026a4,0x1c00969a,
+0xa4239093,0x10ac2b84,0x18a12307,0xaa248997,0xa0279b19,0x9b079527,0x2fa4800d,0x84111bab,
+0x98200e9b,0x930a8516,0x9697130a,0xa41ba424,0x8321a927,0x209b841a,0x1015a090,0x27999e15,
+0x1c11aa07,0x189ba314,0x02a52998,0xa3159922,0xa21b228e,0x1709a323,0x961e1ea2,0x9293188a,
+0x160324a3,0x26a628ab,0x0199a306,0x201e9d22,0xa48d1296,0xa5812d8e,0x09a51a14,0x22aa1c0e,
+0x16938f86,0x9524a10f,0xa019838d,0x139d921f,0x860f0493,0x1c0b991e,0x0c8914a7,0xa91f1590,
+0x18991f09,0x180e9601,0xa01a13a6,0x11ab221b,0x9e139617,0x8a219222,0x250287a6,0x18908da0,
+0x21a51b15,0x8f93a310,0x951b8313,0x0702901d,0x1ca31595,0x8f188000,0x0b171fa2,0x20a323a3,
+0x8d1ca403,0x29a81313,0x9a2180ac,0x9502110e,0x0e90278f,0x9e9a860a,0xa017a229,0x99931614,
+0x87200715,0x942ba982,0xa01d1ea4,0xa425950f,0x1390228f,0x961f9691,0x99039280,0x90988326,
+0x80208487,0x079b1585,0x299e1191,0x130e9389,0x1da623a4,0xa425a102,0x161b0a03,0x161aa198,
+0x0f8e21a4,0x839e1294,0x06201600,0x102005a6,0x208e9d84,0x0d8b84a1,0x9d211a92,0x80a01b91,
+0x8ea7171c,0x8b9a8328,0x11981e96,0x01932894,0x8c961491,0x19a71119,0x22a40511,0x1c889506,
+0x9d169493,0x01a01a14,0x8d218b15,0x8894828e,0x238c9817,0x9d9724a1,0x22a0131b,0x8994829c,
+0x019a1a1a,0x908e1700,0x91258c96,0xa00d088c,0x920b1316,0x8b11900f,0x9b1fa114,0x83951009,
+0xa0198883,0x1900991b,0x21019888,0x13970388,0x8c890793,0x9419a625,0xa2810223,0x8e110812,
+0x19901093,0x12969608,0x0f990816,0xa609229e,0x20910615,0x919725a4,0xa0191992,0x8b011c0f,
+0x25a10484,0x8aa18a86,0x048ca125,0x23a1061c,0x139f219e,0x92929514,0x15a0141f,0x128f1a97,
+0x1995139f,0x228c0f9e,0x0b980799,0x011da323,0x198a1699,0x100e0fa4,0x9f14119b,0x8215098c,
+0x981aa61b,0x8315800b,0x0418a117,0x869b0e88,0xa4268983,0x20950614,0x8a8c20a0,0xa0209d01,
+0x9b982582,0x078e0d11,0x94848508,0x128b021d,0x08009912,0x9697800e,0x02829215,0x11801980,
+0x93229797,0x89a11c89,0xa3860623,0x88091510,0x960b0b00,0x0f838181,0x98258c99,0x209f8014,
+0x84800799,0x83119d17,0x001b8c8a,0x0801139b,0x958b1b95,0x8209921c,0x1790018a,0x04119285,
+0x8a851291,0x80020506,0x8308058c,0x8e0d808b,0x86078101,0x01850502,0x00820180,0x00000080,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumLowTom[1655] = {
+0x020019d7,0x5a47504c,0x605a515a,0x6368655d,0x70706d6a,0x73726e71,0x73737272,0x76797676,
+0x797a7677,0x7b7b777a,0x7c7b797a,0x7c7c7b79,0x797a7979,0x797a7a79,0x7677777a,0x75757877,
+0x72757375,0x6f727073,0x686c6c6e,0x62626668,0x515b5d63,0x48444654,0xc29da92e,0xdbd6d2ca,
+0xe3e1dfdb,0xe9e9e7e4,0xf0eeefec,0xf1f1f2f1,0xf5f3f3f4,0xf7f6f5f5,0xf8f8f8f8,0xf9f9f9f9,
+0xfafafafa,0xfaf9faf9,0xf9f9f9fa,0xf8f8f9fa,0xf6f7f7f8,0xf5f4f5f6,0xf2f3f2f3,0xeef0f0f1,
+0xe7e9ebee,0xe2e4e5e7,0xd5d9dfe0,0xbbcacfd2,0x36320fa9,0x53544e49,0x625e5c5a,0x68666463,
+0x6f6b6a6a,0x7170706f,0x73747372,0x76757574,0x77777676,0x78787877,0x79787979,0x79797979,
+0x79797979,0x77787878,0x76777777,0x74757576,0x72737374,0x70717172,0x6a6d6e6f,0x64666869,
+0x5d606163,0x4f53575a,0x2a384047,0xc7c0b696,0xd9d6d2ce,0xe3e1e0dc,0xe9e7e6e4,0xeeedecea,
+0xf1f1f0ef,0xf4f3f2f2,0xf5f5f4f4,0xf7f6f6f5,0xf7f7f7f7,0xf8f8f8f8,0xf8f8f8f8,0xf8f8f8f8,
+0xf7f7f7f7,0xf6f6f6f6,0xf4f4f5f5,0xf2f2f3f3,0xf0f0f1f1,0xeaecedee,0xe5e6e7e9,0xdde0e2e3,
+0xd1d4d7da,0xb1bfc5cb,0x42392994,0x56524e48,0x605e5b59,0x66656462,0x6c6a6968,0x706f6e6d,
+0x72727171,0x74747373,0x75757574,0x76767676,0x77777777,0x77777777,0x77777777,0x76777777,
+0x75767676,0x74747575,0x72737374,0x70717172,0x6c6e6f70,0x67696a6b,0x62636466,0x585b5e60,
+0x49505355,0x042f3b43,0xc8c2b9aa,0xd8d5d2ce,0xe1e0ddda,0xe7e5e4e3,0xeceae9e8,0xf0efeeed,
+0xf2f1f1f0,0xf3f3f3f2,0xf5f4f4f4,0xf6f5f5f5,0xf6f6f6f6,0xf6f6f6f6,0xf6f6f6f6,0xf6f6f6f6,
+0xf5f5f5f5,0xf3f4f4f4,0xf2f2f3f3,0xf0f0f1f1,0xecedeeef,0xe7e8eaeb,0xe2e3e5e6,0xdadddfe1,
+0xced2d4d7,0xaebac2c8,0x4137278c,0x53514c46,0x5e5c5956,0x64636160,0x69686765,0x6d6c6b6a,
+0x70706f6e,0x72727171,0x73737372,0x74747474,0x75757575,0x75757575,0x76767676,0x75757575,
+0x74757575,0x73747474,0x72727373,0x71717172,0x6e6f7070,0x6a6b6c6d,0x65666768,0x60616364,
+0x56595b5e,0x484d5154,0x16303b42,0xc4beb4a2,0xd4d2cfca,0xdfdcdad7,0xe4e3e2e0,0xe8e7e6e5,
+0xececebe9,0xf0efeeed,0xf1f1f1f0,0xf3f2f2f2,0xf4f3f3f3,0xf4f4f4f4,0xf5f5f5f4,0xf5f5f5f5,
+0xf4f5f5f5,0xf4f4f4f4,0xf3f3f3f4,0xf2f2f2f3,0xf0f1f1f1,0xedeeeff0,0xe9eaebec,0xe5e6e7e8,
+0xe1e2e3e4,0xd8dbdddf,0xcdd1d3d6,0xb2bcc3c8,0x3a30199f,0x504c4742,0x5a585553,0x61605f5c,
+0x66656463,0x6a696867,0x6d6d6c6b,0x70706f6e,0x71717170,0x72727272,0x73737373,0x74747473,
+0x74747474,0x74747474,0x73747474,0x73737373,0x72727272,0x70717171,0x6f6f7070,0x6b6c6d6e,
+0x6768696a,0x63646566,0x5e606162,0x55575a5c,0x484c5053,0x23333d43,0xc0b6aa8d,0xd1cec9c4,
+0xdad8d6d3,0xe1e0dfdc,0xe5e4e3e2,0xe9e8e7e6,0xececebea,0xefefeeed,0xf1f0f0f0,0xf2f2f1f1,
+0xf2f2f2f2,0xf3f3f3f3,0xf3f3f3f3,0xf3f3f3f3,0xf3f3f3f3,0xf2f2f2f3,0xf1f1f2f2,0xf0f0f1f1,
+0xeeefeff0,0xebececed,0xe7e8e9ea,0xe3e4e5e6,0xdfe0e1e2,0xd6d9dbdd,0xccd0d2d4,0xb4bdc3c7,
+0x332581a6,0x4b47423c,0x56545250,0x5f5d5a58,0x63626160,0x67666564,0x6a696868,0x6d6c6c6b,
+0x706f6e6e,0x71707070,0x71717171,0x72727272,0x72727272,0x72727272,0x72727272,0x72727272,
+0x71717172,0x70707171,0x6e6f7070,0x6c6c6d6e,0x69696a6b,0x65666768,0x61626364,0x5b5d5f60,
+0x53555759,0x464a4f51,0x26333c42,0xbbb2a404,0xcecac5c1,0xd7d5d3d1,0xdfdddbd9,0xe3e2e1e0,
+0xe6e5e5e4,0xe9e9e8e7,0xecebebea,0xefeeeded,0xf0f0f0ef,0xf1f1f0f0,0xf1f1f1f1,0xf2f2f1f1,
+0xf2f2f2f2,0xf1f1f2f2,0xf1f1f1f1,0xf0f1f1f1,0xeff0f0f0,0xedeeeeef,0xebebeced,0xe8e9e9ea,
+0xe5e5e6e7,0xe1e2e3e4,0xdbdddfe0,0xd4d6d8da,0xc8ccd0d2,0xb1b9c0c4,0x332607a2,0x4945413b,
+0x5452504d,0x5c5a5856,0x61605f5d,0x64646362,0x67676665,0x6a6a6968,0x6d6c6b6b,0x6f6e6e6d,
+0x70706f6f,0x70707070,0x71717171,0x71717171,0x71717171,0x70717171,0x70707070,0x6f6f7070,
+0x6d6e6e6f,0x6b6b6c6d,0x68696a6a,0x65666768,0x62636465,0x5e606161,0x57595b5d,0x50525455,
+0x4145494d,0x1329343b,0xbdb5ac9a,0xcdcac6c2,0xd6d4d2d0,0xdddbd9d7,0xe1e1e0de,0xe4e4e3e2,
+0xe7e7e6e5,0xeae9e9e8,0xecebebea,0xeeededec,0xefefeeee,0xf0f0f0ef,0xf0f0f0f0,0xf0f0f0f0,
+0xf0f0f0f0,0xf0f0f0f0,0xefeff0f0,0xeeeeeeef,0xececeded,0xeaeaebeb,0xe7e8e8e9,0xe4e5e6e6,
+0xe1e2e3e4,0xdddfe0e1,0xd6d8dadb,0xcfd1d3d4,0xc1c4c8cb,0x95a9b3bb,0x3b342917,0x4b484441,
+0x5453514f,0x5b595856,0x60605e5d,0x63636261,0x66656564,0x68686767,0x6a6a6969,0x6c6c6b6b,
+0x6e6d6d6d,0x6f6e6e6e,0x6f6f6f6f,0x6f6f6f6f,0x6f6f6f6f,0x6f6f6f6f,0x6e6e6e6f,0x6d6d6d6e,
+0x6b6b6c6c,0x696a6a6b,0x67676869,0x64656666,0x62626364,0x5e5f6061,0x58595b5c,0x51535456,
+0x45494c4f,0x30373d42,0xaea00422,0xc5c1bcb5,0xd1cfcbc8,0xd7d5d4d2,0xdddcdad9,0xe1e0e0df,
+0xe4e3e3e2,0xe6e6e5e4,0xe8e8e7e7,0xeaeae9e9,0xecebebeb,0xededecec,0xeeededed,0xeeeeeeee,
+0xeeeeeeee,0xeeeeeeee,0xededeeee,0xecededed,0xebebecec,0xe9eaeaeb,0xe7e8e8e9,0xe5e6e6e7,
+0xe3e3e4e5,0xe0e1e1e2,0xdbdcdedf,0xd5d6d8d9,0xced0d2d3,0xc1c4c7ca,0xa1aeb5bc,0x342c1f84,
+0x4743403b,0x51504d4a,0x57565453,0x5d5c5a59,0x6160605e,0x63636262,0x66656564,0x68676766,
+0x69696868,0x6b6a6a6a,0x6c6b6b6b,0x6c6c6c6c,0x6d6d6d6d,0x6d6d6d6d,0x6d6d6d6d,0x6c6c6c6c,
+0x6b6b6b6c,0x6a6a6a6b,0x68696969,0x66676768,0x64656566,0x62626364,0x5f606161,0x5a5b5d5e,
+0x54565758,0x4d505153,0x4144474a,0x2530363c,0xb1a79611,0xc5c2beb7,0xd0cdcac8,0xd6d4d3d1,
+0xdbdad8d7,0xe0dfdedc,0xe2e2e1e0,0xe4e4e3e3,0xe6e6e5e5,0xe8e7e7e7,0xe9e9e9e8,0xeaeaeaea,
+0xebebebea,0xebebebeb,0xecececec,0xebebecec,0xebebebeb,0xeaeaeaeb,0xe9e9eaea,0xe8e8e8e9,
+0xe6e6e7e7,0xe4e4e5e5,0xe2e2e3e3,0xdfe0e1e1,0xdadcddde,0xd5d7d8d9,0xd0d1d2d4,0xc5c7cacd,
+0xb2b8bec2,0x20039daa,0x3f39332b,0x4a484542,0x5251504d,0x58565554,0x5d5b5a59,0x60605f5e,
+0x63626161,0x64646463,0x66666565,0x68676766,0x69686868,0x6a696969,0x6a6a6a6a,0x6a6a6a6a,
+0x6a6a6a6a,0x6a6a6a6a,0x696a6a6a,0x68696969,0x67686868,0x66666767,0x64656565,0x62636364,
+0x60616162,0x5c5d5f60,0x57595a5b,0x52545556,0x4b4d5051,0x40434548,0x2530353b,0xaea39015,
+0xc2bfbab4,0xcdcac7c5,0xd3d2d1cf,0xd8d7d6d4,0xdddcdad9,0xe0e0dfde,0xe2e2e1e1,0xe4e4e3e3,
+0xe5e5e5e4,0xe7e6e6e6,0xe8e8e7e7,0xe9e8e8e8,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,0xe9e9e9e9,
+0xe8e8e8e9,0xe7e7e8e8,0xe6e6e7e7,0xe5e5e5e6,0xe3e3e4e4,0xe1e2e2e3,0xdfe0e0e1,0xdbdcddde,
+0xd6d7d8d9,0xd1d2d4d5,0xc9cbced0,0xbdc1c3c6,0xa1acb3b8,0x2f25168d,0x423f3a35,0x4c494744,
+0x5351504e,0x57565554,0x5c5a5958,0x605f5e5d,0x61616160,0x63636262,0x65646463,0x66656565,
+0x67666666,0x67676767,0x68686868,0x68686868,0x68686868,0x68686868,0x67676768,0x66666767,
+0x65656666,0x64646565,0x62636363,0x61616262,0x5e5f6060,0x5a5b5c5d,0x56575859,0x51525354,
+0x494b4e50,0x3f424447,0x2730353a,0xa79c801b,0xbfbab5b0,0xc9c6c4c2,0xd1d0cecb,0xd5d4d3d2,
+0xd9d8d7d6,0xdddcdbda,0xe0e0dfde,0xe2e1e1e1,0xe3e3e3e2,0xe4e4e4e4,0xe5e5e5e5,0xe6e6e6e6,
+0xe7e7e6e6,0xe7e7e7e7,0xe7e7e7e7,0xe7e7e7e7,0xe6e6e6e7,0xe5e6e6e6,0xe5e5e5e5,0xe3e4e4e4,
+0xe2e2e3e3,0xe0e1e1e2,0xdedfe0e0,0xdadbdcdd,0xd6d7d8d9,0xd2d3d4d5,0xcbcdd0d1,0xc2c4c7c9,
+0xb2b7bbc0,0x1092a2ab,0x36322b21,0x4442403b,0x4d4b4946,0x5351504f,0x57565554,0x5a5a5958,
+0x5e5d5c5b,0x6060605f,0x62616161,0x63636262,0x64646463,0x65656464,0x65656565,0x66666666,
+0x66666666,0x66666666,0x65666666,0x65656565,0x64646565,0x63636464,0x62626363,0x61616162,
+0x5e5f6060,0x5b5c5d5e,0x5758595a,0x53545556,0x4f505152,0x46484b4d,0x3c404244,0x242d3337,
+0xa69b8317,0xbcb8b4af,0xc7c4c2c0,0xcfcdcbc9,0xd3d2d1d0,0xd7d6d5d4,0xdbdad9d8,0xdedddcdb,
+0xe0e0dfdf,0xe1e1e1e0,0xe3e2e2e2,0xe3e3e3e3,0xe4e4e4e4,0xe5e5e4e4,0xe5e5e5e5,0xe5e5e5e5,
+0xe5e5e5e5,0xe4e4e5e5,0xe4e4e4e4,0xe3e3e3e4,0xe2e2e2e3,0xe1e1e1e2,0xdfe0e0e0,0xdcdddede,
+0xd9dadbdb,0xd5d6d7d8,0xd1d2d3d4,0xcbcecfd0,0xc3c5c7c9,0xb6bbbfc1,0x98a4adb2,0x2d241900,
+0x3f3b3732,0x47454341,0x4f4d4b49,0x53525150,0x57565554,0x5a595858,0x5d5c5c5b,0x605f5e5e,
+0x61616060,0x62626161,0x63626262,0x63636363,0x64646463,0x64646464,0x64646464,0x64646464,
+0x63636464,0x63636363,0x62626263,0x61616162,0x60606061,0x5d5e5f5f,0x5b5b5c5d,0x5758595a,
+0x54555657,0x50515253,0x4a4c4d4f,0x42444648,0x34383c40,0x14222a30,0xada59c88,0xbebab6b2,
+0xc7c5c3c1,0xcecccac8,0xd2d1d1d0,0xd6d5d4d3,0xd9d8d7d7,0xdcdbdada,0xdededddc,0xe0e0dfdf,
+0xe1e1e1e0,0xe2e2e1e1,0xe2e2e2e2,0xe3e3e3e3,0xe3e3e3e3,0xe3e3e3e3,0xe3e3e3e3,0xe2e3e3e3,
+0xe2e2e2e2,0xe1e1e2e2,0xe0e0e1e1,0xdfdfe0e0,0xdcdddede,0xdadadbdc,0xd7d7d8d9,0xd3d4d5d6,
+0xd0d1d2d2,0xc9cbcdce,0xc2c4c5c7,0xb5b9bcc0,0x98a4abb1,0x29221583,0x3b383430,0x4543413f,
+0x4c4a4847,0x51504f4e,0x54545352,0x57575655,0x5a595958,0x5d5c5b5b,0x5f5e5e5d,0x6060605f,
+0x61616060,0x61616161,0x62626262,0x62626262,0x62626262,0x62626262,0x62626262,0x61616162,
+0x60616161,0x60606060,0x5e5e5f5f,0x5b5c5d5d,0x595a5a5b,0x56575858,0x53545555,0x50515152,
+0x494b4d4e,0x42444648,0x373b3e41,0x22293034,0xa2950116,0xb7b3b0a9,0xc2c0beba,0xc9c7c6c4,
+0xd0cecccb,0xd3d2d1d0,0xd6d5d4d3,0xd8d8d7d6,0xdbdadad9,0xdddcdcdb,0xdfdededd,0xe0e0e0df,
+0xe0e0e0e0,0xe1e1e1e1,0xe1e1e1e1,0xe1e1e1e1,0xe1e1e1e1,0xe1e1e1e1,0xe1e1e1e1,0xe0e0e0e0,
+0xdfdfe0e0,0xdddedede,0xdbdbdcdd,0xd9d9dada,0xd6d7d7d8,0xd3d4d5d5,0xd0d1d2d2,0xcacccecf,
+0xc4c6c7c9,0xbbbec1c2,0xabb1b4b8,0x0f8c9ba4,0x312c251d,0x3e3b3834,0x46444241,0x4c4a4947,
+0x51504f4d,0x54535251,0x56565554,0x59585757,0x5b5a5a59,0x5d5c5c5b,0x5e5e5d5d,0x605f5f5f,
+0x60606060,0x60606060,0x60606060,0x60606060,0x60606060,0x60606060,0x5f606060,0x5e5e5f5f,
+0x5c5d5d5e,0x5b5b5c5c,0x58595a5a,0x56575758,0x53545555,0x51515253,0x4c4e4f50,0x4647494b,
+0x40414344,0x3336393c,0x19232930,0xa59e9108,0xb7b4b1ab,0xc2c0bdba,0xc8c6c5c3,0xcecccbc9,
+0xd1d1d0cf,0xd4d3d3d2,0xd6d6d5d5,0xd9d8d7d7,0xdadadad9,0xdcdcdbdb,0xdddddddc,0xdfdedede,
+0xdfdfdfdf,0xe0e0e0df,0xe0e0e0e0,0xe0e0e0e0,0xdfdfe0e0,0xdedfdfdf,0xdddedede,0xdcdcdddd,
+0xdadbdbdc,0xd8d9d9da,0xd6d7d7d8,0xd4d5d5d6,0xd1d2d3d3,0xcecfd0d1,0xc8cacbcc,0xc2c4c5c7,
+0xb9bcbfc1,0xaab0b3b6,0x0a8e9ba3,0x2f292219,0x3b383532,0x4342403e,0x49484645,0x4f4d4c4a,
+0x52515050,0x54535352,0x56565555,0x58585757,0x5a595959,0x5b5b5b5a,0x5d5c5c5c,0x5d5d5d5d,
+0x5e5e5e5e,0x5e5e5e5e,0x5e5e5e5e,0x5e5e5e5e,0x5e5e5e5e,0x5d5d5d5d,0x5c5c5c5c,0x5a5a5b5b,
+0x5859595a,0x57575858,0x54555656,0x52535354,0x50505152,0x4b4c4d4f,0x45464849,0x3f414244,
+0x34373a3c,0x21262c31,0x9d910416,0xb2b0aaa4,0xbebbb8b5,0xc4c3c2c0,0xcac8c7c6,0xcfcecccb,
+0xd2d1d0d0,0xd4d3d3d2,0xd6d5d5d4,0xd8d7d7d6,0xd9d9d8d8,0xdadadad9,0xdbdbdbdb,0xdcdcdcdc,
+0xdddddddc,0xdddddddd,0xdddddddd,0xdddddddd,0xdcdcdcdc,0xdbdbdcdc,0xdadadadb,0xd8d9d9da,
+0xd7d7d8d8,0xd5d5d6d6,0xd3d3d4d4,0xd1d1d2d2,0xcdcecfd0,0xc8c9cbcc,0xc3c4c5c7,0xbbbec0c1,
+0xb0b3b6b8,0x95a0a5ab,0x231c1183,0x34322e29,0x3f3d3a37,0x45434241,0x4a484746,0x4f4d4c4b,
+0x51515050,0x53535252,0x55555454,0x57565656,0x58585857,0x59595959,0x5a5a5a5a,0x5b5b5b5b,
+0x5b5b5b5b,0x5c5c5c5c,0x5c5c5c5c,0x5b5b5b5b,0x5a5b5b5b,0x5a5a5a5a,0x58595959,0x57575858,
+0x55565657,0x54545555,0x52525353,0x4f505151,0x4b4c4d4e,0x4647484a,0x41424345,0x383a3d40,
+0x2b303335,0x08172026,0xa7a1988c,0xb6b3b0ac,0xc0bdbbb8,0xc5c3c2c1,0xc9c8c7c6,0xcecdcccb,
+0xd1d0d0cf,0xd3d2d2d1,0xd4d4d4d3,0xd6d6d5d5,0xd7d7d7d6,0xd8d8d8d8,0xd9d9d9d9,0xdadadad9,
+0xdadadada,0xdadadada,0xdadadada,0xdadadada,0xd9d9d9da,0xd8d8d9d9,0xd7d7d8d8,0xd6d6d6d7,
+0xd4d5d5d5,0xd2d3d3d4,0xd0d1d1d2,0xcdcecfd0,0xc9cacbcc,0xc4c5c7c8,0xbfc1c2c3,0xb6b8babd,
+0xa7acb0b3,0x01919ba2,0x28231c12,0x3633312d,0x3f3d3b38,0x44434241,0x49484645,0x4d4c4b4a,
+0x50504f4e,0x52525151,0x54535352,0x55555454,0x56565655,0x57575757,0x58585858,0x59595858,
+0x59595959,0x59595959,0x59595959,0x59595959,0x58585858,0x57575758,0x56565657,0x55555556,
+0x53535454,0x51525253,0x50505151,0x4c4d4e4f,0x47494a4b,0x43444546,0x3d404142,0x3436393b,
+0x252a2f32,0x860d1820,0xa8a39e94,0xb5b3b1ad,0xbfbcbab8,0xc4c2c1c0,0xc8c7c6c5,0xcccbcac9,
+0xd0cfcecd,0xd1d1d0d0,0xd3d2d2d2,0xd4d4d4d3,0xd5d5d5d4,0xd6d6d6d6,0xd7d7d7d7,0xd8d7d7d7,
+0xd8d8d8d8,0xd8d8d8d8,0xd8d8d8d8,0xd7d7d8d8,0xd7d7d7d7,0xd6d6d6d7,0xd5d5d5d6,0xd4d4d4d5,
+0xd2d3d3d3,0xd1d1d1d2,0xcecfd0d0,0xcacbcccd,0xc6c7c8c9,0xc2c3c4c5,0xbcbec0c1,0xb3b5b7ba,
+0xa4a9adb1,0x068b97a0,0x27231d14,0x3432302c,0x3d3b3937,0x4342413f,0x47464544,0x4b4a4948,
+0x4e4d4c4b,0x5050504f,0x52525151,0x53535352,0x54545454,0x55555555,0x56565655,0x56565656,
+0x57575757,0x57575757,0x57575757,0x56565657,0x56565656,0x55555555,0x54545455,0x53535354,
+0x51525252,0x50505151,0x4d4e4e4f,0x494a4b4c,0x45464748,0x41424344,0x3b3d3f40,0x32353739,
+0x24282d30,0x830d1720,0xa6a19b92,0xb3b1aeaa,0xbcbab7b5,0xc2c1c0be,0xc5c5c4c3,0xc9c8c7c6,
+0xcdcccbca,0xd0cfcecd,0xd1d1d0d0,0xd2d2d2d1,0xd3d3d3d3,0xd4d4d4d4,0xd5d5d5d4,0xd5d5d5d5,
+0xd6d6d6d5,0xd6d6d6d6,0xd6d6d6d6,0xd5d5d5d5,0xd5d5d5d5,0xd4d4d4d5,0xd3d3d3d4,0xd2d2d2d3,
+0xd1d1d1d2,0xcfd0d0d0,0xcccdcdce,0xc8c9cacb,0xc5c6c7c7,0xc1c2c3c4,0xbabcbec0,0xb2b4b6b8,
+0xa5a9adb0,0x819199a0,0x241f170e,0x32302c28,0x3a383634,0x40403e3c,0x44434241,0x48474645,
+0x4b4a4949,0x4e4d4c4c,0x50504f4f,0x51515150,0x52525252,0x53535353,0x54545453,0x54545454,
+0x55555454,0x55555555,0x55555555,0x54545455,0x54545454,0x53535354,0x52525353,0x51515252,
+0x50505151,0x4e4e4f50,0x4b4c4c4d,0x4848494a,0x44454647,0x41414243,0x3a3c3e40,0x32343638,
+0x262a2d30,0x09141c22,0xa19b9386,0xb0ada9a5,0xb8b6b4b2,0xbfbdbbba,0xc3c2c1c0,0xc6c5c5c4,
+0xc9c9c8c7,0xcccccbca,0xcfcececd,0xd0d0d0cf,0xd1d1d1d1,0xd2d2d2d2,0xd3d3d3d2,0xd3d3d3d3,
+0xd4d4d3d3,0xd4d4d4d4,0xd4d4d4d4,0xd3d3d4d4,0xd3d3d3d3,0xd2d2d3d3,0xd1d2d2d2,0xd0d1d1d1,
+0xcfd0d0d0,0xcdcdcecf,0xcacbcbcc,0xc7c8c8c9,0xc4c4c5c6,0xc0c1c2c3,0xbabcbebf,0xb3b5b6b8,
+0xa7abaeb1,0x90989fa3,0x1d150c82,0x2d292622,0x35343230,0x3d3b3937,0x4141403e,0x45444342,
+0x48474645,0x4a4a4948,0x4d4c4c4b,0x4f4f4e4e,0x50505050,0x51515151,0x52525251,0x52525252,
+0x53535252,0x53535353,0x53535353,0x52535353,0x52525252,0x52525252,0x51515151,0x50505051,
+0x4e4f4f50,0x4c4c4d4e,0x494a4b4b,0x46474849,0x43444546,0x40414243,0x3a3c3d3f,0x33353738,
+0x292c3031,0x151c2225,0x968f810d,0xa9a6a29e,0xb3b2b0ad,0xbab8b7b5,0xc0bfbdbc,0xc3c2c2c1,
+0xc6c5c5c4,0xc9c8c7c7,0xcbcbcac9,0xcdcdcccc,0xcfcfcece,0xd0d0d0d0,0xd1d1d1d0,0xd1d1d1d1,
+0xd2d2d2d1,0xd2d2d2d2,0xd2d2d2d2,0xd2d2d2d2,0xd1d1d2d2,0xd1d1d1d1,0xd0d0d0d1,0xcfd0d0d0,
+0xcdcececf,0xcbcccccd,0xc9c9caca,0xc6c7c7c8,0xc3c4c4c5,0xc0c1c2c2,0xbabcbdbf,0xb4b5b7b9,
+0xaaaeb0b2,0x9aa0a4a7,0x10038a93,0x25221e17,0x312f2c29,0x38363433,0x3e3c3b39,0x4241403f,
+0x44444342,0x47464645,0x49494848,0x4c4b4b4a,0x4d4d4d4c,0x4f4f4e4e,0x5050504f,0x50505050,
+0x51515151,0x51515151,0x51515151,0x51515151,0x51515151,0x50505050,0x50505050,0x4e4e4f4f,
+0x4c4d4d4e,0x4a4b4b4c,0x4849494a,0x45464747,0x43434445,0x40414142,0x3a3c3d3f,0x34363739,
+0x2c2f3133,0x1f232629,0x84081219,0xa19d9790,0xaeaba8a5,0xb5b4b2b0,0xbbbab8b7,0xc0bfbebd,
+0xc3c2c2c1,0xc5c5c4c4,0xc8c7c7c6,0xcac9c9c8,0xcccbcbca,0xcdcdcdcc,0xcfcecece,0xd0cfcfcf,
+0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,0xd0d0d0d0,0xcfd0d0d0,0xcecfcfcf,0xcdcdcece,
+0xcbcccccd,0xc9cacacb,0xc7c8c8c9,0xc5c6c6c7,0xc3c3c4c4,0xc0c1c1c2,0xbbbcbebf,0xb5b6b8b9,
+0xaeb0b2b3,0xa2a5a8ab,0x8892989e,0x1c161003,0x2a272421,0x3331302d,0x38373634,0x3e3d3b3a,
+0x4141403f,0x44434342,0x46464544,0x48484747,0x4a4a4949,0x4c4b4b4a,0x4d4d4c4c,0x4e4e4d4d,
+0x4f4f4e4e,0x4f4f4f4f,0x4f4f4f4f,0x4f4f4f4f,0x4f4f4f4f,0x4e4e4f4f,0x4d4e4e4e,0x4c4c4d4d,
+0x4b4b4b4c,0x49494a4a,0x47474848,0x45454646,0x42434444,0x40404142,0x3b3c3e3f,0x3537383a,
+0x30313334,0x24272a2d,0x12181e22,0x958e8209,0xa6a3a09a,0xb0aeaba9,0xb6b4b3b2,0xbbbab9b7,
+0xc0bfbebc,0xc2c2c1c0,0xc4c4c3c3,0xc7c6c6c5,0xc8c8c7c7,0xcacac9c9,0xcbcbcbca,0xcccccccc,
+0xcdcdcdcd,0xcececdcd,0xcececece,0xcececece,0xcececece,0xcdcdcdcd,0xcccccdcd,0xcbcbcccc,
+0xcacacacb,0xc8c9c9c9,0xc6c7c7c8,0xc4c5c5c6,0xc2c3c3c4,0xc0c0c1c2,0xbbbcbebf,0xb6b7b9ba,
+0xb1b2b3b5,0xa7aaacaf,0x989ea1a4,0x0b008a92,0x221e1913,0x2d2a2724,0x3332312f,0x38373635,
+0x3d3c3b3a,0x4140403f,0x43424241,0x45444443,0x47464645,0x48484747,0x4a494949,0x4b4a4a4a,
+0x4c4b4b4b,0x4c4c4c4c,0x4c4c4c4c,0x4c4d4d4c,0x4c4c4c4c,0x4c4c4c4c,0x4b4b4b4c,0x4a4a4b4b,
+0x49494a4a,0x47484849,0x46464747,0x44444545,0x42424343,0x40404141,0x3b3d3e3f,0x3738393a,
+0x31333435,0x292c2e30,0x1e212426,0x010c1318,0x9c979189,0xa8a6a3a0,0xb1b0adab,0xb6b5b3b2,
+0xbbbab8b7,0xbfbebdbc,0xc1c1c0c0,0xc3c3c2c2,0xc5c5c4c4,0xc7c6c6c6,0xc8c8c7c7,0xc9c9c9c8,
+0xcacacac9,0xcbcbcaca,0xcbcbcbcb,0xcbcbcbcb,0xcbcbcbcb,0xcbcbcbcb,0xcacacacb,0xc9c9caca,
+0xc8c8c9c9,0xc7c7c8c8,0xc5c6c6c6,0xc4c4c5c5,0xc2c2c3c3,0xc0c0c1c1,0xbcbdbebf,0xb7b8b9ba,
+0xb2b3b5b6,0xabaeb0b1,0xa1a4a6a9,0x8e94999e,0x150f0584,0x24221f1a,0x2e2b2927,0x33323130,
+0x38373635,0x3c3b3a39,0x40403e3d,0x42414140,0x44434342,0x45454444,0x47464646,0x48474747,
+0x49484848,0x49494949,0x4a4a4949,0x4a4a4a4a,0x4a4a4a4a,0x4a4a4a4a,0x49494949,0x48494949,
+0x47484848,0x46474747,0x45454646,0x43444444,0x42424243,0x40404141,0x3c3d3e3f,0x37393a3b,
+0x33343536,0x2d303132,0x2426282b,0x151a1e21,0x8c820710,0xa09c9792,0xaaa7a5a2,0xb1b0aeac,
+0xb6b4b3b2,0xbab9b8b7,0xbebdbcbb,0xc0c0c0bf,0xc2c2c1c1,0xc4c3c3c3,0xc5c5c4c4,0xc6c6c6c5,
+0xc7c7c7c6,0xc8c8c8c7,0xc8c8c8c8,0xc9c9c9c8,0xc9c9c9c9,0xc8c9c9c9,0xc8c8c8c8,0xc7c8c8c8,
+0xc7c7c7c7,0xc6c6c6c6,0xc4c5c5c5,0xc3c3c4c4,0xc1c2c2c3,0xc0c0c0c1,0xbcbdbebf,0xb8b9babb,
+0xb4b5b6b7,0xafb0b1b3,0xa6a8abad,0x9a9fa2a4,0x818a9196,0x19151008,0x2523211e,0x2e2c2a28,
+0x33323130,0x37363534,0x3b3a3938,0x3f3e3d3c,0x41404040,0x42424241,0x44434343,0x45454444,
+0x46464545,0x47464646,0x47474747,0x47474747,0x48484847,0x47474848,0x47474747,0x47474747,
+0x46464646,0x45454546,0x44444445,0x43434343,0x41414242,0x3f404041,0x3c3d3e3f,0x38393a3b,
+0x34353637,0x30313233,0x282a2c2f,0x20222426,0x0d12171b,0x928d8404,0xa29f9b97,0xaaa8a6a4,
+0xb1b0aeac,0xb5b4b3b2,0xb9b8b7b6,0xbcbbbaba,0xbfbfbebd,0xc1c1c0c0,0xc2c2c2c1,0xc3c3c3c3,
+0xc4c4c4c4,0xc5c5c5c5,0xc6c6c6c5,0xc6c6c6c6,0xc6c6c6c6,0xc6c6c6c6,0xc6c6c6c6,0xc6c6c6c6,
+0xc5c5c5c6,0xc4c5c5c5,0xc3c4c4c4,0xc2c2c3c3,0xc1c1c1c2,0xbfc0c0c0,0xbcbdbdbe,0xb8b9babb,
+0xb5b6b7b7,0xb1b2b3b4,0xaaacaeb0,0xa2a4a6a8,0x94989ca0,0x08008790,0x1c181410,0x26242220,
+0x2e2c2a28,0x33323130,0x36353434,0x3a393837,0x3d3c3b3b,0x403f3e3e,0x41414040,0x42424241,
+0x43434342,0x44444443,0x45454444,0x45454545,0x45454545,0x45454545,0x45454545,0x45454545,
+0x44454545,0x44444444,0x43434343,0x42424243,0x40414141,0x3f3f4040,0x3c3c3d3e,0x38393a3b,
+0x35363738,0x31323334,0x2c2e3030,0x2426282a,0x191d2022,0x030b1115,0x96928c84,0xa2a09e9a,
+0xaaa8a6a4,0xb0b0aeac,0xb4b3b2b1,0xb7b7b6b5,0xbbbab9b8,0xbdbdbcbb,0xc0bfbfbe,0xc1c1c0c0,
+0xc2c2c1c1,0xc3c3c2c2,0xc3c3c3c3,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,0xc4c4c4c4,
+0xc4c4c4c4,0xc3c3c3c3,0xc2c2c3c3,0xc1c2c2c2,0xc0c0c1c1,0xbebfc0c0,0xbcbcbdbe,0xb9b9babb,
+0xb5b6b7b8,0xb2b3b4b5,0xadafb0b1,0xa6a8aaac,0x9ea0a2a4,0x8e92969a,0x0f080086,0x1e1b1713,
+0x26242321,0x2d2c2a28,0x3231302f,0x35343433,0x38373736,0x3b3a3a39,0x3e3d3c3c,0x403f3f3e,
+0x41414040,0x42414141,0x42424242,0x43434343,0x43434343,0x43434343,0x43434343,0x43434343,
+0x43434343,0x42434343,0x42424242,0x41414141,0x40404041,0x3e3e3f40,0x3b3c3d3d,0x39393a3b,
+0x36363738,0x32333435,0x2f303132,0x282a2b2d,0x21232426,0x14171b1e,0x84030a10,0x9794908b,
+0xa19f9c9a,0xa5a4a3a2,0xa9a8a7a6,0xababaaa9,0xadacacac,0xadadadad,0xadadadad,0xabacacac,
+0xa9aaaaab,0xa7a7a8a9,0xa3a4a5a6,0x9fa0a1a2,0x97999b9d,0x8d909395,0x00008489,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumHighTom[1379] = {
+0x02001588,0x59555538,0x69636361,0x706d6c6b,0x75747371,0x7a797477,0x7c7a7a78,0x7c7a7c7c,
+0x7b7a7c79,0x76797b78,0x75767875,0x716f7174,0x67686d70,0x5457595f,0x22a53b54,0xd9d5c4ca,
+0xe6e6e3e0,0xeff0efeb,0xf3f5f3f2,0xf7f6f5f6,0xf9f9f9f8,0xf9f9f9fa,0xf8f8f9fb,0xf8f7f8f9,
+0xf4f5f5f6,0xefeff1f2,0xe5e9e9ec,0xd8dcdfe2,0x8d94cbce,0x5a515048,0x66646060,0x6f6e6d6b,
+0x74737271,0x76767575,0x79787877,0x79797a7a,0x78797979,0x77787878,0x73757576,0x70707272,
+0x68686c6f,0x5a5c6163,0x1a434c53,0xd3d0bcb5,0xe4e1dfd7,0xeeebe8e7,0xf3f2f0ef,0xf6f5f4f3,
+0xf7f7f7f6,0xf8f8f8f8,0xf8f9f9f8,0xf7f7f7f8,0xf4f5f6f6,0xf0f2f2f4,0xeaebeeef,0xdee2e4e7,
+0xc3d0d6d9,0x453689b2,0x605a5652,0x69666463,0x716f6d6c,0x74737272,0x76767575,0x78787776,
+0x78787878,0x77777778,0x75767677,0x72737474,0x6d6f7071,0x6466696b,0x54595f61,0x02344450,
+0xd4cfc5b6,0xe3e1ddd9,0xedeae8e6,0xf2f1f0ee,0xf5f4f3f2,0xf6f6f6f5,0xf7f7f7f7,0xf7f7f7f7,
+0xf6f6f6f7,0xf3f4f5f5,0xf0f1f2f3,0xe9ebedef,0xe0e2e5e7,0xcbd3d7dc,0x3c1ab2c3,0x5a555047,
+0x6564615e,0x6e6c6a68,0x7271706f,0x74747373,0x76767575,0x77777676,0x76767777,0x75757676,
+0x72737474,0x6f707172,0x67696b6d,0x5d616365,0x454e5458,0xc3b21037,0xdbd7d2cc,0xe6e4e2e0,
+0xeeeceae8,0xf2f1f0f0,0xf4f4f3f2,0xf6f5f5f5,0xf6f6f6f6,0xf6f6f6f6,0xf4f5f5f5,0xf2f2f3f3,
+0xeeeff0f1,0xe6e8eaec,0xdce0e2e4,0xc4cdd3d7,0x42328cb6,0x5b56524b,0x6563615f,0x6d6b6967,
+0x7170706e,0x73737272,0x75757474,0x75757575,0x75757575,0x74747475,0x71727373,0x6e6f7071,
+0x66686a6c,0x5d606264,0x48505559,0xb99c2b3f,0xd7d3cec5,0xe3e2e0db,0xebe9e7e5,0xf0f0eeec,
+0xf3f2f1f1,0xf4f4f3f3,0xf5f5f5f4,0xf5f5f5f5,0xf3f4f4f4,0xf2f2f3f3,0xeef0f0f1,0xe8e9ebed,
+0xe0e2e4e6,0xd0d5d9dd,0x12b0c0c9,0x524b4335,0x615e5a56,0x68666463,0x6e6d6b6a,0x71717070,
+0x73737272,0x74747473,0x74747474,0x73747474,0x72727373,0x70707171,0x6a6b6d6e,0x63656668,
+0x575b5e61,0x3b454e53,0xc5b9a226,0xdad6d2cd,0xe4e2e1de,0xebe9e8e6,0xf0efeeec,0xf2f1f1f0,
+0xf3f3f3f2,0xf4f4f4f3,0xf3f4f4f4,0xf2f3f3f3,0xf0f1f1f2,0xeceeeff0,0xe6e8e9eb,0xdee1e3e4,
+0xcfd3d7db,0x13adbec7,0x504a4234,0x5f5c5854,0x66656361,0x6c6b6968,0x70706f6e,0x72727171,
+0x73737372,0x73737373,0x72737373,0x71727272,0x6f707071,0x696b6c6e,0x63656668,0x595d6062,
+0x444c5255,0xb7a0263a,0xd4d1cac3,0xe1dfdcd8,0xe7e6e4e3,0xedeceae9,0xf0f0efee,0xf2f1f1f1,
+0xf2f2f2f2,0xf2f3f3f3,0xf2f2f2f2,0xf0f1f1f1,0xedeeeff0,0xe8e9eaec,0xe1e3e5e6,0xd6d9dde0,
+0xbec6cdd2,0x40320bae,0x56534e47,0x62605d5a,0x68666563,0x6d6b6a69,0x70706f6e,0x71717170,
+0x72727272,0x72727272,0x71717272,0x70707071,0x6c6d6e6f,0x6668696a,0x60626465,0x54575b5e,
+0x3a444b51,0xc1b49927,0xd6d3cfc8,0xe1e0ddd9,0xe7e6e4e3,0xecebeae8,0xf0efeeed,0xf1f1f0f0,
+0xf1f1f1f1,0xf1f1f1f1,0xf1f1f1f1,0xeff0f0f0,0xebecedee,0xe6e7e9ea,0xe0e2e3e5,0xd4d8dbde,
+0xbdc5ccd1,0x3d3002ae,0x54514c45,0x605e5b58,0x66646362,0x6b696867,0x6e6e6d6c,0x7070706f,
+0x71717170,0x71717171,0x70707171,0x6f6f7070,0x6b6c6d6e,0x6667696a,0x61626465,0x56595c5f,
+0x42494f53,0xb2972638,0xd1cdc6c0,0xdedbd8d4,0xe4e3e1e0,0xe9e8e7e5,0xedecebea,0xf0efeeee,
+0xf0f0f0f0,0xf0f0f0f0,0xf0f0f0f0,0xeeeff0f0,0xebecedee,0xe7e8e9ea,0xe2e3e4e6,0xd9dcdfe0,
+0xc9d0d3d6,0x0aaabac3,0x4a443c30,0x59565350,0x62615f5c,0x67666463,0x6b6a6968,0x6e6d6c6c,
+0x706f6f6e,0x70707070,0x70707070,0x6e6f6f70,0x6c6c6d6e,0x68696a6b,0x63646667,0x5c5f6162,
+0x5154575a,0x3440464c,0xc0b4a020,0xd4d1ccc6,0xdfdcd9d6,0xe4e3e2e0,0xe8e7e6e5,0xecebeae9,
+0xeeeeedec,0xefefefef,0xefeff0ef,0xeeefefef,0xecededee,0xe9eaebeb,0xe5e6e7e8,0xe0e1e3e4,
+0xd6d9dbde,0xc5cbd0d3,0x1ea0b4bf,0x4b453f33,0x58565350,0x61605e5b,0x66656362,0x69686867,
+0x6c6c6b6a,0x6e6e6d6d,0x6f6e6e6e,0x6e6e6e6f,0x6d6d6e6e,0x6a6b6c6c,0x67686969,0x62646566,
+0x5c5e6061,0x51545659,0x3841474d,0xb9ac8529,0xd1cdc8c2,0xdcd9d6d4,0xe2e1e0de,0xe6e5e4e3,
+0xeae9e8e7,0xececebea,0xedededec,0xeeeeeeee,0xedededee,0xebececed,0xe8e9eaea,0xe5e6e7e8,
+0xe0e2e3e4,0xd8dadddf,0xcbd0d2d5,0xa4b5c0c5,0x423a2f13,0x54514d48,0x5e5b5956,0x63626160,
+0x67666564,0x6a696867,0x6c6b6b6a,0x6d6c6c6c,0x6d6d6d6d,0x6c6c6c6c,0x6a6a6b6b,0x67686869,
+0x63646566,0x5e606162,0x55575a5c,0x454a5052,0x89263640,0xc6c1b8ab,0xd5d3d0cb,0xdedcdad7,
+0xe3e2e1e0,0xe7e6e5e4,0xe9e9e8e7,0xebebeaea,0xecececeb,0xecececec,0xebebebeb,0xe9e9eaea,
+0xe6e6e7e8,0xe2e3e4e5,0xdcdee0e1,0xd3d5d7da,0xc2c7ccd0,0x2097b0ba,0x48433c32,0x5553514d,
+0x5e5c5a58,0x63626160,0x66656564,0x69686867,0x6a6a6a69,0x6b6b6b6b,0x6b6b6b6b,0x6a6a6a6b,
+0x68686969,0x65666667,0x61626364,0x5b5d5f60,0x52545659,0x40454a4f,0xa3102c37,0xc8c3bdb3,
+0xd5d3d1cd,0xdedcdad7,0xe2e2e1e0,0xe6e5e4e3,0xe8e7e7e6,0xe9e9e9e8,0xeaeaeaea,0xeaeaeaea,
+0xe9e9eaea,0xe7e7e8e8,0xe4e5e6e6,0xe1e2e3e3,0xdadcdee0,0xd1d4d6d8,0xc1c5cacf,0x2095aeb8,
+0x47423b31,0x5452504b,0x5c5a5856,0x6261605e,0x65646362,0x67676665,0x69686868,0x69696969,
+0x69696969,0x68696969,0x66676768,0x64656566,0x61616263,0x5a5c5e60,0x52545658,0x42474b50,
+0x8e22323b,0xc4bfb6aa,0xd2d0cdc8,0xdbd9d7d5,0xe1e0dedd,0xe4e3e2e2,0xe6e6e5e4,0xe8e7e7e7,
+0xe9e8e8e8,0xe8e9e9e9,0xe8e8e8e8,0xe6e7e7e7,0xe4e4e5e5,0xe1e1e2e3,0xdbdddee0,0xd3d5d7d9,
+0xc5c9cdd1,0x9aafb8c0,0x40382e18,0x504d4944,0x58565452,0x605e5c5a,0x63626160,0x65646463,
+0x67666665,0x68676767,0x68686868,0x67676868,0x66666767,0x64646565,0x61626263,0x5c5d5f60,
+0x5456585a,0x484c5052,0x2e374044,0xb7ad981a,0xccc8c4bf,0xd6d4d2d0,0xdddbd9d8,0xe1e1e0de,
+0xe4e3e3e2,0xe6e5e5e4,0xe7e7e6e6,0xe7e7e7e7,0xe7e7e7e7,0xe6e6e6e6,0xe4e4e5e5,0xe1e2e3e3,
+0xdddee0e0,0xd6d8d9db,0xccd0d2d4,0xb9c0c4c8,0x280ea1b0,0x46423c34,0x53514e4a,0x5a585654,
+0x605f5d5b,0x62626160,0x64646363,0x66656565,0x66666666,0x66666666,0x65666666,0x64646565,
+0x62626363,0x5e606061,0x58595b5d,0x50525456,0x42464a4d,0x1128343c,0xbfb7af9f,0xcfcbc7c3,
+0xd6d5d3d1,0xdddbdad8,0xe1e0e0de,0xe3e3e2e1,0xe5e4e4e4,0xe5e5e5e5,0xe6e6e6e6,0xe5e5e5e6,
+0xe4e4e5e5,0xe2e3e3e3,0xe0e0e1e1,0xdadbddde,0xd3d5d6d8,0xc8cbcfd1,0xb1b9c0c4,0x312381a3,
+0x47444039,0x53514f4b,0x59585654,0x5f5e5c5b,0x62616060,0x63636362,0x65646464,0x65656565,
+0x65656565,0x64646465,0x62636364,0x60616162,0x5c5d5e60,0x5657595a,0x4e505254,0x3f43474a,
+0x81223038,0xbfb8b1a3,0xcecac7c3,0xd5d4d2d0,0xdbdad8d7,0xe0dfdedd,0xe2e2e1e1,0xe3e3e3e2,
+0xe4e4e4e4,0xe4e4e4e4,0xe4e4e4e4,0xe3e3e3e4,0xe1e1e2e2,0xdedfe0e0,0xd8dadbdc,0xd2d3d5d7,
+0xc7cacdd0,0xb1b8bfc3,0x2e2087a4,0x45423d36,0x51504c49,0x57565453,0x5d5c5a59,0x60605f5e,
+0x62626161,0x63636362,0x64646363,0x64646464,0x63636363,0x61626262,0x5f606061,0x5b5c5d5e,
+0x55565859,0x4e505253,0x4044474a,0x1528333a,0xbab3a996,0xcac7c4c0,0xd3d2d0cd,0xd9d7d6d5,
+0xdedddbda,0xe1e0e0df,0xe2e2e1e1,0xe3e3e2e2,0xe3e3e3e3,0xe3e3e3e3,0xe2e2e2e2,0xe0e1e1e1,
+0xdddedfe0,0xd8d9dadc,0xd2d3d5d6,0xc8cbced0,0xb6bdc1c5,0x2082a2af,0x413c352e,0x4e4b4844,
+0x55535250,0x5a595756,0x5e5d5c5b,0x6160605f,0x62626161,0x62626262,0x62626262,0x62626262,
+0x61616162,0x5f5f6060,0x5a5b5d5e,0x55575859,0x50515254,0x4346494d,0x2b343a40,0xb0a48c1b,
+0xc5c1bdb7,0xd0cecbc8,0xd6d4d3d2,0xdad9d8d7,0xdedddddb,0xe0e0e0df,0xe1e1e1e1,0xe2e2e2e2,
+0xe2e2e2e2,0xe1e1e1e2,0xe0e0e0e1,0xdcdddedf,0xd8d9dadb,0xd3d4d6d7,0xcbced0d2,0xbfc2c5c8,
+0x98a8b2b8,0x37302510,0x4744413d,0x51504d4a,0x56555452,0x5b5a5957,0x5e5d5d5c,0x6060605f,
+0x61616160,0x61616161,0x61616161,0x60606161,0x5e5f6060,0x5b5c5d5d,0x5657595a,0x51525455,
+0x484a4d50,0x383e4245,0x8e192832,0xbcb6b0a3,0xc9c6c3c0,0xd2d0cfcc,0xd7d5d4d3,0xdbdad9d8,
+0xdedddcdc,0xe0e0dfdf,0xe1e0e0e0,0xe1e1e1e1,0xe0e0e1e1,0xdfe0e0e0,0xdddddedf,0xd9dadbdc,
+0xd5d6d7d8,0xd0d1d2d3,0xc5c7cacd,0xb3b8bec2,0x21059daa,0x3f3a342c,0x4b484542,0x5251504d,
+0x57565453,0x5b5a5958,0x5e5d5c5b,0x605f5f5e,0x60606060,0x60606060,0x60606060,0x5e5e5f5f,
+0x5b5c5d5d,0x5758595a,0x53545556,0x4d4f5152,0x4245474a,0x2d34393f,0xa8990a21,0xc1bcb7b1,
+0xcbc9c6c3,0xd2d1d0ce,0xd7d6d5d3,0xdad9d8d8,0xdddcdcdb,0xdfdedede,0xe0e0dfdf,0xe0e0e0e0,
+0xdfdfdfdf,0xdddddede,0xdadbdbdc,0xd6d7d8d9,0xd2d3d4d5,0xcacdcfd1,0xc0c3c5c8,0xa6b0b6bb,
+0x2d220d97,0x423e3934,0x4c494744,0x5251504e,0x56555453,0x5a595857,0x5c5c5b5a,0x5e5e5d5d,
+0x5f5f5e5e,0x5f5f5f5f,0x5d5e5e5e,0x5b5c5d5d,0x59595a5b,0x55565758,0x51525354,0x494b4d50,
+0x3d414446,0x212c3338,0xb0a6970c,0xc2bfbab5,0xccc9c7c5,0xd2d1d0ce,0xd6d5d4d3,0xd9d8d8d7,
+0xdcdbdada,0xdddddcdc,0xdedededd,0xdededede,0xdcdddddd,0xdadbdbdc,0xd8d8d9da,0xd4d5d6d7,
+0xd0d1d2d3,0xc7c9ccce,0xbbc0c2c5,0x9ca8b1b6,0x31281c00,0x42403b36,0x4c494745,0x5251504e,
+0x56555453,0x59585756,0x5b5a5a59,0x5c5c5c5b,0x5d5d5d5d,0x5d5d5d5d,0x5b5c5c5c,0x595a5a5b,
+0x57575859,0x53545556,0x4f505152,0x46484a4d,0x393e4144,0x18262f34,0xb1a99f87,0xc2c0bbb6,
+0xcbc9c7c4,0xd1d0cfcd,0xd5d4d3d2,0xd8d7d6d6,0xdadad9d8,0xdbdbdbda,0xdcdcdcdc,0xdcdcdcdc,
+0xdadbdbdb,0xd9d9dada,0xd6d7d7d8,0xd2d3d4d5,0xced0d1d2,0xc5c7c9cc,0xb8bdc0c3,0x96a4aeb3,
+0x3129200a,0x423f3a36,0x4a484644,0x51504e4c,0x54545352,0x57565655,0x59595858,0x5b5a5a5a,
+0x5b5b5b5b,0x5b5b5b5b,0x5a5a5a5b,0x58585959,0x55565757,0x52535454,0x4d4f5051,0x4447494b,
+0x373c4042,0x16242d33,0xb0a89f89,0xc1bebab5,0xc9c7c5c3,0xd0cfcdcb,0xd4d3d2d1,0xd6d6d5d4,
+0xd8d8d7d7,0xdad9d9d9,0xdadadada,0xdadadada,0xd9d9d9da,0xd7d8d8d8,0xd5d5d6d6,0xd1d2d3d4,
+0xccced0d1,0xc4c6c8ca,0xb7bcc0c2,0x97a4adb3,0x2f271c04,0x403d3834,0x48464442,0x504e4c4a,
+0x53525151,0x56555454,0x58575756,0x59595858,0x59595959,0x59595959,0x58585959,0x56575758,
+0x54555556,0x51525353,0x4b4d4f50,0x4446484a,0x373c4042,0x1a252e33,0xada49802,0xbfbbb7b2,
+0xc7c5c3c1,0xcecdcbc9,0xd2d1d1d0,0xd5d4d3d3,0xd7d6d6d5,0xd8d8d7d7,0xd8d8d8d8,0xd8d8d8d9,
+0xd7d8d8d8,0xd6d6d7d7,0xd3d4d5d5,0xd1d1d2d3,0xcbcdcfd0,0xc4c6c7c9,0xb8bcc0c2,0x9ea7afb4,
+0x2a21138b,0x3d393531,0x46444240,0x4d4b4a48,0x5151504f,0x54535352,0x56555554,0x57575756,
+0x58585757,0x58585858,0x57575757,0x55565656,0x53545455,0x50515252,0x4b4c4e50,0x44464749,
+0x383c4042,0x21293034,0xa69d8913,0xbbb7b3ae,0xc5c3c1be,0xcbcac8c6,0xd1d0cfcd,0xd3d2d2d1,
+0xd5d5d4d4,0xd6d6d6d5,0xd7d7d7d6,0xd7d7d7d7,0xd6d6d7d7,0xd5d5d5d6,0xd3d3d4d4,0xd0d1d1d2,
+0xcbcccecf,0xc4c6c7c9,0xb9bdc0c2,0xa4acb2b5,0x22158499,0x3834312a,0x4341403c,0x4a484745,
+0x504e4d4b,0x52525150,0x54545353,0x55555554,0x56565656,0x56565656,0x56565656,0x54555555,
+0x52535354,0x50515152,0x4b4c4e4f,0x44464749,0x3a3e4142,0x272f3337,0x9c8b1120,0xb6b2ada5,
+0xc2c0bdb9,0xc8c7c5c3,0xcecdcbca,0xd1d1d0cf,0xd3d3d2d2,0xd5d4d4d4,0xd5d5d5d5,0xd5d5d5d5,
+0xd5d5d5d5,0xd4d4d4d5,0xd2d3d3d3,0xd0d0d1d2,0xcbcccdcf,0xc4c6c7c9,0xbbbfc1c3,0xabb1b4b8,
+0x148599a3,0x332f2821,0x403d3a37,0x47454342,0x4c4b4a48,0x50504f4e,0x52525151,0x54535353,
+0x55545454,0x55555555,0x54555555,0x53545454,0x52525353,0x50505151,0x4b4c4d4e,0x45464849,
+0x3d404143,0x2e323639,0x85132027,0xb0aaa399,0xbebbb7b4,0xc5c3c2c0,0xcbc9c8c6,0xd0cecdcc,
+0xd2d1d1d0,0xd3d3d2d2,0xd4d4d3d3,0xd4d4d4d4,0xd4d4d4d4,0xd3d3d3d4,0xd1d2d2d3,0xcfd0d1d1,
+0xcbcccdce,0xc5c6c8c9,0xbec0c2c3,0xb1b4b7bb,0x8c9ca4ab,0x2c251c0e,0x3b373431,0x4342403e,
+0x49484645,0x4e4d4b4a,0x5150504f,0x52525151,0x53535352,0x53535353,0x53535353,0x52535353,
+0x51525252,0x4f505051,0x4b4c4d4e,0x45474849,0x3f414244,0x3336393c,0x1722292f,0xa69f9205,
+0xb8b4b1ad,0xc2c0bebb,0xc7c6c5c3,0xcccbcac8,0xd0cfcecd,0xd1d1d1d0,0xd2d2d2d2,0xd3d3d3d3,
+0xd3d3d3d3,0xd2d2d2d3,0xd1d1d2d2,0xcfd0d0d1,0xcbcccdce,0xc6c7c8c9,0xc0c1c3c4,0xb4b8bbbe,
+0xa0a6adb1,0x20150094,0x35312d27,0x403e3b38,0x45444341,0x4a494847,0x4e4d4c4b,0x5150504f,
+0x52515151,0x52525252,0x52525252,0x52525252,0x51515151,0x4f505050,0x4b4c4d4e,0x4647484a,
+0x41424345,0x36393c3f,0x252b3033,0x9685111e,0xb1ada7a1,0xbdbab7b4,0xc4c2c1c0,0xc9c7c6c5,
+0xcdcccbca,0xd0cfcece,0xd1d1d0d0,0xd1d1d1d1,0xd2d2d2d2,0xd1d1d1d2,0xd0d1d1d1,0xcecfd0d0,
+0xcbcccdce,0xc6c7c9ca,0xc1c3c4c5,0xb8bbbec0,0xa9afb2b5,0x088f9ba3,0x2d272218,0x3a373431,
+0x42413f3d,0x47464443,0x4b4a4948,0x4e4e4d4c,0x5050504f,0x51515150,0x51515151,0x51515151,
+0x50505051,0x4e4f4f50,0x4b4c4d4d,0x4748494a,0x42434446,0x3a3c3f41,0x2e313437,0x0c1a2228,
+0xa7a2988a,0xb7b4b1ad,0xc0bfbcb9,0xc5c4c3c2,0xc9c8c7c6,0xcdcccbca,0xcfcfcecd,0xd0d0d0d0,
+0xd1d0d0d0,0xd0d0d0d1,0xd0d0d0d0,0xcececfcf,0xcbcccccd,0xc7c8c9ca,0xc2c4c5c6,0xbbbec0c1,
+0xb1b4b6b9,0x98a1a7ad,0x21180b8b,0x33312c27,0x3e3b3936,0x43424140,0x48474644,0x4b4a4948,
+0x4e4d4c4c,0x4f4f4f4e,0x50505050,0x50505050,0x4f505050,0x4d4e4e4f,0x4b4b4c4d,0x4748494a,
+0x43444546,0x3d3f4142,0x3335383b,0x21262c30,0x988b0a17,0xb0aca6a1,0xbab8b5b3,0xc2c1bfbd,
+0xc6c5c4c3,0xc9c9c8c7,0xcccccbca,0xcececdcd,0xcfcfcfce,0xcfcfcfcf,0xcfcfcfcf,0xcdcdcece,
+0xcbcbcccc,0xc7c8c9ca,0xc3c4c5c6,0xbec0c1c2,0xb5b7babc,0xa6abb0b2,0x0a8a97a1,0x2b262117,
+0x37353230,0x403e3c3a,0x44434241,0x48474645,0x4b4a4949,0x4d4c4c4b,0x4e4e4d4d,0x4e4e4e4e,
+0x4e4e4e4e,0x4d4d4d4e,0x4a4b4c4c,0x4748494a,0x44454647,0x40414243,0x37393b3e,0x2a2f3234,
+0x0a172025,0xa5a09689,0xb4b2afaa,0xbdbbb9b6,0xc3c2c1bf,0xc6c5c4c3,0xc9c8c8c7,0xcbcbcaca,
+0xcdcdcccc,0xcdcdcdcd,0xcdcdcdcd,0xcccccdcd,0xcacbcbcc,0xc8c8c9ca,0xc4c5c6c7,0xc0c1c2c3,
+0xb8bbbdbf,0xafb1b4b6,0x97a0a5aa,0x1f15078b,0x312e2924,0x3a383633,0x41403e3c,0x45444342,
+0x48474645,0x4a494948,0x4c4b4b4a,0x4c4c4c4c,0x4c4c4c4c,0x4c4c4c4c,0x4a4a4b4b,0x48484949,
+0x44454647,0x41424344,0x3a3c3e40,0x31333638,0x20252a2e,0x94850d18,0xaca8a39d,0xb7b5b2b0,
+0xbfbdbbb9,0xc3c2c1c0,0xc6c5c5c4,0xc9c8c7c7,0xcacacac9,0xcbcbcbcb,0xcccccccb,0xcbcbcbcb,
+0xcacacacb,0xc7c8c9c9,0xc5c5c6c7,0xc1c2c3c4,0xbcbebfc0,0xb3b5b7b9,0xa5a9aeb1,0x038f98a0,
+0x26221b12,0x34322f2b,0x3c3a3836,0x4141403e,0x45444342,0x47474645,0x49494848,0x4a4a4a49,
+0x4b4b4b4a,0x4a4a4b4b,0x494a4a4a,0x47484849,0x45464647,0x42434344,0x3d3f4041,0x3537393b,
+0x292e3133,0x10192125,0xa1999180,0xb1aeaaa5,0xb9b7b5b3,0xc0bfbdbb,0xc3c2c2c1,0xc6c5c5c4,
+0xc8c7c7c6,0xc9c9c9c8,0xcacacac9,0xcacacaca,0xc9c9c9ca,0xc7c8c8c8,0xc5c6c6c7,0xc2c3c4c4,
+0xbec0c1c1,0xb7b9babc,0xaeb1b3b5,0x9aa1a5a9,0x170e8291,0x2c282420,0x36343230,0x3d3b3a38,
+0x4241403f,0x44444342,0x47464645,0x48484747,0x49494948,0x49494949,0x48494949,0x47474848,
+0x45464647,0x42434444,0x3f404142,0x383a3c3d,0x30323436,0x2125292d,0x8b05131b,0xa7a39e95,
+0xb3b1afab,0xbab9b7b5,0xc0bfbebc,0xc3c2c2c1,0xc5c5c4c4,0xc7c7c6c6,0xc8c8c8c7,0xc8c8c8c8,
+0xc8c8c8c8,0xc7c7c7c8,0xc5c5c6c6,0xc3c3c4c4,0xc0c1c1c2,0xbabbbdbf,0xb2b4b6b8,0xa6aaadb0,
+0x88949ca2,0x211b1307,0x302d2925,0x37363432,0x3e3c3b39,0x42414040,0x44434342,0x46454544,
+0x47474646,0x47474747,0x47474747,0x46474747,0x45454646,0x43434444,0x40414242,0x3b3c3e3f,
+0x34363739,0x2a2d3032,0x151d2226,0x9991830b,0xaba8a4a0,0xb5b3b1af,0xbbbab8b6,0xc0c0bebd,
+0xc3c2c2c1,0xc5c4c4c3,0xc6c6c5c5,0xc7c6c6c6,0xc7c7c7c7,0xc6c6c6c7,0xc5c5c5c6,0xc3c3c4c4,
+0xc1c1c2c2,0xbcbdbfc0,0xb5b7b9ba,0xadb0b2b4,0x9ea3a6aa,0x0e808f97,0x26221e16,0x32302d2a,
+0x38373534,0x3e3d3b3a,0x41414040,0x43434242,0x45454444,0x46464545,0x46464646,0x46464646,
+0x45454545,0x43434444,0x41414242,0x3d3e4040,0x37383a3b,0x30323435,0x23272a2e,0x0411181f,
+0xa19b948a,0xafaba8a4,0xb6b4b3b1,0xbcbab9b7,0xc0c0bebd,0xc2c2c1c1,0xc4c3c3c3,0xc5c5c4c4,
+0xc5c5c5c5,0xc5c5c5c5,0xc4c4c5c5,0xc3c3c4c4,0xc1c1c2c2,0xbebfc0c0,0xb8babbbc,0xb2b3b5b7,
+0xa7aaaeb0,0x9299a0a3,0x19120687,0x2a26231f,0x3332302d,0x39383635,0x3e3d3c3a,0x4141403f,
+0x43424242,0x44444343,0x45444444,0x45454545,0x44444444,0x43434344,0x41424242,0x3e3f4041,
+0x393a3c3d,0x33353638,0x2a2e3032,0x1b212427,0x8f820b14,0xa5a19d96,0xb1aeaba8,0xb6b5b4b2,
+0xbcbbb9b8,0xc0bfbebd,0xc2c1c1c0,0xc3c3c2c2,0xc4c4c3c3,0xc4c4c4c4,0xc4c4c4c4,0xc3c3c3c3,
+0xc1c2c2c2,0xbfc0c0c1,0xbabbbdbe,0xb5b6b7b9,0xaeb0b2b3,0xa1a4a7ab,0x828f969c,0x201a140b,
+0x2d2a2623,0x34333130,0x39383735,0x3e3d3c3b,0x4140403f,0x42424141,0x43434342,0x43434343,
+0x43434343,0x42434343,0x41414242,0x3f404041,0x3b3c3d3e,0x3637383a,0x30323334,0x25282b2e,
+0x11171d22,0x97918606,0xa8a5a29e,0xb1afadaa,0xb4b3b3b2,0xb7b6b6b5,0xb8b8b8b7,0xb8b8b8b8,
+0xb7b8b8b8,0xb6b6b7b7,0xb4b4b5b5,0xb1b2b2b3,0xacaeafb0,0xa6a8a9ab,0xa1a2a3a5,0x989a9c9f,
+0x90919395,0x8587898c,0x00808183,
+};
+
+PROGMEM
+const unsigned int AudioSampleDrumRim[222] = {
+0x02000372,0x7a746700,0x5b6e767a,0xc3d7d5a9,0x7b756a53,0x63737a7c,0xf3f1e5b3,0x28d9eaf2,
+0xa5545d56,0xfbf7f0e1,0xdcf0f7fb,0x6a6a6240,0xdbbb5264,0x45d1e0e2,0x79777265,0x51687378,
+0xdce1ddc5,0x665f46c6,0xd04b6167,0xf6f5f1e7,0xbee0edf3,0x3a535548,0xebe8e0ca,0x52c4e1e9,
+0x71727066,0xa350636d,0x47b6ccca,0x6d6d675e,0xd33b5f69,0xe9ecebe4,0x44a4d3e2,0xd8b8404b,
+0xedefebe5,0x52aedae7,0x5f646561,0xcfc42451,0x5f4ca6ca,0x6a6e6d67,0xd00d5463,0xcad8ddda,
+0x53534807,0xe1d2a048,0xe6eaebe8,0x4b24cbde,0xa9415052,0xd5d9d6cd,0x615533c5,0x61666866,
+0xc6b23e55,0x4e32b7c6,0x555c5d58,0xe0d5ba42,0xd7e0e3e3,0x40399ac8,0xd7ccb033,0xd3dce0de,
+0x5c533dbd,0x4a565d5f,0xb6bdb12d,0x5c544517,0x515a6060,0xd6d0bd35,0xacc7d2d6,0x2b404031,
+0xded7cdb5,0xcbd7dee0,0x4f4b3caa,0xb521414c,0x9bc0c6c4,0x5d585140,0x4352595d,0xc3c3b914,
+0x473a83b9,0x853f494b,0xdad7d1c2,0xb8cbd4d8,0x313a3617,0xcfc8bc94,0x1abcc9cf,0x55545043,
+0x23404c53,0x12acb2a7,0x514f4739,0xa2374850,0xd0d0ccc2,0x1dabc1ca,0xb20f2e30,0xd2d1cdc3,
+0x25b2c5cf,0x45494740,0xb19c293d,0x3b1fa7b3,0x50514f47,0xa72a424b,0xb7c0c1bb,0x383422a2,
+0xc0aa2134,0xcdd0cec9,0x27a0bbc6,0x16303635,0xbdbdb7a7,0x413097b4,0x474b4c48,0xa6083140,
+0x2989a8ae,0x3e414038,0xc0b10e33,0xc1c6c7c5,0x2515a1b6,0xb7a70723,0xbec2c3c0,0x3d3100b1,
+0x353f4242,0xa3a18725,0x3d332093,0x3b424342,0xb8af8b2d,0xa4b3b9bb,0x21262206,0xc0b7aa85,
+0xb7c0c3c3,0x322b12a6,0x901f2e33,0x9eaaaca5,0x40392f15,0x323b4041,0xaaa6951e,0x281596a6,
+0x192b3130,0xbeb9b19c,0xa9b5bbbf,0x20211791,0xb1a99810,0x94aab2b3,0x3a373020,0x1d2d3539,
+0x8d9a9885,0x35312716,0x10283235,0xb4b3aea0,0x85a0acb2,0x8f111914,0xb6b4afa3,0x88a5b0b5,
+0x2e2f2a1f,0x94051e28,0x1986989c,0x35343128,0x01212d33,0xa3a6a59d,0x20170098,0xa0841720,
+0xb3b3b1ab,0x0599a7b0,0x131d2019,0xa4a29a87,0x210b95a1,0x3031302b,0x8b11212a,0x0a8e9695,
+0x2627231b,0xa18f1321,0xa9adada9,0x0f8397a3,0x99890b12,0xa6a9a7a3,0x201191a0,0x22262826,
+0x918a0818,0x2115028d,0x25292926,0x9d910c1e,0x969fa2a2,0x11120a87,0xa39a8c07,0xa3a7a9a7,
+0x19108799,0x0413191c,0x9295948d,0x231d1183,0x20242726,0x948f0214,0x10808f94,0x11171916,
+0xa39e9380,0x99a1a4a4,0x100d028e,0x9790820a,0x90989c9b,0x211c1403,0x121a2021,0x878b8605,
+0x1c160f01,0x0e171c1e,0x9d9a9384,0x8792989c,0x01080903,0x9e9a948a,0x8b959b9f,0x17161205,
+0x83071115,0x03868b8a,0x1e1c1710,0x0713191d,0x92929086,0x0b04848e,0x86040b0e,0x99989591,
+0x838d9397,0x070a0904,0x8c898401,0x0581878b,0x1111100c,0x00050a0f,0x80828382,0x07070502,
+0x82000306,0x86878685,0x00808284,0x80000000,0x80818181,0x00000080,
+};
@@ -0,0 +1,14 @@
+// Audio data in the wav2sketch layout: a header word (format << 24 | length)
+// then the samples packed four to a word. Format 0x02 is 8 bit u-law at
+// 22.05kHz, half the size of the 16 bit samples per second of sound.
+
+#include <Arduino.h>
+
+extern const unsigned int AudioSampleDrumKick[1379];
+extern const unsigned int AudioSampleDrumSnare[1104];
+extern const unsigned int AudioSampleDrumClosedHat[442];
+extern const unsigned int AudioSampleDrumOpenHat[2206];
+extern const unsigned int AudioSampleDrumClap[1104];
+extern const unsigned int AudioSampleDrumLowTom[1655];
+extern const unsigned int AudioSampleDrumHighTom[1379];
+extern const unsigned int AudioSampleDrumRim[222];
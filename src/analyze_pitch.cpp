@@ -0,0 +1,152 @@
+#include "analyze_pitch.h"
+#include "fast_math.h"
+
+void AudioAnalyzePitch::gate(float db)
+{
+    float rms = dbToUnit(db) * 8192.0f;
+    gateEnergy = (uint64_t)(rms * rms * PITCH_WINDOW);
+}
+
+void AudioAnalyzePitch::update(void)
+{
+    audio_block_t *block = receiveReadOnly(0);
+    if (!block)
+        return;
+    decimate(block->data);
+    release(block);
+
+    if (!searching)
+        startSearch();
+    if (searching && searchSome())
+        searching = false;
+}
+
+void AudioAnalyzePitch::decimate(const int16_t *data)
+{
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        decimationSum += data[i];
+        if (++decimationCount == PITCH_DECIMATION)
+        {
+            // mean of 4, down to 14 bits so a squared difference fits 31
+            ring[ringIndex] = decimationSum / (PITCH_DECIMATION * 4);
+            ringIndex = (ringIndex + 1) % PITCH_HISTORY;
+            decimationSum = 0;
+            decimationCount = 0;
+        }
+    }
+}
+
+void AudioAnalyzePitch::startSearch()
+{
+    // unroll the ring, oldest first
+    size_t tail = PITCH_HISTORY - ringIndex;
+    memcpy(frame, ring + ringIndex, tail * sizeof(int16_t));
+    memcpy(frame + tail, ring, ringIndex * sizeof(int16_t));
+
+    uint64_t energy = 0;
+    for (int j = 0; j < PITCH_WINDOW; j++)
+        energy += (int32_t)frame[j] * frame[j];
+    if (energy < gateEnergy)
+    {
+        publish(0, 0);
+        return;
+    }
+
+    lag = 1;
+    best = 0;
+    shortest = 0;
+    runningSum = 0;
+    normalized[0] = 1.0f;
+    searching = true;
+}
+
+// returns true when the search is over
+bool AudioAnalyzePitch::searchSome()
+{
+    const float t = yinThreshold;
+    for (int n = 0; n < PITCH_LAGS_PER_BLOCK; n++, lag++)
+    {
+        if (lag > PITCH_MAX_LAG)
+        {
+            if (best)
+                finish();
+            else
+                publish(0, 0);
+            return true;
+        }
+
+        const int16_t *a = frame;
+        const int16_t *b = frame + lag;
+        uint64_t d = 0;
+        for (int j = 0; j < PITCH_WINDOW; j += 4)
+        {
+            int32_t d0 = a[j] - b[j];
+            int32_t d1 = a[j + 1] - b[j + 1];
+            int32_t d2 = a[j + 2] - b[j + 2];
+            int32_t d3 = a[j + 3] - b[j + 3];
+            d += (uint32_t)(d0 * d0 + d1 * d1) + (uint32_t)(d2 * d2 + d3 * d3);
+        }
+
+        runningSum += d;
+        float cm = runningSum ? (float)d * lag / (float)runningSum : 1.0f;
+        normalized[lag] = cm;
+
+        if (lag > 1 && lag < PITCH_MIN_LAG && (!shortest || cm < normalized[shortest]))
+            shortest = lag;
+
+        if (best)
+        {
+            if (cm < normalized[best])
+                best = lag;
+            else
+            {
+                // past the bottom of the dip
+                finish();
+                return true;
+            }
+        }
+        else if (lag >= PITCH_MIN_LAG && cm < t)
+        {
+            best = lag;
+        }
+    }
+
+    return false;
+}
+
+void AudioAnalyzePitch::finish()
+{
+    // A pitch above the range dips under the shortest lag too, then passes
+    // the threshold again at a multiple of its period and would read an
+    // octave or more low. A clear dip down there gives it away.
+    if (shortest && normalized[shortest] < 2.0f * yinThreshold &&
+        normalized[shortest] < normalized[shortest - 1] &&
+        normalized[shortest] < normalized[shortest + 1])
+    {
+        publish(0, 0);
+        return;
+    }
+
+    // parabola through the dip for a fractional lag
+    float period = best;
+    if (best < PITCH_MAX_LAG)
+    {
+        float l = normalized[best - 1];
+        float c = normalized[best];
+        float r = normalized[best + 1];
+        float denom = l - 2.0f * c + r;
+        if (denom > 0)
+            period += 0.5f * (l - r) / denom;
+    }
+    float rate = AUDIO_SAMPLE_RATE_EXACT / PITCH_DECIMATION;
+    float p = 1.0f - normalized[best];
+    publish(rate / period, p < 0 ? 0 : p);
+}
+
+void AudioAnalyzePitch::publish(float hz, float p)
+{
+    frequency = hz;
+    confidence = p;
+    fresh = true;
+}
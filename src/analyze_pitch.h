@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+// 44.1kHz in, analysed at ~11kHz
+#define PITCH_DECIMATION 4
+// decimated samples compared at each lag (~23ms)
+#define PITCH_WINDOW 256
+// history kept for one analysis, a window plus the longest lag and one more
+// for the interpolation
+#define PITCH_HISTORY 512
+#define PITCH_MIN_LAG 11                                 // ~1kHz
+#define PITCH_MAX_LAG (PITCH_HISTORY - PITCH_WINDOW - 1) // ~43Hz
+// lags searched per audio block, which bounds the cost of each update
+#define PITCH_LAGS_PER_BLOCK 32
+
+/// @brief Monophonic pitch detector, after YIN.
+///
+/// The input is decimated by 4 with a boxcar and kept in a ring. An
+/// analysis takes a snapshot of the ring and then searches the lags in
+/// order, PITCH_LAGS_PER_BLOCK per update, for the first dip of the
+/// cumulative mean normalized difference under the threshold. The search
+/// stops at the bottom of that dip, so higher notes come back sooner; a
+/// full search takes 8 blocks.
+///
+/// The difference sums are integer (14 bit samples, 64 bit sums), about
+/// 8k multiply-accumulates per update at most. Only the per lag
+/// normalization is float.
+///
+/// The range is ~43Hz to ~1kHz (PITCH_MAX_LAG to PITCH_MIN_LAG). On steady
+/// tones it reads within 0.25% below 350Hz; towards the top, where the
+/// period is down to a dozen decimated samples, sines stay within 0.5% and
+/// saws within 1% (about 15 cents). A pitch above the range reads as
+/// unpitched rather than an octave low. See test/test_pitch.cpp.
+///
+/// Input: 0 = mono audio. No outputs.
+class AudioAnalyzePitch : public AudioStream
+{
+public:
+    AudioAnalyzePitch(void) : AudioStream(1, inputQueueArray) {}
+
+    /// @brief a new estimate is ready; reading it clears the flag
+    bool available()
+    {
+        bool ready = fresh;
+        fresh = false;
+        return ready;
+    }
+
+    /// @brief the latest estimate in Hz, 0 if the input is quiet or has no
+    /// clear pitch
+    float read() const { return frequency; }
+
+    /// @brief how periodic the input looked, 0 to 1
+    float probability() const { return confidence; }
+
+    /// @brief YIN threshold on the normalized difference, 0.1 to 0.2 is
+    /// usual. Lower is stricter.
+    void threshold(float t) { yinThreshold = t; }
+
+    /// @brief inputs below this RMS level (dBFS) are treated as unpitched
+    void gate(float db);
+
+    virtual void update(void);
+
+private:
+    audio_block_t *inputQueueArray[1];
+
+    // decimated input, written continuously
+    int16_t ring[PITCH_HISTORY] = {};
+    uint16_t ringIndex = 0;
+    int32_t decimationSum = 0;
+    uint8_t decimationCount = 0;
+
+    // the snapshot being analysed, oldest first
+    int16_t frame[PITCH_HISTORY];
+    bool searching = false;
+    uint16_t lag = 1;
+    uint16_t best = 0;
+    // deepest point under PITCH_MIN_LAG
+    uint16_t shortest = 0;
+    uint64_t runningSum = 0;
+    float normalized[PITCH_MAX_LAG + 1];
+
+    volatile bool fresh = false;
+    volatile float frequency = 0;
+    volatile float confidence = 0;
+    volatile float yinThreshold = 0.15f;
+    // sum of squares over a window at the gate level, 14 bit samples
+    volatile uint64_t gateEnergy = 0;
+
+    void decimate(const int16_t *data);
+    void startSearch();
+    bool searchSome();
+    void finish();
+    void publish(float hz, float p);
+};
@@ -29,6 +29,12 @@ public:
     void noteOff() override;
     void enable() override;
     void disable() override;
+    void park(bool parked) override
+    {
+        NodeActivity::set(waveform, !parked);
+        NodeActivity::set(filter, !parked);
+        NodeActivity::set(envelope, !parked);
+    }
     void setFrequency(float freq) override;
     AudioStream &getOutputLeft() override { return envelope; }
     AudioStream &getOutputRight() override { return envelope; }
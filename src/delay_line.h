@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Arduino.h>
+
+/// @brief A ring buffer of int16 samples over caller-provided storage.
+///
+/// The storage is handed in with begin() (like AudioEffectFlange) so the
+/// owner can declare it as a plain array and the RAM cost shows up in the
+/// link map instead of coming out of the AudioMemory pool.
+///
+/// tap(0) is the sample most recently written.
+class DelayLine
+{
+private:
+    int16_t *buffer = NULL;
+    uint32_t length = 0;
+    uint32_t writeIndex = 0;
+
+public:
+    void begin(int16_t *buffer_, uint32_t length_)
+    {
+        buffer = buffer_;
+        length = length_;
+        writeIndex = 0;
+        clear();
+    }
+
+    void clear()
+    {
+        if (buffer)
+            memset(buffer, 0, length * sizeof(int16_t));
+    }
+
+    /// @brief longest usable fractional delay in samples
+    float maxDelay() const { return length < 2 ? 0 : length - 2; }
+    uint32_t size() const { return length; }
+
+    inline void write(int16_t sample)
+    {
+        buffer[writeIndex] = sample;
+        if (++writeIndex >= length)
+            writeIndex = 0;
+    }
+
+    /// @brief read a whole number of samples back
+    inline int16_t tap(uint32_t delay) const
+    {
+        int32_t index = (int32_t)writeIndex - 1 - (int32_t)delay;
+        if (index < 0)
+            index += length;
+        return buffer[index];
+    }
+
+    /// @brief read a fractional number of samples back, linearly interpolated
+    inline float tap(float delay) const
+    {
+        uint32_t whole = (uint32_t)delay;
+        float frac = delay - whole;
+        int32_t index = (int32_t)writeIndex - 1 - (int32_t)whole;
+        if (index < 0)
+            index += length;
+        int32_t older = index - 1;
+        if (older < 0)
+            older += length;
+        float a = buffer[index];
+        float b = buffer[older];
+        return a + (b - a) * frac;
+    }
+};
+
+/// @brief A read position into a DelayLine that moves by crossfading from
+/// the old tap to the new one instead of sliding, so jumps in delay time
+/// don't pitch-bend or click.
+///
+/// A move requested while a fade is running waits for it to finish and
+/// then fades to the latest target.
+class CrossfadingTap
+{
+private:
+    float current = 1;
+    float next = 1;
+    float fade = 1.0f; // 1 = settled on current
+    float fadeStep;
+    volatile float target = 1;
+
+public:
+    CrossfadingTap(uint32_t fadeSamples = 2048) : fadeStep(1.0f / fadeSamples) {}
+
+    void set(float samples) { target = samples; }
+    float get() const { return target; }
+
+    /// @brief call once per block before reading
+    inline void beginBlock()
+    {
+        if (fade >= 1.0f && target != current)
+        {
+            next = target;
+            fade = 0;
+        }
+    }
+
+    /// @brief read at the tap's delay plus `offset` samples
+    inline float read(const DelayLine &line, float offset = 0)
+    {
+        float a = line.tap(current + offset);
+        if (fade >= 1.0f)
+            return a;
+
+        float b = line.tap(next + offset);
+        fade += fadeStep;
+        if (fade >= 1.0f)
+        {
+            current = next;
+            return b;
+        }
+        return a + (b - a) * fade;
+    }
+};
+
+/// @brief Halves the sample rate of a signal fed to it one sample at a
+/// time: a 7 tap halfband lowpass, (-1 0 9 16 9 0 -1) / 32, to take off
+/// what would fold back down, read every other sample.
+///
+/// -0.05dB at 3kHz, -0.4dB at 5kHz, then -17dB at 15kHz and -34dB at 18kHz.
+/// The output lags the input by LATENCY samples.
+class HalfbandDecimator
+{
+private:
+    // written twice, 7 apart, so the last 7 inputs are always one run
+    // starting at `position`, newest first
+    float history[14] = {};
+    uint8_t position = 0;
+
+public:
+    static const int LATENCY = 3;
+
+    void reset()
+    {
+        memset(history, 0, sizeof(history));
+        position = 0;
+    }
+
+    inline void push(float x)
+    {
+        position = position == 0 ? 6 : position - 1;
+        history[position] = x;
+        history[position + 7] = x;
+    }
+
+    inline float output() const
+    {
+        const float *h = history + position;
+        return (16.0f * h[3] + 9.0f * (h[2] + h[4]) - (h[0] + h[6])) * (1.0f / 32.0f);
+    }
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include "fast_math.h"
+
+#include "layer.h"
+#include "node_activity.h"
+#include "play_drum_kit.h"
+
+#include "AudioSampleDrums.h"
+
+struct DrumPad
+{
+    const unsigned int *sample;
+    float gain;
+    // pads sharing a group cut each other off, 0 for none
+    uint8_t chokeGroup;
+};
+
+#define DRUM_CHOKE_HATS 1
+
+// one row of keys, left to right
+const DrumPad DRUM_KIT[ILayer::NOTES_PER_ROW] = {
+    {AudioSampleDrumKick, 1.0f, 0},
+    {AudioSampleDrumSnare, 0.8f, 0},
+    {AudioSampleDrumClosedHat, 0.5f, DRUM_CHOKE_HATS},
+    {AudioSampleDrumOpenHat, 0.5f, DRUM_CHOKE_HATS},
+    {AudioSampleDrumClap, 0.7f, 0},
+    {AudioSampleDrumLowTom, 0.8f, 0},
+    {AudioSampleDrumHighTom, 0.8f, 0},
+    {AudioSampleDrumRim, 0.6f, 0}};
+
+// every row plays the kit, top to bottom: as is, a fifth down, a fifth
+// up, an octave up
+const float DRUM_ROW_SPEED[ILayer::ROW_COUNT] = {1.0f, 0.6674f, 1.4983f, 2.0f};
+
+/// @brief A drum kit across the keys. One shots don't need a player per
+/// key, so the whole layer is one AudioPlayDrumKit voice pool. Key up does
+/// nothing, the hit always plays out, and the scale doesn't apply.
+class DrumLayer : public ILayer
+{
+private:
+    AudioPlayDrumKit kit;
+    float tuning = 1.0f;
+    float level = 1.0f;
+
+public:
+    void begin() {}
+    void enable() {}
+    void disable() { kit.stop(); }
+    void park(bool parked) { NodeActivity::set(kit, !parked); }
+
+    void noteOn(int index)
+    {
+        const DrumPad &pad = DRUM_KIT[index % NOTES_PER_ROW];
+        kit.trigger(pad.sample, DRUM_ROW_SPEED[index / NOTES_PER_ROW] * tuning,
+                    pad.gain * level, pad.chokeGroup);
+    }
+    void noteOff(int) {}
+
+    AudioStream &getOutputLeft() { return kit; }
+    AudioStream &getOutputRight() { return kit; }
+
+    void setScale(const float *) {}
+
+    /// @brief retune the whole kit by semitones
+    void tune(int semitones) { tuning = semitonesToRatio(semitones); }
+    void setLevel(float gain) { level = gain; }
+};
@@ -0,0 +1,61 @@
+#include "effect_bypass.h"
+
+void AudioEffectBypass::update(void)
+{
+    audio_block_t *dry[2] = {receiveReadOnly(0), receiveReadOnly(1)};
+    audio_block_t *wet[2] = {receiveReadOnly(2), receiveReadOnly(3)};
+
+    if (dryMuted)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            if (dry[c])
+                release(dry[c]);
+            dry[c] = NULL;
+        }
+    }
+
+    const float to = target;
+    if (gain == to)
+    {
+        // settled, hand the winning side on untouched
+        for (int c = 0; c < 2; c++)
+        {
+            audio_block_t *keep = to == 1.0f ? wet[c] : dry[c];
+            audio_block_t *drop = to == 1.0f ? dry[c] : wet[c];
+            if (drop)
+                release(drop);
+            forward(keep, c);
+        }
+        return;
+    }
+
+    const float step = (to > gain ? 1.0f : -1.0f) / BYPASS_FADE_SAMPLES;
+    float g = gain;
+
+    for (int c = 0; c < 2; c++)
+    {
+        audio_block_t *out = allocate();
+        g = gain;
+        if (out)
+        {
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                g += step;
+                if ((step > 0 && g > to) || (step < 0 && g < to))
+                    g = to;
+                float d = dry[c] ? dry[c]->data[i] : 0;
+                float w = wet[c] ? wet[c]->data[i] : 0;
+                out->data[i] = (int16_t)(d + (w - d) * g);
+            }
+            transmit(out, c);
+            release(out);
+        }
+        if (dry[c])
+            release(dry[c]);
+        if (wet[c])
+            release(wet[c]);
+    }
+
+    gain = g;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+// Length of the fade when a filter is switched in or out of the chain
+#define BYPASS_FADE_SAMPLES 1024
+
+/// @brief Crossfades between a filter's input (dry) and its output (wet) so
+/// it can be switched in and out of a chain without clicking.
+///
+/// Once a fade has finished the winning side's blocks are forwarded as is,
+/// so a settled fader costs a receive and a transmit. In wet only mode the
+/// dry side is treated as silence, for filters on a send bus.
+///
+/// Inputs: 0 = dry left, 1 = dry right, 2 = wet left, 3 = wet right.
+/// Outputs: 0 = left, 1 = right.
+class AudioEffectBypass : public AudioStream
+{
+public:
+    AudioEffectBypass(void) : AudioStream(4, inputQueueArray) {}
+
+    /// @brief fade towards the wet (true) or dry (false) side
+    void engage(bool wet) { target = wet ? 1.0f : 0.0f; }
+
+    /// @brief jump straight to a side without fading
+    void jump(bool wet)
+    {
+        AudioNoInterrupts();
+        target = gain = wet ? 1.0f : 0.0f;
+        AudioInterrupts();
+    }
+
+    void wetOnly(bool muted) { dryMuted = muted; }
+
+    /// @brief true once a fade out has finished
+    bool isBypassed() const { return target == 0.0f && gain == 0.0f; }
+
+    virtual void update(void);
+
+private:
+    audio_block_t *inputQueueArray[4];
+
+    volatile float target = 1.0f;
+    float gain = 1.0f;
+    bool dryMuted = false;
+
+    void forward(audio_block_t *block, uint8_t index)
+    {
+        if (!block)
+            return;
+        transmit(block, index);
+        release(block);
+    }
+};
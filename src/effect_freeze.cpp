@@ -0,0 +1,123 @@
+#include "effect_freeze.h"
+
+void AudioEffectFreeze::update(void)
+{
+    if (!buffer)
+        return;
+
+    audio_block_t *inL = receiveReadOnly(0);
+    audio_block_t *inR = receiveReadOnly(1);
+
+    if (!frozen && holdRequested)
+    {
+        frozen = true;
+        loopEnd = writeIndex;
+        startLoop(sliceRequested);
+    }
+
+    if (!frozen)
+    {
+        // record and pass the input through untouched
+        int16_t *p = buffer + 2 * writeIndex;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            *p++ = inL ? inL->data[i] : 0;
+            *p++ = inR ? inR->data[i] : 0;
+            if (++writeIndex >= frames)
+            {
+                writeIndex = 0;
+                p = buffer;
+            }
+        }
+
+        if (inL)
+        {
+            transmit(inL, 0);
+            release(inL);
+        }
+        if (inR)
+        {
+            transmit(inR, 1);
+            release(inR);
+        }
+        return;
+    }
+
+    audio_block_t *outL = allocate();
+    audio_block_t *outR = allocate();
+    if (!outL || !outR)
+    {
+        if (outL)
+            release(outL);
+        if (outR)
+            release(outR);
+        if (inL)
+            release(inL);
+        if (inR)
+            release(inR);
+        return;
+    }
+
+    const float mixTarget = holdRequested ? 1.0f : 0.0f;
+    const float mixStep = 1.0f / FREEZE_CROSSFADE_SAMPLES;
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        const int16_t *a = buffer + 2 * wrap(loopStart + playPos);
+        float loopL = a[0];
+        float loopR = a[1];
+
+        const uint32_t fadeStart = loopLength - FREEZE_CROSSFADE_SAMPLES;
+        if (playPos >= fadeStart)
+        {
+            // slice length changes land on the loop point, so the length
+            // is fixed where the crossfade into it begins
+            if (playPos == fadeStart)
+                nextLength = sliceRequested;
+
+            // blend the end of the slice into what came just before the
+            // next slice's start, which is where playback continues
+            // after the wrap
+            uint32_t k = playPos - fadeStart;
+            float g = (float)k / FREEZE_CROSSFADE_SAMPLES;
+            const int16_t *b = buffer + 2 * wrap((int32_t)sliceStart(nextLength) - FREEZE_CROSSFADE_SAMPLES + k);
+            loopL += (b[0] - loopL) * g;
+            loopR += (b[1] - loopR) * g;
+        }
+
+        if (++playPos >= loopLength)
+            startLoop(nextLength);
+
+        if (mix < mixTarget)
+        {
+            mix += mixStep;
+            if (mix > mixTarget)
+                mix = mixTarget;
+        }
+        else if (mix > mixTarget)
+        {
+            mix -= mixStep;
+            if (mix < mixTarget)
+                mix = mixTarget;
+        }
+
+        float liveL = inL ? inL->data[i] : 0;
+        float liveR = inR ? inR->data[i] : 0;
+        outL->data[i] = (int16_t)(liveL + (loopL - liveL) * mix);
+        outR->data[i] = (int16_t)(liveR + (loopR - liveR) * mix);
+    }
+
+    // fully faded back to live: resume recording next block
+    if (mix == 0.0f && !holdRequested)
+        frozen = false;
+
+    if (inL)
+        release(inL);
+    if (inR)
+        release(inR);
+
+    transmit(outL, 0);
+    transmit(outR, 1);
+    release(outL);
+    release(outR);
+}
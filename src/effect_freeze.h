@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+// Length of the fades into and out of the freeze and across the loop point
+#define FREEZE_CROSSFADE_SAMPLES 256
+
+/// @brief Beat repeat / freeze. Continuously records its stereo input into
+/// a fixed buffer; while held it loops the most recent slice instead.
+///
+/// The loop point is crossfaded with the audio leading up to the slice, and
+/// engaging and releasing fade between live and looped audio, so neither
+/// clicks. While not frozen the input blocks are passed straight through.
+///
+/// Inputs and outputs: 0 = left, 1 = right.
+class AudioEffectFreeze : public AudioStream
+{
+public:
+    AudioEffectFreeze(void) : AudioStream(2, inputQueueArray) {}
+
+    /// @brief hand over interleaved stereo storage of `frames_` frames,
+    /// which must outlive this object
+    void begin(int16_t *buffer_, uint32_t frames_)
+    {
+        AudioNoInterrupts();
+        buffer = buffer_;
+        frames = frames_;
+        writeIndex = 0;
+        memset(buffer, 0, frames * 2 * sizeof(int16_t));
+        AudioInterrupts();
+    }
+
+    /// @brief longest slice that fits with room for the loop crossfade
+    float maxSliceMs() const
+    {
+        return (frames - FREEZE_CROSSFADE_SAMPLES - AUDIO_BLOCK_SAMPLES) * (1000.0f / AUDIO_SAMPLE_RATE_EXACT);
+    }
+
+    /// @brief loop length; takes effect at the next loop point whose
+    /// crossfade hasn't started yet
+    void sliceLength(float ms)
+    {
+        float limit = maxSliceMs();
+        if (ms > limit)
+            ms = limit;
+        uint32_t samples = ms * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+        if (samples < 2 * FREEZE_CROSSFADE_SAMPLES)
+            samples = 2 * FREEZE_CROSSFADE_SAMPLES;
+        sliceRequested = samples;
+    }
+
+    void hold(bool frozen_) { holdRequested = frozen_; }
+    bool isFrozen() const { return frozen; }
+
+    virtual void update(void);
+
+private:
+    audio_block_t *inputQueueArray[2];
+
+    int16_t *buffer = NULL;
+    uint32_t frames = 0;
+    uint32_t writeIndex = 0;
+
+    volatile bool holdRequested = false;
+    volatile uint32_t sliceRequested = 4 * FREEZE_CROSSFADE_SAMPLES;
+
+    bool frozen = false;
+    uint32_t loopEnd = 0;   // frame just after the slice
+    uint32_t loopStart = 0; // first frame of the slice
+    uint32_t loopLength = 0;
+    uint32_t nextLength = 0; // length after the loop point, fixed by its crossfade
+    uint32_t playPos = 0;    // 0..loopLength
+    float mix = 0;        // 0 = live, 1 = looped
+
+    inline uint32_t wrap(int32_t index) const
+    {
+        while (index < 0)
+            index += frames;
+        while (index >= (int32_t)frames)
+            index -= frames;
+        return index;
+    }
+
+    /// @brief first frame of a slice of `length` frames
+    inline uint32_t sliceStart(uint32_t length) const
+    {
+        return wrap((int32_t)loopEnd - (int32_t)length);
+    }
+
+    void startLoop(uint32_t length)
+    {
+        loopLength = length;
+        nextLength = length;
+        loopStart = sliceStart(length);
+        playPos = 0;
+    }
+};
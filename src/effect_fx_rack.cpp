@@ -0,0 +1,170 @@
+#include "effect_fx_rack.h"
+
+// Racks run one after another in the audio interrupt, so they can all
+// share the working buffers
+static float bufferLeft[AUDIO_BLOCK_SAMPLES];
+static float bufferRight[AUDIO_BLOCK_SAMPLES];
+// a processor's input, kept while it fades in or out
+static float dryLeft[AUDIO_BLOCK_SAMPLES];
+static float dryRight[AUDIO_BLOCK_SAMPLES];
+
+void AudioEffectFxRack::applyOrder()
+{
+    bool wasRunning[FX_RACK_MAX];
+    for (int i = 0; i < count; i++)
+        wasRunning[i] = running[i];
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            if (pending[i] == processors[j])
+            {
+                running[i] = wasRunning[j];
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < count; i++)
+        processors[i] = pending[i];
+    reorderPending = false;
+}
+
+void AudioEffectFxRack::update(void)
+{
+    audio_block_t *inL = receiveReadOnly(0);
+    audio_block_t *inR = receiveReadOnly(1);
+
+    // fade out over this block, then switch order and fade in over the next
+    if (fade == FADE_OUT)
+    {
+        applyOrder();
+        fade = FADE_IN;
+    }
+    else if (reorderPending)
+    {
+        fade = FADE_OUT;
+    }
+
+    bool any = false;
+    for (int i = 0; i < count; i++)
+    {
+        bool run = !processors[i]->isNeutral();
+        if (run && !running[i])
+        {
+            processors[i]->reset();
+            switching[i] = FADE_IN;
+        }
+        else if (!run && running[i])
+        {
+            switching[i] = FADE_OUT;
+        }
+        else
+        {
+            switching[i] = FADE_NONE;
+        }
+        running[i] = run;
+        any = any || run || switching[i] == FADE_OUT;
+    }
+
+    if (!any)
+    {
+        // nothing to do, and nothing to fade either
+        if (fade == FADE_OUT)
+            applyOrder();
+        fade = FADE_NONE;
+        if (inL)
+        {
+            transmit(inL, 0);
+            release(inL);
+        }
+        if (inR)
+        {
+            transmit(inR, 1);
+            release(inR);
+        }
+        return;
+    }
+
+    audio_block_t *outL = allocate();
+    audio_block_t *outR = allocate();
+    if (!outL || !outR)
+    {
+        if (outL)
+            release(outL);
+        if (outR)
+            release(outR);
+        if (inL)
+            release(inL);
+        if (inR)
+            release(inR);
+        return;
+    }
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        bufferLeft[i] = inL ? inL->data[i] : 0.0f;
+        bufferRight[i] = inR ? inR->data[i] : 0.0f;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (switching[i] == FADE_NONE)
+        {
+            if (running[i])
+                processors[i]->process(bufferLeft, bufferRight, AUDIO_BLOCK_SAMPLES);
+            continue;
+        }
+
+        memcpy(dryLeft, bufferLeft, sizeof(dryLeft));
+        memcpy(dryRight, bufferRight, sizeof(dryRight));
+        processors[i]->process(bufferLeft, bufferRight, AUDIO_BLOCK_SAMPLES);
+        const float step = 1.0f / AUDIO_BLOCK_SAMPLES;
+        float g = switching[i] == FADE_OUT ? 1.0f : 0.0f;
+        const float dg = switching[i] == FADE_OUT ? -step : step;
+        for (int k = 0; k < AUDIO_BLOCK_SAMPLES; k++)
+        {
+            g += dg;
+            bufferLeft[k] = dryLeft[k] + (bufferLeft[k] - dryLeft[k]) * g;
+            bufferRight[k] = dryRight[k] + (bufferRight[k] - dryRight[k]) * g;
+        }
+    }
+
+    if (fade == FADE_NONE)
+    {
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            outL->data[i] = saturate16(bufferLeft[i]);
+            outR->data[i] = saturate16(bufferRight[i]);
+        }
+    }
+    else
+    {
+        // crossfade with the input rather than with silence, so a reorder
+        // passes through dry instead of dropping out (or through silence
+        // on a send bus, where the rack returns wet only)
+        const float step = 1.0f / AUDIO_BLOCK_SAMPLES;
+        float g = fade == FADE_OUT ? 1.0f : 0.0f;
+        const float dg = fade == FADE_OUT ? -step : step;
+        const bool dry = !dryMuted;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            g += dg;
+            float dryL = dry && inL ? inL->data[i] : 0.0f;
+            float dryR = dry && inR ? inR->data[i] : 0.0f;
+            outL->data[i] = saturate16(dryL + (bufferLeft[i] - dryL) * g);
+            outR->data[i] = saturate16(dryR + (bufferRight[i] - dryR) * g);
+        }
+        if (fade == FADE_IN)
+            fade = FADE_NONE;
+    }
+    if (inL)
+        release(inL);
+    if (inR)
+        release(inR);
+
+    transmit(outL, 0);
+    transmit(outR, 1);
+    release(outL);
+    release(outR);
+}
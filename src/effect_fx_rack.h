@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "processor.h"
+
+// Most processors one rack can hold
+#define FX_RACK_MAX 6
+
+/// @brief Runs a list of StereoProcessors over a stereo signal in one node.
+///
+/// The input is converted to float once, every processor works on the same
+/// pair of buffers in place, and the result is saturated back to int16
+/// once. Neutral processors are skipped, and when all of them are the input
+/// blocks are forwarded as they are. A processor that turns neutral runs
+/// one more block, crossfading from its output to its input, so anything
+/// still settling inside it doesn't stop dead; one that wakes up is
+/// crossfaded in the same way.
+///
+/// The order can be changed while running with move(); the rack crossfades
+/// to its input over one block, switches order on the block boundary and
+/// crossfades back, so the sound goes briefly dry rather than silent.
+///
+/// Inputs and outputs: 0 = left, 1 = right.
+class AudioEffectFxRack : public AudioStream
+{
+public:
+    AudioEffectFxRack(void) : AudioStream(2, inputQueueArray) {}
+
+    /// @brief append a processor, which must outlive the rack
+    void add(StereoProcessor &p)
+    {
+        if (count >= FX_RACK_MAX)
+            return;
+        AudioNoInterrupts();
+        processors[count] = &p;
+        pending[count] = &p;
+        running[count] = false;
+        switching[count] = FADE_NONE;
+        count++;
+        AudioInterrupts();
+    }
+
+    uint8_t size() const { return count; }
+
+    /// @brief name of the processor at a position, counting a pending move
+    const char *nameAt(uint8_t i) { return pending[i]->name(); }
+
+    /// @brief take the processor at `from` out and put it back in at `to`
+    void move(uint8_t from, uint8_t to)
+    {
+        if (from >= count || to >= count || from == to)
+            return;
+        AudioNoInterrupts();
+        StereoProcessor *moved = pending[from];
+        if (from < to)
+        {
+            for (int i = from; i < to; i++)
+                pending[i] = pending[i + 1];
+        }
+        else
+        {
+            for (int i = from; i > to; i--)
+                pending[i] = pending[i - 1];
+        }
+        pending[to] = moved;
+        reorderPending = true;
+        AudioInterrupts();
+    }
+
+    /// @brief on a send bus, pass silence instead of the input while
+    /// crossfading through a reorder
+    void wetOnly(bool muted) { dryMuted = muted; }
+
+    /// @brief true when every processor is neutral
+    bool isNeutral()
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (!processors[i]->isNeutral())
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief have every processor reset before it next runs, e.g. after
+    /// the rack itself has been bypassed for a while
+    void reset()
+    {
+        AudioNoInterrupts();
+        for (int i = 0; i < count; i++)
+            running[i] = false;
+        AudioInterrupts();
+    }
+
+    virtual void update(void);
+
+private:
+    enum Fade
+    {
+        FADE_NONE,
+        FADE_OUT,
+        FADE_IN
+    };
+
+    audio_block_t *inputQueueArray[2];
+
+    StereoProcessor *processors[FX_RACK_MAX];
+    StereoProcessor *pending[FX_RACK_MAX];
+    bool running[FX_RACK_MAX];
+    // whether each processor is fading in or out over this block
+    Fade switching[FX_RACK_MAX];
+    uint8_t count = 0;
+
+    volatile bool reorderPending = false;
+    Fade fade = FADE_NONE;
+    bool dryMuted = false;
+
+    void applyOrder();
+};
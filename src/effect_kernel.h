@@ -0,0 +1,136 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "processor.h"
+
+/*
+ * Thin AudioStream adapters for the kernels in processor.h. Each one
+ * derives from its kernel, so the kernel's settings are called on the node
+ * directly, and does nothing but move blocks in and out of float.
+ */
+
+/// @brief Node for a MonoProcessor. Input and output 0.
+template <typename K>
+class AudioEffectMonoKernel : public AudioStream, public K
+{
+public:
+    AudioEffectMonoKernel(void) : AudioStream(1, inputQueueArray) {}
+
+    virtual void update(void)
+    {
+        audio_block_t *block = receiveWritable(0);
+        if (!block)
+            return;
+
+        float buffer[AUDIO_BLOCK_SAMPLES];
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            buffer[i] = block->data[i];
+        K::process(buffer, buffer, AUDIO_BLOCK_SAMPLES);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            block->data[i] = saturate16(buffer[i]);
+
+        transmit(block);
+        release(block);
+    }
+
+private:
+    audio_block_t *inputQueueArray[1];
+};
+
+/// @brief Node for a StereoProcessor. Inputs and outputs: 0 = left,
+/// 1 = right. Forwards its input while the kernel is neutral.
+template <typename K>
+class AudioEffectStereoKernel : public AudioStream, public K
+{
+public:
+    AudioEffectStereoKernel(void) : AudioStream(2, inputQueueArray) {}
+
+    virtual void update(void)
+    {
+        audio_block_t *inL = receiveReadOnly(0);
+        audio_block_t *inR = receiveReadOnly(1);
+
+        if (K::isNeutral())
+        {
+            wasNeutral = true;
+            if (inL)
+            {
+                transmit(inL, 0);
+                release(inL);
+            }
+            if (inR)
+            {
+                transmit(inR, 1);
+                release(inR);
+            }
+            return;
+        }
+        if (wasNeutral)
+        {
+            K::reset();
+            wasNeutral = false;
+        }
+
+        audio_block_t *outL = allocate();
+        audio_block_t *outR = allocate();
+        if (outL && outR)
+        {
+            float left[AUDIO_BLOCK_SAMPLES];
+            float right[AUDIO_BLOCK_SAMPLES];
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                left[i] = inL ? inL->data[i] : 0.0f;
+                right[i] = inR ? inR->data[i] : 0.0f;
+            }
+            K::process(left, right, AUDIO_BLOCK_SAMPLES);
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                outL->data[i] = saturate16(left[i]);
+                outR->data[i] = saturate16(right[i]);
+            }
+            transmit(outL, 0);
+            transmit(outR, 1);
+        }
+
+        if (outL)
+            release(outL);
+        if (outR)
+            release(outR);
+        if (inL)
+            release(inL);
+        if (inR)
+            release(inR);
+    }
+
+private:
+    audio_block_t *inputQueueArray[2];
+    bool wasNeutral = true;
+};
+
+/// @brief Node for a MonoGenerator. Output 0. The kernel's isPlaying()
+/// says whether there is anything to send.
+template <typename K>
+class AudioPlayKernel : public AudioStream, public K
+{
+public:
+    AudioPlayKernel(void) : AudioStream(0, NULL) {}
+
+    virtual void update(void)
+    {
+        if (!K::isPlaying())
+            return;
+
+        audio_block_t *block = allocate();
+        if (!block)
+            return;
+
+        float buffer[AUDIO_BLOCK_SAMPLES];
+        K::process(buffer, AUDIO_BLOCK_SAMPLES);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            block->data[i] = saturate16(buffer[i]);
+
+        transmit(block);
+        release(block);
+    }
+};
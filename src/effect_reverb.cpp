@@ -0,0 +1,141 @@
+#include "effect_reverb.h"
+#include "fast_math.h"
+
+void AudioEffectFdnReverb::time(float t60)
+{
+    t60 = constrain(t60, 0.1f, 10.0f);
+    // loop gain that loses 60dB over t60 for the average line length
+    const float halfRate = AUDIO_SAMPLE_RATE_EXACT / 2.0f;
+    const float averageDelay = (LINE0 + LINE1 + LINE2 + LINE3) / (4.0f * halfRate);
+    float g = dbToUnit(-60.0f * averageDelay / t60);
+    feedbackGain = (int16_t)(g * 32767.0f);
+}
+
+static inline int16_t sat16(int32_t x)
+{
+    return (int16_t)constrain(x, -32768, 32767);
+}
+
+void AudioEffectFdnReverb::update(void)
+{
+    audio_block_t *inL = receiveReadOnly(0);
+    audio_block_t *inR = receiveReadOnly(1);
+
+    const int32_t wet = wetGain;
+    const int32_t dry = dryGain;
+
+    if (wet == 0)
+    {
+        if (wasRunning)
+        {
+            clear();
+            wasRunning = false;
+        }
+        if (dry == 0)
+        {
+            // wet only and silent: send nothing
+            if (inL)
+                release(inL);
+            if (inR)
+                release(inR);
+            return;
+        }
+        if (inL)
+        {
+            transmit(inL, 0);
+            release(inL);
+        }
+        if (inR)
+        {
+            transmit(inR, 1);
+            release(inR);
+        }
+        return;
+    }
+    wasRunning = true;
+
+    audio_block_t *outL = allocate();
+    audio_block_t *outR = allocate();
+    if (!outL || !outR)
+    {
+        if (outL)
+            release(outL);
+        if (outR)
+            release(outR);
+        if (inL)
+            release(inL);
+        if (inR)
+            release(inR);
+        return;
+    }
+
+    const int32_t fb = feedbackGain;
+    const int32_t damp = dampCoeff;
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i += 2)
+    {
+        // mono sum and decimate by averaging each pair of samples
+        int32_t x = 0;
+        if (inL)
+            x += inL->data[i] + inL->data[i + 1];
+        if (inR)
+            x += inR->data[i] + inR->data[i + 1];
+        x >>= 3; // /4 for the average, /2 for headroom in the tank
+
+        x = allpass(diffuser0, DIFFUSER0, diffuserPos0, x);
+        x = allpass(diffuser1, DIFFUSER1, diffuserPos1, x);
+
+        // read and damp each line
+        int32_t d[LINE_COUNT];
+        for (int k = 0; k < LINE_COUNT; k++)
+        {
+            int32_t tap = lines[k][positions[k]];
+            lowpass[k] += mulQ15(tap - lowpass[k], damp);
+            d[k] = lowpass[k];
+        }
+
+        // 4x4 Hadamard, scaled by 1/2 to keep it orthonormal
+        int32_t a = d[0] + d[1];
+        int32_t b = d[0] - d[1];
+        int32_t c = d[2] + d[3];
+        int32_t e = d[2] - d[3];
+        int32_t h[LINE_COUNT] = {(a + c) / 2, (b + e) / 2, (a - c) / 2, (b - e) / 2};
+
+        for (int k = 0; k < LINE_COUNT; k++)
+        {
+            lines[k][positions[k]] = sat16(x + mulQ15(h[k], fb));
+            if (++positions[k] >= lengths[k])
+                positions[k] = 0;
+        }
+
+        // decorrelated stereo taps
+        int32_t l = d[0] - d[2];
+        int32_t r = d[1] - d[3];
+
+        // interpolate back up to full rate
+        int32_t l0 = (lastL + l) >> 1;
+        int32_t r0 = (lastR + r) >> 1;
+        lastL = l;
+        lastR = r;
+
+        int32_t dl0 = inL ? inL->data[i] : 0;
+        int32_t dl1 = inL ? inL->data[i + 1] : 0;
+        int32_t dr0 = inR ? inR->data[i] : 0;
+        int32_t dr1 = inR ? inR->data[i + 1] : 0;
+
+        outL->data[i] = sat16((dl0 * dry + l0 * wet) >> 15);
+        outL->data[i + 1] = sat16((dl1 * dry + l * wet) >> 15);
+        outR->data[i] = sat16((dr0 * dry + r0 * wet) >> 15);
+        outR->data[i + 1] = sat16((dr1 * dry + r * wet) >> 15);
+    }
+
+    if (inL)
+        release(inL);
+    if (inR)
+        release(inR);
+
+    transmit(outL, 0);
+    transmit(outR, 1);
+    release(outL);
+    release(outR);
+}
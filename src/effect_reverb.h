@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+/// @brief Small fixed-point feedback delay network reverb sized for the
+/// SAMD51.
+///
+/// The stereo input is summed to mono and decimated to half rate, run
+/// through two allpass diffusers into a 4 line FDN with a Hadamard
+/// feedback matrix and one-pole damping in each line, then taken back out
+/// on two decorrelated stereo taps and linearly interpolated back up to
+/// full rate. Everything in the loop is Q15.
+///
+/// The cost per block is fixed (no data dependent branches). With the wet
+/// level at zero the input blocks are forwarded and the network isn't run
+/// at all. Delay memory is ~10KB, all inside this object.
+///
+/// Cycle budget (estimated from instruction counts, per pair of input
+/// samples): ~15 to sum and decimate, ~25 for the diffusers, ~60 for the
+/// four lines and the Hadamard mix and ~50 for the taps, interpolation and
+/// dry/wet mix, so ~150. That is ~10k cycles a block with the block
+/// handling, ~3.4M cycles/s or ~2.9% of the 120MHz M4. It runs once on the
+/// send bus, so the share is the same with 32 voices playing as with one.
+/// Its budget is 5% of the CPU; this is well inside it, so there is no
+/// cheaper mode.
+///
+/// Inputs and outputs: 0 = left, 1 = right.
+class AudioEffectFdnReverb : public AudioStream
+{
+public:
+    AudioEffectFdnReverb(void) : AudioStream(2, inputQueueArray)
+    {
+        clear();
+        time(1.5f);
+        damping(0.3f);
+        mix(0.2f);
+    }
+
+    /// @brief seconds to decay by 60dB
+    void time(float t60);
+
+    /// @brief high frequency loss in the loop, 0 (bright) to 1 (dark)
+    void damping(float d)
+    {
+        d = constrain(d, 0.0f, 0.95f);
+        dampCoeff = (int16_t)((1.0f - d) * 32767.0f);
+    }
+
+    /// @brief wet level; dry is 1 - wet unless wetOnly() is set
+    void mix(float wet)
+    {
+        wet = constrain(wet, 0.0f, 1.0f);
+        wetGain = (int16_t)(wet * 32767.0f);
+        dryGain = dryMuted ? 0 : (int16_t)((1.0f - wet) * 32767.0f);
+    }
+
+    /// @brief true when none of the reverb is mixed in
+    bool isDry() const { return wetGain == 0; }
+
+    /// @brief mute the dry path, for use on a send bus
+    void wetOnly(bool muted)
+    {
+        dryMuted = muted;
+        mix(wetGain / 32767.0f);
+    }
+
+    virtual void update(void);
+
+private:
+    // line lengths at half rate, mutually prime
+    static const int LINE_COUNT = 4;
+    static const uint16_t LINE0 = 743;
+    static const uint16_t LINE1 = 1061;
+    static const uint16_t LINE2 = 1327;
+    static const uint16_t LINE3 = 1619;
+    static const uint16_t DIFFUSER0 = 113;
+    static const uint16_t DIFFUSER1 = 337;
+    static const int16_t DIFFUSION = 19661; // 0.6 in Q15
+
+    audio_block_t *inputQueueArray[2];
+
+    int16_t line0[LINE0];
+    int16_t line1[LINE1];
+    int16_t line2[LINE2];
+    int16_t line3[LINE3];
+    int16_t *lines[LINE_COUNT] = {line0, line1, line2, line3};
+    const uint16_t lengths[LINE_COUNT] = {LINE0, LINE1, LINE2, LINE3};
+    uint16_t positions[LINE_COUNT] = {0};
+    int32_t lowpass[LINE_COUNT] = {0};
+
+    int16_t diffuser0[DIFFUSER0];
+    int16_t diffuser1[DIFFUSER1];
+    uint16_t diffuserPos0 = 0;
+    uint16_t diffuserPos1 = 0;
+
+    // last half rate output, for interpolating back up
+    int32_t lastL = 0;
+    int32_t lastR = 0;
+
+    volatile int16_t feedbackGain = 0;
+    volatile int16_t dampCoeff = 32767;
+    volatile int16_t wetGain = 0;
+    volatile int16_t dryGain = 32767;
+    bool dryMuted = false;
+    bool wasRunning = false;
+
+    void clear()
+    {
+        memset(line0, 0, sizeof(line0));
+        memset(line1, 0, sizeof(line1));
+        memset(line2, 0, sizeof(line2));
+        memset(line3, 0, sizeof(line3));
+        memset(diffuser0, 0, sizeof(diffuser0));
+        memset(diffuser1, 0, sizeof(diffuser1));
+        for (int i = 0; i < LINE_COUNT; i++)
+            lowpass[i] = 0;
+        lastL = lastR = 0;
+    }
+
+    static inline int32_t allpass(int16_t *buf, uint16_t len, uint16_t &pos, int32_t x)
+    {
+        int32_t delayed = buf[pos];
+        int32_t v = x - mulQ15(delayed, DIFFUSION);
+        buf[pos] = (int16_t)constrain(v, -32768, 32767);
+        if (++pos >= len)
+            pos = 0;
+        return delayed + mulQ15(v, DIFFUSION);
+    }
+
+    /// @brief Q15 multiply truncated toward zero. Rounding, or the floor a
+    /// plain shift gives, can hand back a sample as large as the one it
+    /// was given even with a loop gain under one, and the tail then sits
+    /// on a limit cycle of a few LSB forever; truncation only ever
+    /// shrinks it, so the loop dies to zero.
+    static inline int32_t mulQ15(int32_t x, int32_t q)
+    {
+        int32_t product = x * q;
+        return (product + ((product >> 31) & 0x7FFF)) >> 15;
+    }
+};
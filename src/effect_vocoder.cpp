@@ -0,0 +1,192 @@
+#include "effect_vocoder.h"
+
+// makes a band gain of unity for a band averaging 1/4 of full scale
+#define VOCODER_MAKEUP 4.0f
+
+AudioEffectVocoder::AudioEffectVocoder(void) : AudioStream(3, inputQueueArray)
+{
+    bands(VOCODER_MAX_BANDS);
+}
+
+void AudioEffectVocoder::bands(uint8_t n)
+{
+    n = n <= 4 ? 4 : VOCODER_MAX_BANDS;
+
+    // bands about as wide as their spacing
+    float ratio = powf(5000.0f / 200.0f, 1.0f / (n - 1));
+    float q = sqrtf(ratio) / (ratio - 1.0f);
+
+    Coefficients next;
+    memset(&next, 0, sizeof(next));
+    for (uint8_t b = 0; b < n; b++)
+    {
+        // RBJ constant 0dB peak bandpass
+        float hz = 200.0f * powf(ratio, b);
+        float w = 2.0f * 3.14159265f * hz / AUDIO_SAMPLE_RATE_EXACT;
+        float alpha = sinf(w) / (2.0f * q);
+        float a0 = 1.0f + alpha;
+        int32_t a1 = (int32_t)(2.0f * cosf(w) / a0 * 16384.0f + 0.5f);
+        int32_t a2 = (int32_t)(-(1.0f - alpha) / a0 * 16384.0f - 0.5f);
+        next.b0[b] = (int16_t)(alpha / a0 * 16384.0f + 0.5f);
+        next.a[b] = (a1 & 0xffff) | ((uint32_t)a2 << 16);
+    }
+
+    AudioNoInterrupts();
+    coeffs = next;
+    bandsInUse = n;
+    AudioInterrupts();
+}
+
+void AudioEffectVocoder::releaseTime(float seconds)
+{
+    if (seconds < 0.01f)
+        seconds = 0.01f;
+    // per block
+    releaseAlpha = expf(-AUDIO_BLOCK_SAMPLES / (seconds * AUDIO_SAMPLE_RATE_EXACT));
+}
+
+// one bandpass step; y carries y[n-1] and y[n-2] packed
+inline int16_t AudioEffectVocoder::tick(int16_t diff, int16_t b0, int32_t a, int32_t &y)
+{
+    int32_t acc = VOCODER_SMLAD(a, y, b0 * diff);
+    int32_t out = VOCODER_SSAT16(acc >> 14);
+    y = (out & 0xffff) | ((uint32_t)y << 16);
+    return out;
+}
+
+void AudioEffectVocoder::update(void)
+{
+    audio_block_t *left = receiveReadOnly(0);
+    audio_block_t *right = receiveReadOnly(1);
+    audio_block_t *modulator = receiveReadOnly(2);
+
+    if (!left || !right)
+    {
+        if (left)
+            release(left);
+        if (right)
+            release(right);
+        if (modulator)
+            release(modulator);
+        return;
+    }
+
+    audio_block_t *outLeft = allocate();
+    audio_block_t *outRight = allocate();
+    if (!outLeft || !outRight)
+    {
+        if (outLeft)
+            release(outLeft);
+        if (outRight)
+            release(outRight);
+        transmit(left, 0);
+        transmit(right, 1);
+        release(left);
+        release(right);
+        if (modulator)
+            release(modulator);
+        return;
+    }
+
+    const uint8_t n = bandsInUse;
+    const float alpha = releaseAlpha;
+
+    // analysis: where the modulator's energy is. The bank input is
+    // x[n] - x[n-2], halved so it fits in 16 bits
+    int16_t diff[AUDIO_BLOCK_SAMPLES];
+    if (modulator)
+    {
+        int16_t x1 = analysis.x1, x2 = analysis.x2;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            int16_t x = modulator->data[i];
+            diff[i] = (x - x2) >> 1;
+            x2 = x1;
+            x1 = x;
+        }
+        analysis.x1 = x1;
+        analysis.x2 = x2;
+    }
+    else
+    {
+        memset(diff, 0, sizeof(diff));
+    }
+
+    int32_t target[VOCODER_MAX_BANDS];
+    for (uint8_t b = 0; b < n; b++)
+    {
+        const int16_t b0 = coeffs.b0[b];
+        const int32_t a = coeffs.a[b];
+        int32_t y = analysis.y[b];
+        uint32_t sum = 0;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            int32_t out = tick(diff[i], b0, a, y);
+            sum += out < 0 ? -out : out;
+        }
+        analysis.y[b] = y;
+
+        // instant attack, smoothed release
+        float level = (float)sum * (1.0f / AUDIO_BLOCK_SAMPLES);
+        if (level > envelope[b])
+            envelope[b] = level;
+        else
+            envelope[b] = alpha * envelope[b] + (1.0f - alpha) * level;
+
+        // the differences were halved, hence the extra 2x
+        float g = envelope[b] * (2.0f * VOCODER_MAKEUP);
+        target[b] = g > 32767.0f ? 32767 : (int32_t)g;
+    }
+
+    // synthesis: the carrier through the same bands at those levels
+    int16_t x1 = synthesis.x1, x2 = synthesis.x2;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        int16_t x = (left->data[i] + right->data[i]) >> 1;
+        diff[i] = (x - x2) >> 1;
+        x2 = x1;
+        x1 = x;
+    }
+    synthesis.x1 = x1;
+    synthesis.x2 = x2;
+
+    int32_t voice[AUDIO_BLOCK_SAMPLES];
+    memset(voice, 0, sizeof(voice));
+    for (uint8_t b = 0; b < n; b++)
+    {
+        const int16_t b0 = coeffs.b0[b];
+        const int32_t a = coeffs.a[b];
+        int32_t y = synthesis.y[b];
+        int32_t g = gain[b];
+        const int32_t step = (target[b] - g) / AUDIO_BLOCK_SAMPLES;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            int32_t out = tick(diff[i], b0, a, y);
+            // undo the halved difference
+            voice[i] += (out * g) >> 14;
+            g += step;
+        }
+        synthesis.y[b] = y;
+        gain[b] = target[b];
+    }
+
+    const int32_t wet = wetQ15;
+    const int32_t dry = 32767 - wet;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        int32_t v = VOCODER_SSAT16(voice[i]) * wet;
+        int32_t l = (left->data[i] * dry + v) >> 15;
+        int32_t r = (right->data[i] * dry + v) >> 15;
+        outLeft->data[i] = VOCODER_SSAT16(l);
+        outRight->data[i] = VOCODER_SSAT16(r);
+    }
+
+    transmit(outLeft, 0);
+    transmit(outRight, 1);
+    release(outLeft);
+    release(outRight);
+    release(left);
+    release(right);
+    if (modulator)
+        release(modulator);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+// The M4's dual 16 bit multiply-accumulate, with a plain C fallback for
+// host builds
+#if defined(__SAMD51__)
+#include <arm_math.h>
+#define VOCODER_SMLAD(a, b, acc) __SMLAD(a, b, acc)
+#define VOCODER_SSAT16(x) __SSAT(x, 16)
+#else
+#define VOCODER_SMLAD(a, b, acc) ((acc) + (int16_t)(a) * (int16_t)(b) + ((int32_t)(a) >> 16) * ((int32_t)(b) >> 16))
+#define VOCODER_SSAT16(x) ((x) > 32767 ? 32767 : (x) < -32768 ? -32768 : (x))
+#endif
+
+#define VOCODER_MAX_BANDS 8
+
+/// @brief Channel vocoder: the spectrum envelope of a modulator (the audio
+/// input) imposed on a carrier (the synth).
+///
+/// The modulator goes through a bank of bandpass biquads; the mean level
+/// of each band over a block, smoothed, sets the gain of the matching band
+/// of the carrier. The carrier is summed to mono and the result goes to
+/// both channels, mixed with the dry carrier.
+///
+/// Everything runs in Q15 with Q14 coefficients. A constant gain bandpass
+/// has b1 = 0 and b2 = -b0, so each band is b0 * (x[n] - x[n-2]), with
+/// the input difference shared by the whole bank, plus the two feedback
+/// taps in one SMLAD on packed y[n-1]/y[n-2]. Band gains are ramped across
+/// the block so they don't zipper.
+///
+/// Cycle budget (estimated from instruction counts, per sample): ~8 per
+/// analysis band and ~10 per synthesis band, so ~150 for 8 bands, ~6.6M
+/// cycles/s or ~5.5% of the 120MHz M4. bands(4) is the reduced fallback at
+/// about half that.
+///
+/// Inputs: 0 = carrier left, 1 = carrier right, 2 = modulator.
+/// Outputs: 0 = left, 1 = right.
+class AudioEffectVocoder : public AudioStream
+{
+public:
+    AudioEffectVocoder(void);
+
+    /// @brief 4 or 8 bands, spread evenly on a log scale from 200Hz to 5kHz
+    void bands(uint8_t n);
+    uint8_t bandCount() const { return bandsInUse; }
+
+    /// @brief level of the vocoder against the dry carrier, 0 (off) to 1
+    void mix(float wet) { wetQ15 = (int32_t)(wet * 32767.0f); }
+    bool isDry() const { return wetQ15 == 0; }
+
+    /// @brief how fast the band levels follow the modulator, in seconds
+    void releaseTime(float seconds);
+
+    virtual void update(void);
+
+private:
+    audio_block_t *inputQueueArray[3];
+
+    struct Coefficients
+    {
+        int16_t b0[VOCODER_MAX_BANDS];
+        // a1 in the low half, a2 in the high half, negated (Q14)
+        int32_t a[VOCODER_MAX_BANDS];
+    };
+
+    struct Bank
+    {
+        // y[n-1] in the low half, y[n-2] in the high half
+        int32_t y[VOCODER_MAX_BANDS] = {};
+        int16_t x1 = 0;
+        int16_t x2 = 0;
+    };
+
+    Coefficients coeffs;
+    volatile uint8_t bandsInUse = VOCODER_MAX_BANDS;
+
+    Bank analysis;
+    Bank synthesis;
+
+    // smoothed modulator band levels, and the gains (Q15) ramped to last
+    float envelope[VOCODER_MAX_BANDS] = {};
+    int32_t gain[VOCODER_MAX_BANDS] = {};
+
+    volatile int32_t wetQ15 = 0;
+    volatile float releaseAlpha = 0.7f;
+
+    static inline int16_t tick(int16_t diff, int16_t b0, int32_t a, int32_t &y);
+};
@@ -49,6 +49,9 @@ public:
         return !encoder.digitalRead(SS_SWITCH);
     }
 
+    // button state as of the last loop(), without another i2c read
+    bool isHeld() { return buttonState; }
+
     void loop()
     {
         int32_t d = encoder.getEncoderDelta();
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/*
+ * Cheap approximations shared by all of the DSP code.
+ *
+ * Every function lists its worst case error against the exact function
+ * over the stated domain, as measured by test/test_fast_math.cpp, which
+ * also prints host timings next to libm's. The costs on the M4F are
+ * instruction count estimates at -O2, not cycle-accurate measurements; the
+ * libm equivalents (expf, logf, sinf, tanhf) are all in the 100-300 cycle
+ * range on this part, so anything here is a big win in a per-sample loop.
+ */
+
+#ifdef AUDIO_SAMPLE_RATE_EXACT
+#define FAST_MATH_SAMPLE_RATE AUDIO_SAMPLE_RATE_EXACT
+#else
+#define FAST_MATH_SAMPLE_RATE 44100.0f
+#endif
+
+#define SINE_TABLE_BITS 10
+#define SINE_TABLE_SIZE (1 << SINE_TABLE_BITS)
+
+// One cycle of sine in Q15 with a guard entry at the end. Shared by the
+// LFOs and oscillators so we only pay for it once in flash.
+extern const int16_t SINE_TABLE_Q15[SINE_TABLE_SIZE + 1];
+
+inline uint32_t floatToBits(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+inline float bitsToFloat(uint32_t u)
+{
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+/* ----------------------------------------------------------------------
+ * https://community.arm.com/tools/f/discussions/4292/cmsis-dsp-new-functionality-proposal/22621#22621
+ * Fast approximation to the log2() function.  The float is split into
+ * a fraction F in [0.5, 1) and an exponent E by poking at the bits (no
+ * frexpf call), then a 3rd order polynomial is evaluated on F.
+ *
+ * max abs error: 1.33e-3 over [1e-6, 1e6] (0.008 dB when used for dB)
+ * cost: ~10 cycles
+ ** ------------------------------------------------------------------- */
+inline float fast_log2f(float x)
+{
+    uint32_t u = floatToBits(x) & 0x7fffffff;
+    int E = (int)(u >> 23) - 126;
+    float F = bitsToFloat((u & 0x007fffff) | 0x3f000000);
+
+    float Y = 1.23149591368684f;
+    Y = Y * F - 4.11852516267426f;
+    Y = Y * F + 6.02197014179219f;
+    Y = Y * F - 3.13396450166353f;
+    return Y + E;
+}
+
+/// @brief 2^x. Integer part goes straight into the exponent, the fraction
+/// uses a 4th order minimax polynomial.
+/// max rel error: 5.3e-6 over [-100, 100], half of it the polynomial and
+/// half rounding x to float; returns 0 below -126
+/// cost: ~14 cycles
+inline float fast_exp2f(float x)
+{
+    if (x < -126.0f)
+        return 0.0f;
+    if (x > 127.0f)
+        x = 127.0f;
+
+    float fl = floorf(x);
+    float f = x - fl;
+    float p = 1.00000259f + f * (0.693003841f + f * (0.241442724f + f * (0.0520115167f + f * 0.0135341387f)));
+    return bitsToFloat(floatToBits(p) + ((uint32_t)(int32_t)fl << 23));
+}
+
+/// @brief e^x via fast_exp2f. max rel error: 4.5e-6 over [-20, 20], growing
+/// with |x| as x * log2(e) is rounded
+inline float fast_expf(float x)
+{
+    return fast_exp2f(x * 1.44269504089f);
+}
+
+/// @brief linear amplitude to dBFS. max abs error: 0.008 dB
+inline float unitToDb(float unit)
+{
+    return 6.02059991f * fast_log2f(unit);
+}
+
+/// @brief dBFS to linear amplitude. max rel error: 3.8e-6 over [-110, 24] dB
+inline float dbToUnit(float db)
+{
+    // log2(10) / 20
+    return fast_exp2f(db * 0.166096405f);
+}
+
+/// @brief sine of a 32 bit phase (a full turn is 2^32), Q15 result.
+/// Linear interpolation between table entries.
+/// max abs error: 1.6 LSB
+/// cost: ~8 cycles
+inline int16_t sine_q15(uint32_t phase)
+{
+    uint32_t index = phase >> (32 - SINE_TABLE_BITS);
+    int32_t frac = (phase >> (32 - SINE_TABLE_BITS - 16)) & 0xffff;
+    int32_t a = SINE_TABLE_Q15[index];
+    int32_t b = SINE_TABLE_Q15[index + 1];
+    return a + (((b - a) * frac) >> 16);
+}
+
+/// @brief sine of a 32 bit phase (a full turn is 2^32) as float.
+/// max abs error: 1.8e-5
+/// cost: ~10 cycles
+inline float fast_sin_phase(uint32_t phase)
+{
+    uint32_t index = phase >> (32 - SINE_TABLE_BITS);
+    float frac = (phase & ((1u << (32 - SINE_TABLE_BITS)) - 1)) * (1.0f / (1u << (32 - SINE_TABLE_BITS)));
+    float a = SINE_TABLE_Q15[index];
+    float b = SINE_TABLE_Q15[index + 1];
+    return (a + (b - a) * frac) * (1.0f / 32767.0f);
+}
+
+/// @brief radians to a 32 bit phase, wrapping any input
+inline uint32_t radiansToPhase(float rad)
+{
+    // 2^32 / 2pi
+    return (uint32_t)(int64_t)(rad * 683565275.576f);
+}
+
+/// @brief sinf replacement. max abs error: 1.8e-5 for |x| < 10, 2.5e-5 for
+/// |x| < 100 (float phase precision runs out beyond that)
+inline float fast_sinf(float rad)
+{
+    return fast_sin_phase(radiansToPhase(rad));
+}
+
+/// @brief cosf replacement. Same error as fast_sinf
+inline float fast_cosf(float rad)
+{
+    return fast_sin_phase(radiansToPhase(rad) + 0x40000000u);
+}
+
+/// @brief tanh via a [7/6] Pade approximant, clamped outside +-4.97
+/// where it meets +-1.
+/// max abs error: 9.7e-5
+/// cost: ~20 cycles (one divide)
+inline float fast_tanhf(float x)
+{
+    if (x > 4.97f)
+        return 1.0f;
+    if (x < -4.97f)
+        return -1.0f;
+    float x2 = x * x;
+    float num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    return num / den;
+}
+
+/// @brief frequency ratio for an offset in semitones. max rel error: 5.3e-6,
+/// that of fast_exp2f
+inline float semitonesToRatio(float semitones)
+{
+    return fast_exp2f(semitones * (1.0f / 12.0f));
+}
+
+/// @brief frequency of a (fractional) MIDI note number. max rel error: 5.3e-6
+inline float noteToFrequency(float note)
+{
+    return 440.0f * semitonesToRatio(note - 69.0f);
+}
+
+/// @brief per-sample increment for a 32 bit phase accumulator.
+/// Exact up to float rounding (24 bits of the 32 bit increment).
+inline uint32_t frequencyToPhaseIncrement(float hz, float sampleRate = FAST_MATH_SAMPLE_RATE)
+{
+    return (uint32_t)(hz * (4294967296.0f / sampleRate));
+}
+
+/// @brief per-sample increment for a MIDI note number.
+inline uint32_t noteToPhaseIncrement(float note, float sampleRate = FAST_MATH_SAMPLE_RATE)
+{
+    return frequencyToPhaseIncrement(noteToFrequency(note), sampleRate);
+}
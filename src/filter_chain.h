@@ -0,0 +1,351 @@
+#pragma once
+
+#include <Audio.h>
+#include <new>
+#include "filters.h"
+
+// Most filters one chain can hold
+#define FILTER_CHAIN_MAX 10
+// Most effects a send chain can hold, one per input on the mixer it
+// returns into
+#define SEND_CHAIN_MAX 4
+
+/// @brief A series of Filters hanging off a stereo source, optionally
+/// feeding a fixed stereo destination.
+///
+/// The chain is itself a node with no inputs or outputs. It takes its
+/// filters' nodes off the audio library's update pass and runs them from
+/// its own update() in chain order, so it has to be constructed after its
+/// source and before its destination; then a block makes it from source to
+/// destination in one update cycle whatever the filters are.
+///
+/// Filters that are bypassed or at a neutral setting are faded out and
+/// then routed around, so their nodes don't run at all. Call loop() from
+/// the main loop to pick up bypass changes; rewiring is done there with the
+/// audio interrupt masked, which is always between two update cycles.
+///
+/// The order can be changed while running with move(). The filters that
+/// change position are faded out first (which leaves that stretch of the
+/// chain transparent), then the chain is rewired and they fade back in.
+///
+/// A send chain isn't a series at all: every effect on it hears the
+/// source and returns wet only on its own input of the destination mixer,
+/// so the reverb doesn't only hear what comes out of the delay.
+class FilterChain : public AudioStream
+{
+private:
+    AudioStream &sourceLeft;
+    AudioStream &sourceRight;
+    uint8_t sourceRightPort;
+
+    Filter *filters[FILTER_CHAIN_MAX];
+    // wired into the signal path, possibly still fading in or out
+    bool inPath[FILTER_CHAIN_MAX];
+    uint8_t count = 0;
+
+    // order asked for by move(), applied by loop() once the filters that
+    // change position have faded out
+    Filter *pending[FILTER_CHAIN_MAX];
+    bool reorderPending = false;
+
+    AudioStream *outputLeft;
+    AudioStream *outputRight;
+    uint8_t outputRightPort;
+
+    // connections into the destination, delayed init: from the tail, or
+    // from each effect on a send chain. Left and right in pairs.
+    static const int DEST_PATCH_COUNT = 2 * SEND_CHAIN_MAX;
+    alignas(AudioConnection) byte destbuf[DEST_PATCH_COUNT][sizeof(AudioConnection)];
+    AudioConnection *patchDest[DEST_PATCH_COUNT] = {};
+
+    AudioStream *destLeft = NULL;
+    AudioStream *destRight = NULL;
+    uint8_t destLeftPort = 0;
+    uint8_t destRightPort = 0;
+
+    bool isSend;
+
+    void disconnectDest()
+    {
+        for (int i = 0; i < DEST_PATCH_COUNT; i++)
+        {
+            if (patchDest[i])
+                patchDest[i]->~AudioConnection();
+            patchDest[i] = NULL;
+        }
+    }
+
+    /// @brief wire left/right into the destination's inputs `offset` on
+    /// from the ports given to connectTo(), using patch pair `pair`
+    void patchPair(int pair, AudioStream &left, AudioStream &right, uint8_t rightPort, uint8_t offset)
+    {
+        patchDest[2 * pair] = new (destbuf[2 * pair]) AudioConnection(left, 0, *destLeft, destLeftPort + offset);
+        patchDest[2 * pair + 1] = new (destbuf[2 * pair + 1]) AudioConnection(right, rightPort, *destRight, destRightPort + offset);
+    }
+
+    void connectDest()
+    {
+        disconnectDest();
+        if (!destLeft)
+            return;
+        if (!isSend)
+        {
+            patchPair(0, *outputLeft, *outputRight, outputRightPort, 0);
+            return;
+        }
+        // each effect on its own input, by position so nothing moves when
+        // another one is bypassed
+        for (int i = 0; i < count; i++)
+        {
+            if (inPath[i])
+                patchPair(i, filters[i]->fader, filters[i]->fader, 1, i);
+        }
+    }
+
+    /// @brief true while the filter at i is waiting to change position
+    bool isMoving(int i) { return reorderPending && pending[i] != filters[i]; }
+
+    /// @brief switch to the pending order, with the audio interrupt masked
+    void applyOrder()
+    {
+        bool wasInPath[FILTER_CHAIN_MAX];
+        for (int i = 0; i < count; i++)
+            wasInPath[i] = inPath[i];
+
+        for (int i = 0; i < count; i++)
+        {
+            for (int j = 0; j < count; j++)
+            {
+                if (pending[i] == filters[j])
+                {
+                    inPath[i] = wasInPath[j];
+                    break;
+                }
+            }
+        }
+        for (int i = 0; i < count; i++)
+            filters[i] = pending[i];
+        reorderPending = false;
+    }
+
+    /// @brief rebuild every connection from the current order and bypass
+    /// state, with the audio interrupt masked
+    void rewireLocked()
+    {
+        AudioStream *left = &sourceLeft;
+        AudioStream *right = &sourceRight;
+        uint8_t rightPort = sourceRightPort;
+
+        for (int i = 0; i < count; i++)
+        {
+            Filter *f = filters[i];
+            if (!inPath[i])
+            {
+                f->disconnect();
+                continue;
+            }
+            if (isSend)
+            {
+                // in parallel, all of them off the source
+                f->connect(&sourceLeft, &sourceRight, sourceRightPort);
+                continue;
+            }
+            f->connect(left, right, rightPort);
+            left = right = &f->fader;
+            rightPort = 1;
+        }
+
+        outputLeft = left;
+        outputRight = right;
+        outputRightPort = rightPort;
+        connectDest();
+
+        for (int i = 0; i < count; i++)
+            filters[i]->park();
+    }
+
+    void rewire()
+    {
+        AudioNoInterrupts();
+        rewireLocked();
+        AudioInterrupts();
+    }
+
+public:
+    /// @param isSend_ filters on a send chain are put in wet only mode and
+    /// run in parallel
+    FilterChain(AudioStream &left, AudioStream &right, uint8_t rightPort = 0, bool isSend_ = false)
+        : AudioStream(0, NULL),
+          sourceLeft(left), sourceRight(right), sourceRightPort(rightPort),
+          outputLeft(&left), outputRight(&right), outputRightPort(rightPort),
+          isSend(isSend_)
+    {
+        // nothing connects to the chain itself, so nothing would wake it
+        active = true;
+    }
+
+    ~FilterChain() { disconnectDest(); }
+
+    void push(Filter &filter)
+    {
+        if (count >= (isSend ? SEND_CHAIN_MAX : FILTER_CHAIN_MAX) || reorderPending)
+            return;
+        filter.wetOnly(isSend);
+        filter.begin();
+        filter.fader.jump(true);
+        filters[count] = &filter;
+        inPath[count] = true;
+        count++;
+        rewire();
+    }
+
+    /// @brief feed the end of the chain, wherever it ends up, into these
+    /// inputs. A send chain feeds its effects into consecutive inputs from
+    /// these on, one each, so give it a mixer to itself.
+    void connectTo(AudioStream &left, uint8_t leftPort, AudioStream &right, uint8_t rightPort)
+    {
+        AudioNoInterrupts();
+        destLeft = &left;
+        destRight = &right;
+        destLeftPort = leftPort;
+        destRightPort = rightPort;
+        connectDest();
+        AudioInterrupts();
+    }
+
+    /// @brief pass a new note grid on to every filter in the chain
+    void setScale(const float *frequencies)
+    {
+        for (uint8_t i = 0; i < count; i++)
+            filters[i]->setScale(frequencies);
+    }
+
+    uint8_t size() { return count; }
+
+    /// @brief the filter at a position, counting any move still under way
+    Filter &filterAt(uint8_t i) { return *(reorderPending ? pending : filters)[i]; }
+
+    const char *nameAt(uint8_t i) { return filterAt(i).name(); }
+
+    /// @brief take the filter at `from` out and put it back in at `to`,
+    /// shifting the ones in between. Takes effect over the next few loop()s.
+    void move(uint8_t from, uint8_t to)
+    {
+        if (from >= count || to >= count || from == to)
+            return;
+        if (!reorderPending)
+        {
+            for (int i = 0; i < count; i++)
+                pending[i] = filters[i];
+        }
+
+        Filter *moved = pending[from];
+        if (from < to)
+        {
+            for (int i = from; i < to; i++)
+                pending[i] = pending[i + 1];
+        }
+        else
+        {
+            for (int i = from; i > to; i--)
+                pending[i] = pending[i - 1];
+        }
+        pending[to] = moved;
+        reorderPending = true;
+    }
+
+    /// @brief swap two positions, same timing as move()
+    void swap(uint8_t a, uint8_t b)
+    {
+        if (a >= count || b >= count || a == b)
+            return;
+        if (!reorderPending)
+        {
+            for (int i = 0; i < count; i++)
+                pending[i] = filters[i];
+        }
+        Filter *t = pending[a];
+        pending[a] = pending[b];
+        pending[b] = t;
+        reorderPending = true;
+    }
+
+    /// @brief follow bypass and order changes: fade filters out and route
+    /// around or move them once silent, and wire them back in and fade
+    /// them up
+    void loop()
+    {
+        bool changed = false;
+
+        if (reorderPending)
+        {
+            bool ready = true;
+            for (int i = 0; i < count; i++)
+            {
+                if (inPath[i] && isMoving(i))
+                {
+                    filters[i]->fader.engage(false);
+                    if (!filters[i]->fader.isBypassed())
+                        ready = false;
+                }
+            }
+            if (ready)
+            {
+                AudioNoInterrupts();
+                applyOrder();
+                rewireLocked();
+                AudioInterrupts();
+            }
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (isMoving(i))
+                continue;
+            Filter *f = filters[i];
+            bool bypass = f->wantsBypass();
+            if (inPath[i] && bypass)
+            {
+                f->fader.engage(false);
+                if (f->fader.isBypassed())
+                {
+                    inPath[i] = false;
+                    changed = true;
+                }
+            }
+            else if (!inPath[i] && !bypass)
+            {
+                f->resume();
+                f->fader.jump(false);
+                inPath[i] = true;
+                changed = true;
+            }
+        }
+
+        if (changed)
+            rewire();
+
+        for (int i = 0; i < count; i++)
+        {
+            if (inPath[i] && !isMoving(i) && !filters[i]->wantsBypass())
+                filters[i]->fader.engage(true);
+        }
+    }
+
+    /// @brief the end of an insert chain, or the source when everything is
+    /// bypassed. A send chain has no single end; see connectTo().
+    AudioStream *getOutputLeft() { return outputLeft; }
+    AudioStream *getOutputRight() { return outputRight; }
+    uint8_t getOutputRightPort() { return outputRightPort; }
+
+    virtual void update(void)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (!inPath[i])
+                continue;
+            filters[i]->process();
+            filters[i]->fader.update();
+        }
+    }
+};
@@ -2,37 +2,121 @@
 
 #include <Audio.h>
 #include <new>
-#include "effect_dynamics.h"
+#include "effect_bypass.h"
+#include "effect_freeze.h"
+#include "effect_fx_rack.h"
+#include "effect_reverb.h"
+#include "effect_vocoder.h"
+#include "fx_autowah.h"
+#include "fx_basic.h"
+#include "fx_convolution.h"
+#include "fx_dynamics.h"
+#include "fx_eq.h"
+#include "fx_feedback_delay.h"
+#include "fx_mod_delay.h"
+#include "fx_phaser.h"
+#include "fx_resonator.h"
+#include "fx_tremolo.h"
+#include "layer.h"
+#include "node_activity.h"
 
 class Filter
 {
 private:
     // we're doing delayed initialization
-    alignas(AudioConnection) byte plbuf[sizeof(AudioConnection)];
-    alignas(AudioConnection) byte prbuf[sizeof(AudioConnection)];
-    AudioConnection *patchLeft = NULL;
-    AudioConnection *patchRight = NULL;
+    // inputs left/right, dry into the fader left/right, wet into the fader left/right
+    static const int PATCH_COUNT = 6;
+    alignas(AudioConnection) byte patchbuf[PATCH_COUNT][sizeof(AudioConnection)];
+    AudioConnection *patches[PATCH_COUNT] = {};
+
+    bool bypassRequested = false;
+
+    void patch(int i, AudioStream &src, uint8_t srcPort, AudioStream &dst, uint8_t dstPort)
+    {
+        patches[i] = new (patchbuf[i]) AudioConnection(src, srcPort, dst, dstPort);
+    }
 
 public:
-    void connect(AudioStream &left_, AudioStream &right_)
+    /// @brief fades the filter in and out; its output is the filter's
+    /// output as far as the rest of the chain is concerned
+    AudioEffectBypass fader;
+
+    /// @brief wire the filter's inputs up to its source and its output into
+    /// the fader. rightPort_ is the output index of the right channel on
+    /// right_.
+    void connect(AudioStream *left_, AudioStream *right_, uint8_t rightPort_ = 0)
+    {
+        disconnect();
+        patch(0, *left_, 0, inL(), 0);
+        patch(1, *right_, rightPort_, inR(), rightPort());
+        patch(2, *left_, 0, fader, 0);
+        patch(3, *right_, rightPort_, fader, 1);
+        patch(4, outL(), 0, fader, 2);
+        patch(5, outR(), rightPort(), fader, 3);
+    }
+
+    void disconnect()
     {
-        patchLeft = new (plbuf) AudioConnection(left_, inL());
-        patchRight = new (prbuf) AudioConnection(right_, inR());
+        for (int i = 0; i < PATCH_COUNT; i++)
+        {
+            if (patches[i])
+                patches[i]->~AudioConnection();
+            patches[i] = NULL;
+        }
     }
 
     ~Filter()
     {
-        if (patchLeft)
-            patchLeft->~AudioConnection();
-        if (patchRight)
-            patchRight->~AudioConnection();
+        disconnect();
     }
 
     virtual void begin() {}
+
+    /// @brief called before begin() when the filter sits on a send bus.
+    /// Filters with a dry path should drop it and return only the effect.
+    virtual void wetOnly(bool muted) { fader.wetOnly(muted); }
     virtual AudioStream &outR() = 0;
     virtual AudioStream &outL() = 0;
     virtual AudioStream &inR() = 0;
     virtual AudioStream &inL() = 0;
+
+    /// @brief input and output index of the right channel on inR()/outR().
+    /// 0 for filters built from mono nodes, 1 for stereo nodes.
+    virtual uint8_t rightPort() { return 0; }
+
+    /// @brief run the filter's nodes once, in signal order
+    virtual void process() = 0;
+
+    /// @brief short name for the menu
+    virtual const char *name() = 0;
+
+    /// @brief take the filter's nodes off the audio library's update pass
+    virtual void park()
+    {
+        NodeActivity::set(inL(), false);
+        NodeActivity::set(inR(), false);
+        NodeActivity::set(outL(), false);
+        NodeActivity::set(outR(), false);
+        NodeActivity::set(fader, false);
+    }
+
+    /// @brief true when the current settings leave the sound untouched
+    virtual bool isNeutral() { return false; }
+
+    /// @brief called before a bypassed filter is faded back in, to drop
+    /// any state left over from before it was bypassed
+    virtual void resume() {}
+
+    /// @brief called with the note grid's frequencies (row by row, like
+    /// ILayer::setScale) when the filter is added and whenever the scale
+    /// changes. From the main loop.
+    virtual void setScale(const float *) {}
+
+    /// @brief ask for the filter to be taken out of the chain
+    void bypass(bool b) { bypassRequested = b; }
+
+    /// @brief whether the chain should route around this filter
+    bool wantsBypass() { return bypassRequested || isNeutral(); }
 };
 
 class MonoFilterChannel
@@ -40,6 +124,7 @@ class MonoFilterChannel
 public:
     virtual AudioStream &out() = 0;
     virtual AudioStream &in() = 0;
+    virtual void process() = 0;
 };
 
 template <typename T>
@@ -49,6 +134,7 @@ public:
     T filter;
     virtual AudioStream &out() { return filter; }
     virtual AudioStream &in() { return filter; }
+    virtual void process() { filter.update(); }
 };
 
 template <typename T>
@@ -62,126 +148,331 @@ public:
     AudioStream &outL() { return left.out(); }
     AudioStream &inR() { return right.in(); }
     AudioStream &inL() { return left.in(); }
+
+    void process()
+    {
+        left.process();
+        right.process();
+    }
 };
 
-class GainFilter : public MonoFilter<SimpleMonoFilterChannel<AudioMixer4>>
+/// @brief A filter made of StereoProcessors sharing one AudioEffectFxRack,
+/// which is neutral when all of them are
+class FxRackFilter : public Filter
 {
-
 public:
-    void gain(float g)
+    AudioEffectFxRack rack;
+
+    AudioStream &outR() { return rack; }
+    AudioStream &outL() { return rack; }
+    AudioStream &inR() { return rack; }
+    AudioStream &inL() { return rack; }
+    uint8_t rightPort() { return 1; }
+    void process() { rack.update(); }
+    bool isNeutral() { return rack.isNeutral(); }
+    void resume() { rack.reset(); }
+
+    void wetOnly(bool muted)
     {
-        left.filter.gain(0, g);
-        right.filter.gain(0, g);
+        Filter::wetOnly(muted);
+        rack.wetOnly(muted);
     }
 };
 
-class BitCrusherFilter : public MonoFilter<SimpleMonoFilterChannel<AudioEffectBitcrusher>>
+/// @brief The end of the master bus: a compressor per channel then the
+/// volume, in one rack
+class OutputFilter : public FxRackFilter
 {
+    DualMonoProcessor<DynamicsProcessor> limiter{"limiter"};
+    GainProcessor level;
 
 public:
-    void bits(uint8_t bits_)
+    const char *name() { return "output"; }
+
+    void begin()
     {
-        left.filter.bits(bits_);
-        left.filter.bits(bits_);
+        limiter.left.compression(-12.0, 0.01, 0.06, 4.0);
+        limiter.right.compression(-12.0, 0.01, 0.06, 4.0);
+        rack.add(limiter);
+        rack.add(level);
     }
 
-    void sampleRate(float sampleRate_)
+    void gain(float g) { level.gain(g); }
+};
+
+class ReverbFilter : public Filter
+{
+public:
+    const char *name() { return "reverb"; }
+    AudioEffectFdnReverb reverb;
+
+    AudioStream &outR() { return reverb; }
+    AudioStream &outL() { return reverb; }
+    AudioStream &inR() { return reverb; }
+    AudioStream &inL() { return reverb; }
+    uint8_t rightPort() { return 1; }
+    void process() { reverb.update(); }
+    bool isNeutral() { return reverb.isDry(); }
+
+    void time(float t60)
+    {
+        reverb.time(t60);
+    }
+
+    void mix(float wet)
     {
-        left.filter.sampleRate(sampleRate_);
-        left.filter.sampleRate(sampleRate_);
+        reverb.mix(wet);
+    }
+
+    void wetOnly(bool muted)
+    {
+        Filter::wetOnly(muted);
+        reverb.wetOnly(muted);
     }
 };
 
-/// @brief This filter is actually too expensive for our project
-class ReverbFilter : public MonoFilter<SimpleMonoFilterChannel<AudioEffectReverb>>
+// Frames in the InsertRackFilter's modulation delay line (~46ms)
+#define MOD_DELAY_LENGTH (16 * AUDIO_BLOCK_SAMPLES)
+
+/// @brief The insert effects in one rack: chorus plus flange or vibrato
+/// sharing one delay line and one LFO, then the bit crusher. Their order
+/// can be swapped with rack.move().
+class InsertRackFilter : public FxRackFilter
 {
+    // interleaved stereo delay line (8KB)
+    int16_t delayline[2 * MOD_DELAY_LENGTH];
+
 public:
-    void time(float f)
+    ModDelayProcessor modulation;
+    BitCrushProcessor crusher;
+
+    const char *name() { return "inserts"; }
+
+    void begin()
     {
-        left.filter.reverbTime(f);
-        right.filter.reverbTime(f);
+        modulation.begin(delayline, MOD_DELAY_LENGTH);
+        mode(MOD_DELAY_OFF);
+        voices(0);
+        rack.add(modulation);
+        rack.add(crusher);
     }
+
+    void mode(int m) { modulation.mode((ModDelayMode)m); }
+    void voices(uint8_t v) { modulation.voices(v); }
+    void bits(uint8_t b) { crusher.bits(b); }
+    void sampleRate(float hz) { crusher.sampleRate(hz); }
 };
 
-class FlangeFilter : public MonoFilter<SimpleMonoFilterChannel<AudioEffectFlange>>
+/// @brief Master tone shaping: a four band parametric EQ. Flat until a
+/// band is boosted or cut, and skipped by the chain while it is.
+class EqFilter : public FxRackFilter
 {
-#define FLANGE_DELAY_LENGTH (6 * AUDIO_BLOCK_SAMPLES)
-    // Allocate the delay lines for left and right channels
-    short l_delayline[FLANGE_DELAY_LENGTH];
-    short r_delayline[FLANGE_DELAY_LENGTH];
+public:
+    EqProcessor eq;
+
+    const char *name() { return "eq"; }
 
+    void begin() { rack.add(eq); }
+
+    void frequency(uint8_t band, float hz) { eq.frequency(band, hz); }
+    void gain(uint8_t band, float db) { eq.gain(band, db); }
+    void q(uint8_t band, float q) { eq.q(band, q); }
+};
+
+/// @brief Instrument body by convolution, meant for the guitar voices,
+/// which have none of their own. Skipped by the chain while it's dry.
+class ConvolutionFilter : public FxRackFilter
+{
 public:
+    ConvolutionProcessor body;
+
+    const char *name() { return "body"; }
+
     void begin()
     {
-        left.filter.begin(l_delayline, FLANGE_DELAY_LENGTH,
-                          FLANGE_DELAY_LENGTH / 4,
-                          FLANGE_DELAY_LENGTH / 4,
-                          0.5);
-        right.filter.begin(r_delayline, FLANGE_DELAY_LENGTH,
-                           FLANGE_DELAY_LENGTH / 4,
-                           FLANGE_DELAY_LENGTH / 4,
-                           0.5);
-
-        enable(false);
+        body.impulse(*IMPULSE_RESPONSES[0]);
+        rack.add(body);
     }
 
-    void enable(bool isEnabled)
+    void mix(float wet) { body.mix(wet); }
+
+    /// @brief pick one of IMPULSE_RESPONSES
+    void impulse(int index)
     {
-        if (isEnabled)
-        {
-            left.filter.voices(FLANGE_DELAY_LENGTH / 4,
-                               FLANGE_DELAY_LENGTH / 4,
-                               0.5);
-            right.filter.voices(FLANGE_DELAY_LENGTH / 4,
-                                FLANGE_DELAY_LENGTH / 4,
-                                0.5);
-        }
-        else
-        {
-            left.filter.voices(FLANGE_DELAY_PASSTHRU, 0, 0);
-            right.filter.voices(FLANGE_DELAY_PASSTHRU, 0, 0);
-        }
+        if (index >= 0 && index < IMPULSE_RESPONSE_COUNT)
+            body.impulse(*IMPULSE_RESPONSES[index]);
     }
 };
 
-class ChorusFilter : public MonoFilter<SimpleMonoFilterChannel<AudioEffectChorus>>
+/// @brief Vocoder with the chain's signal as the carrier. The modulator is
+/// patched in separately with modulator().
+class VocoderFilter : public Filter
 {
-#define CHORUS_DELAY_LENGTH (16 * AUDIO_BLOCK_SAMPLES)
-    // Allocate the delay lines for left and right channels
-    short l_delayline[CHORUS_DELAY_LENGTH];
-    short r_delayline[CHORUS_DELAY_LENGTH];
+    // modulator into input 2, delayed init like the Filter's own patches
+    alignas(AudioConnection) byte modulatorbuf[sizeof(AudioConnection)];
+    AudioConnection *modulatorPatch = NULL;
 
 public:
-    void begin()
+    AudioEffectVocoder vocoder;
+
+    const char *name() { return "vocoder"; }
+
+    AudioStream &outR() { return vocoder; }
+    AudioStream &outL() { return vocoder; }
+    AudioStream &inR() { return vocoder; }
+    AudioStream &inL() { return vocoder; }
+    uint8_t rightPort() { return 1; }
+    void process() { vocoder.update(); }
+    bool isNeutral() { return vocoder.isDry(); }
+
+    void modulator(AudioStream &source, uint8_t port)
     {
-        left.filter.begin(l_delayline, CHORUS_DELAY_LENGTH, 2);
-        right.filter.begin(r_delayline, CHORUS_DELAY_LENGTH, 2);
+        if (modulatorPatch)
+            modulatorPatch->~AudioConnection();
+        modulatorPatch = new (modulatorbuf) AudioConnection(source, port, vocoder, 2);
+    }
 
-        voices(0);
+    ~VocoderFilter()
+    {
+        if (modulatorPatch)
+            modulatorPatch->~AudioConnection();
     }
 
-    void voices(uint8_t v)
+    void mix(float wet) { vocoder.mix(wet); }
+    void bands(uint8_t n) { vocoder.bands(n); }
+    void release(float seconds) { vocoder.releaseTime(seconds); }
+};
+
+/// @brief Sine wavefolder, off until it is mixed in
+class WavefolderFilter : public FxRackFilter
+{
+public:
+    WavefolderProcessor folder;
+
+    const char *name() { return "fold"; }
+
+    void begin() { rack.add(folder); }
+
+    void drive(float d) { folder.drive(d); }
+    void mix(float wet) { folder.mix(wet); }
+};
+
+/// @brief Ring modulator, off until it is mixed in. The carrier is either
+/// a fixed frequency or follows the lowest key held down.
+class RingModFilter : public FxRackFilter
+{
+    bool tracking = true;
+
+public:
+    RingModProcessor ring;
+
+    const char *name() { return "ring"; }
+
+    void begin() { rack.add(ring); }
+
+    void mix(float wet) { ring.mix(wet); }
+
+    /// @brief a fixed carrier, or 0 to follow the keys
+    void carrier(float hz)
     {
-        left.filter.voices(v);
-        right.filter.voices(v);
+        tracking = hz <= 0;
+        if (!tracking)
+            ring.frequency(hz);
     }
+
+    /// @brief call with the lowest held key's frequency when the keys
+    /// change. With no keys held the carrier stays where it was, so
+    /// releases still ring.
+    void track(float hz)
+    {
+        if (tracking && hz > 0)
+            ring.frequency(hz);
+    }
+};
+
+/// @brief Envelope following wah, off until it is mixed in
+class AutoWahFilter : public FxRackFilter
+{
+public:
+    AutoWahProcessor wah;
+
+    const char *name() { return "wah"; }
+
+    void begin() { rack.add(wah); }
+
+    void mix(float wet) { wah.mix(wet); }
+    void sensitivity(float db) { wah.sensitivity(db); }
+    void resonance(float q) { wah.resonance(q); }
+    void release(float seconds) { wah.attackRelease(MIN_T, seconds); }
+};
+
+/// @brief Stereo phaser, off until it is given some depth
+class PhaserFilter : public FxRackFilter
+{
+public:
+    PhaserProcessor phaser;
+
+    const char *name() { return "phaser"; }
+
+    void begin() { rack.add(phaser); }
+
+    void depth(float d) { phaser.depth(d); }
+    void rate(float hz) { phaser.rate(hz); }
+    void stages(uint8_t n) { phaser.stages(n); }
+    void feedback(float fb) { phaser.feedback(fb); }
 };
 
-class LimiterFilter : public MonoFilter<SimpleMonoFilterChannel<AudioEffectDynamics>>
+/// @brief Tremolo and auto-pan, off until it is given some depth
+class TremoloFilter : public FxRackFilter
 {
+public:
+    TremoloProcessor tremolo;
+
+    const char *name() { return "tremolo"; }
+
+    void begin() { rack.add(tremolo); }
+
+    void depth(float d) { tremolo.depth(d); }
+    void rate(float hz) { tremolo.rate(hz); }
+    void pan(float spread) { tremolo.pan(spread); }
+    void shape(float s) { tremolo.shape(s); }
+};
+
+// Floats shared by all of the ResonatorFilter's strings; 8 strings down to
+// C4 need ~1400
+#define RESONATOR_ARENA 2048
+
+/// @brief Sympathetic strings tuned to the second row of the note grid,
+/// ringing along with whatever is played
+class ResonatorFilter : public FxRackFilter
+{
+    float arena[RESONATOR_ARENA];
 
 public:
+    ResonatorProcessor resonator;
+
+    const char *name() { return "resonator"; }
+
     void begin()
     {
-        left.filter.compression(-12.0, 0.01, 0.06, 4.0);
-        right.filter.compression(-12.0, 0.01, 0.06, 4.0);
+        resonator.begin(arena, RESONATOR_ARENA);
+        rack.add(resonator);
     }
+
+    void setScale(const float *frequencies)
+    {
+        resonator.tune(frequencies + ILayer::NOTES_PER_ROW, RESONATOR_STRINGS);
+    }
+
+    void mix(float wet) { resonator.mix(wet); }
+    void decay(float seconds) { resonator.decay(seconds); }
 };
 
 class DelayFilter : public Filter
 {
 
 public:
+    const char *name() { return "delay"; }
     AudioMixer4 dryL;
     AudioMixer4 dryR;
     AudioEffectDelay delayL;
@@ -203,6 +494,23 @@ public:
     AudioStream &inR() { return dryR; }
     AudioStream &inL() { return dryL; }
 
+    void process()
+    {
+        dryL.update();
+        dryR.update();
+        delayL.update();
+        delayR.update();
+        finalL.update();
+        finalR.update();
+    }
+
+    void park()
+    {
+        Filter::park();
+        NodeActivity::set(delayL, false);
+        NodeActivity::set(delayR, false);
+    }
+
     void begin()
     {
         setActive(false);
@@ -241,108 +549,78 @@ public:
     }
 };
 
-class FeedbackMonoFilterChannel : public MonoFilterChannel
-{
-public:
-    // Audio objects
-    AudioMixer4 baseMix;  // Mix input with feedback
-    AudioMixer4 driveMix; // Mix input with feedback
-    AudioEffectDelay delay;
-    AudioFilterStateVariable filter;
-    AudioMixer4 fbMix;    // Feedback mix stage
-    AudioMixer4 finalMix; // Final output mix
-
-    // patch cables
-
-    // Input to drive stage
-    AudioConnection patchInDrive{baseMix, driveMix};     // Input signal
-    AudioConnection patchFbDrive{fbMix, 0, driveMix, 1}; // Feedback signal
-
-    // Drive to delay
-    AudioConnection patchDriveDelay{driveMix, delay};
+// Samples a DelayLine needs to hold `ms` of audio, plus its interpolation
+// guard
+#define DELAY_LINE_LENGTH_MS(ms) ((uint32_t)((ms) * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f)) + 2)
 
-    // Delay to filter
-    AudioConnection patchDelayFilter{delay, filter};
+// Longest delay either channel of the FeeedbackFilter can be set to
+#define FEEDBACK_DELAY_MAX_MS 400
+// the lines run at half rate, see FeedbackDelayProcessor
+#define FEEDBACK_DELAY_LENGTH (DELAY_LINE_LENGTH_MS(FEEDBACK_DELAY_MAX_MS) / 2 + 2)
 
-    // Filter to feedback mix
-    AudioConnection patchFilterFb{filter, fbMix};
-
-    // Final outputs
-    AudioConnection patchDry{baseMix, finalMix};     // Dry path
-    AudioConnection patchWet{fbMix, 0, finalMix, 1}; // Wet path from feedback mix
-
-    virtual AudioStream &in() { return baseMix; }
-    virtual AudioStream &out() { return finalMix; }
-};
-
-class FeeedbackFilter : public Filter
+class FeeedbackFilter : public FxRackFilter
 {
+    // Both delay lines live in this one arena (~35KB) rather than
+    // in the AudioMemory pool
+    int16_t delayArena[2 * FEEDBACK_DELAY_LENGTH];
+
 public:
-    FeedbackMonoFilterChannel left;
-    FeedbackMonoFilterChannel right;
+    FeedbackDelayProcessor feedback;
 
-    // Cross-feedback to drive mix
-    AudioConnection patchXFbDriveL{right.fbMix, 0, left.driveMix, 2};
-    AudioConnection patchXFbDriveR{left.fbMix, 0, right.driveMix, 2};
-
-    AudioStream &outR() { return right.out(); }
-    AudioStream &outL() { return left.out(); }
-    AudioStream &inR() { return right.in(); }
-    AudioStream &inL() { return left.in(); }
+    const char *name() { return "delay"; }
+    bool isNeutral() { return feedback.isDry(); }
 
     void setDelayRight(float d)
     {
-        right.delay.delay(0, d);
+        feedback.delay(1, d);
     }
 
     void setDelayLeft(float d)
     {
-        left.delay.delay(0, d);
+        feedback.delay(0, d);
     }
 
     void setDrive(float amount)
     {
-        left.driveMix.gain(0, amount);
-        right.driveMix.gain(0, amount);
+        feedback.drive(amount);
     }
 
     void setFeedback(float fb)
     {
-        // Clamp feedback to 0.9 for safety
-        left.driveMix.gain(1, fb);
-        right.driveMix.gain(1, fb);
+        feedback.feedback(fb);
     }
 
     void setCrossFeedback(float xfb)
     {
-        // Clamp cross-feedback to 0.5 for safety
-        left.driveMix.gain(2, xfb);
-        right.driveMix.gain(2, xfb);
+        feedback.crossFeedback(xfb);
     }
 
     void setFilterFreq(float freq)
     {
-        left.filter.frequency(freq);
-        right.filter.frequency(freq);
+        feedback.frequency(freq);
     }
 
     void setFilterRes(float q)
     {
-        left.filter.resonance(q);
-        right.filter.resonance(q);
+        feedback.resonance(q);
     }
 
     void setWetDryMix(float wet)
     {
-        float dry = 1.0f - wet;
-        left.finalMix.gain(0, dry);
-        left.finalMix.gain(1, wet);
-        right.finalMix.gain(0, dry);
-        right.finalMix.gain(1, wet);
+        feedback.wetDry(wet);
+    }
+
+    void wetOnly(bool muted)
+    {
+        FxRackFilter::wetOnly(muted);
+        feedback.wetOnly(muted);
     }
 
     void begin()
     {
+        feedback.begin(delayArena, FEEDBACK_DELAY_LENGTH);
+        rack.add(feedback);
+
         setDelayRight(266);
         setDelayLeft(399);
 
@@ -356,4 +634,35 @@ public:
 
         setWetDryMix(0.7);
     }
-};
\ No newline at end of file
+};
+
+// Longest slice the FreezeFilter can loop
+#define FREEZE_MAX_MS 150
+#define FREEZE_FRAMES ((uint32_t)(FREEZE_MAX_MS * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f)) + FREEZE_CROSSFADE_SAMPLES + AUDIO_BLOCK_SAMPLES)
+
+class FreezeFilter : public Filter
+{
+    // interleaved stereo capture buffer (~26KB)
+    int16_t captureBuffer[2 * FREEZE_FRAMES];
+
+public:
+    const char *name() { return "freeze"; }
+    AudioEffectFreeze freeze;
+
+    AudioStream &outR() { return freeze; }
+    AudioStream &outL() { return freeze; }
+    AudioStream &inR() { return freeze; }
+    AudioStream &inL() { return freeze; }
+    uint8_t rightPort() { return 1; }
+    // never neutral, it has to keep recording to be ready to freeze
+    void process() { freeze.update(); }
+
+    void begin()
+    {
+        freeze.begin(captureBuffer, FREEZE_FRAMES);
+        freeze.sliceLength(FREEZE_MAX_MS);
+    }
+
+    void setSliceLength(float ms) { freeze.sliceLength(ms); }
+    void hold(bool frozen) { freeze.hold(frozen); }
+};
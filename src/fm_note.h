@@ -0,0 +1,49 @@
+#pragma once
+#include "inote.h"
+#include "layer.h"
+#include "synth_fm.h"
+
+/// @brief Two operator FM note. Unlike the waveform based notes nothing
+/// runs between notes: the node returns straight away once the carrier
+/// envelope has released.
+class FmNote : public INote
+{
+private:
+    AudioSynthFm fm;
+
+public:
+    void begin() override { fm.amplitude(0.5f); }
+
+    void noteOn() override { fm.noteOn(); }
+    void noteOff() override { fm.noteOff(); }
+
+    void enable() override {}
+    void disable() override { fm.stop(); }
+    void park(bool parked) override { NodeActivity::set(fm, !parked); }
+
+    void setFrequency(float freq) override { fm.frequency(freq); }
+    void preset(const FmPreset &p) { fm.preset(p); }
+    void indexScale(float scale) { fm.indexScale(scale); }
+
+    AudioStream &getOutputLeft() override { return fm; }
+    AudioStream &getOutputRight() override { return fm; }
+};
+
+class FmLayer : public Layer<FmNote>
+{
+public:
+    /// @brief pick one of FM_PRESETS for every note
+    void preset(int index)
+    {
+        if (index < 0 || index >= FM_PRESET_COUNT)
+            return;
+        for_all_notes([index](FmNote &note)
+                      { note.preset(FM_PRESETS[index]); });
+    }
+
+    void indexScale(float scale)
+    {
+        for_all_notes([scale](FmNote &note)
+                      { note.indexScale(scale); });
+    }
+};
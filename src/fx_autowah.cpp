@@ -0,0 +1,101 @@
+#include "fx_autowah.h"
+
+AutoWahProcessor::AutoWahProcessor()
+{
+    range(300.0f, 3000.0f);
+    attackRelease(MIN_T, 0.15f);
+}
+
+void AutoWahProcessor::resonance(float q)
+{
+    if (q < 0.7f)
+        q = 0.7f;
+    else if (q > 8.0f)
+        q = 8.0f;
+    damp = 1.0f / q;
+}
+
+void AutoWahProcessor::range(float lowHz, float highHz)
+{
+    // a single pass of the filter stays stable to about fs/6
+    const float limit = AUDIO_SAMPLE_RATE_EXACT / 6.0f;
+    if (highHz > limit)
+        highHz = limit;
+    if (lowHz < 20.0f)
+        lowHz = 20.0f;
+    if (lowHz > highHz)
+        lowHz = highHz;
+
+    float next[AUTOWAH_TABLE_SIZE];
+    for (int i = 0; i < AUTOWAH_TABLE_SIZE; i++)
+    {
+        // exponential sweep
+        float hz = lowHz * powf(highHz / lowHz, i / (float)(AUTOWAH_TABLE_SIZE - 1));
+        next[i] = 2.0f * sinf(3.14159265f * hz / AUDIO_SAMPLE_RATE_EXACT);
+    }
+
+    AudioNoInterrupts();
+    memcpy(table, next, sizeof(table));
+    AudioInterrupts();
+}
+
+void AutoWahProcessor::attackRelease(float attack, float release)
+{
+    alphaAttack = blockTimeToAlpha(constrain(attack, MIN_T, MAX_T));
+    alphaRelease = blockTimeToAlpha(constrain(release, MIN_T, MAX_T));
+}
+
+void AutoWahProcessor::reset()
+{
+    window.reset();
+    envelope = 0;
+    low[0] = low[1] = 0;
+    band[0] = band[1] = 0;
+}
+
+void AutoWahProcessor::process(float *left, float *right, size_t frames)
+{
+    const float wet = wetGain;
+    const float dry = 1.0f - wet;
+    const float d = damp;
+    // the bandpass peaks at Q, scale it back to unity
+    const float wd = wet * d;
+
+    for (size_t i = 0; i < frames; i++)
+        window.push(0.5f * (left[i] + right[i]));
+
+    // detector, once per block: where in the sweep the level puts us
+    float target = (window.db() - (topDb - SPAN_DB)) * (1.0f / SPAN_DB);
+    if (target < 0)
+        target = 0;
+    else if (target > 1)
+        target = 1;
+    const float start = envelope;
+    const float alpha = target > start ? alphaAttack : alphaRelease;
+    envelope = alpha * start + (1.0f - alpha) * target;
+
+    const size_t subBlocks = (frames + AUTOWAH_SUB_BLOCK - 1) / AUTOWAH_SUB_BLOCK;
+    for (size_t s = 0; s < subBlocks; s++)
+    {
+        // step towards the new envelope one sub-block at a time
+        float position = start + (envelope - start) * (s + 1) / subBlocks;
+        const float f = table[(int)(position * (AUTOWAH_TABLE_SIZE - 1) + 0.5f)];
+
+        size_t end = (s + 1) * AUTOWAH_SUB_BLOCK;
+        if (end > frames)
+            end = frames;
+        for (size_t i = s * AUTOWAH_SUB_BLOCK; i < end; i++)
+        {
+            float xl = left[i];
+            float xr = right[i];
+            low[0] += f * band[0];
+            low[1] += f * band[1];
+            float highL = xl - low[0] - d * band[0];
+            float highR = xr - low[1] - d * band[1];
+            band[0] += f * highL;
+            band[1] += f * highR;
+            left[i] = dry * xl + wd * band[0];
+            right[i] = dry * xr + wd * band[1];
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fx_dynamics.h"
+#include "processor.h"
+
+// Entries in the auto-wah's envelope -> filter coefficient table
+#define AUTOWAH_TABLE_SIZE 64
+
+// Samples per cutoff update
+#define AUTOWAH_SUB_BLOCK 16
+
+/// @brief Envelope follower driving a resonant bandpass: the harder you
+/// play, the higher the filter opens.
+///
+/// The level comes from the same exact running RMS DynamicsProcessor uses
+/// (over a shorter 10ms window), read once per block and smoothed with its
+/// attack/release constants. The filter is a Chamberlin state variable
+/// whose cutoff steps every AUTOWAH_SUB_BLOCK samples through a table of
+/// precomputed coefficients, so no trig runs in the audio interrupt.
+class AutoWahProcessor : public StereoProcessor
+{
+public:
+    AutoWahProcessor();
+
+    /// @brief level of the wah against the dry signal, 0 (off) to 1
+    void mix(float wet) { wetGain = wet; }
+    /// @brief input level in dBFS that opens the filter all the way;
+    /// it starts to open 36dB below that
+    void sensitivity(float db) { topDb = db; }
+    void resonance(float q);
+    /// @brief the sweep range; rebuilds the coefficient table
+    void range(float lowHz, float highHz);
+    void attackRelease(float attack, float release);
+
+    bool isNeutral() { return wetGain == 0.0f; }
+    void reset();
+    const char *name() { return "wah"; }
+
+    void process(float *left, float *right, size_t frames);
+
+private:
+    static const unsigned WINDOW = AUDIO_SAMPLE_RATE / 100;
+    static constexpr float SPAN_DB = 36.0f;
+
+    // in ~0.2ms steps
+    RmsWindow<WINDOW, 9> window;
+    // smoothed envelope as a table position, 0 to 1
+    float envelope = 0;
+
+    float alphaAttack;
+    float alphaRelease;
+
+    float table[AUTOWAH_TABLE_SIZE];
+
+    // filter state per channel
+    float low[2] = {0, 0};
+    float band[2] = {0, 0};
+
+    volatile float wetGain = 0.0f;
+    volatile float topDb = -12.0f;
+    volatile float damp = 1.0f / 3.0f;
+};
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fast_math.h"
+#include "processor.h"
+
+/// @brief Plain volume, shared by both channels
+class GainProcessor : public StereoProcessor
+{
+    volatile float level = 1.0f;
+
+public:
+    void gain(float g) { level = g; }
+
+    void process(float *left, float *right, size_t frames)
+    {
+        const float g = level;
+        for (size_t i = 0; i < frames; i++)
+        {
+            left[i] *= g;
+            right[i] *= g;
+        }
+    }
+
+    bool isNeutral() { return level == 1.0f; }
+    const char *name() { return "gain"; }
+};
+
+/// @brief Bit depth and sample rate reduction, same controls as
+/// AudioEffectBitcrusher. The sample and hold carries on across calls.
+class BitCrushProcessor : public StereoProcessor
+{
+    volatile uint8_t crushBits = 16;
+    volatile uint32_t holdSamples = 1;
+
+    uint32_t held = 0;
+    float heldLeft = 0;
+    float heldRight = 0;
+
+public:
+    void bits(uint8_t b)
+    {
+        if (b > 16)
+            b = 16;
+        else if (b == 0)
+            b = 1;
+        crushBits = b;
+    }
+
+    void sampleRate(float hz)
+    {
+        uint32_t n = 1;
+        if (hz > 0 && hz < AUDIO_SAMPLE_RATE_EXACT)
+            n = (uint32_t)(AUDIO_SAMPLE_RATE_EXACT / hz + 0.5f);
+        holdSamples = n;
+    }
+
+    void process(float *left, float *right, size_t frames)
+    {
+        const uint32_t hold = holdSamples;
+        // quantizing down like masking off the low bits of an int16 would
+        const float step = (float)(1 << (16 - crushBits));
+        const float invStep = 1.0f / step;
+
+        for (size_t i = 0; i < frames; i++)
+        {
+            if (held == 0)
+            {
+                heldLeft = floorf(left[i] * invStep) * step;
+                heldRight = floorf(right[i] * invStep) * step;
+            }
+            if (++held >= hold)
+                held = 0;
+            left[i] = heldLeft;
+            right[i] = heldRight;
+        }
+    }
+
+    bool isNeutral() { return crushBits == 16 && holdSamples == 1; }
+    void reset() { held = 0; }
+    const char *name() { return "crusher"; }
+};
+
+/// @brief Sine wavefolder. The drive sets how far along the fold curve
+/// (the shared sine table, a quarter turn per full scale) the signal
+/// reaches: at 1 full scale maps to full scale, at 4 a full scale signal
+/// folds back twice each way. One table lookup per sample.
+class WavefolderProcessor : public StereoProcessor
+{
+    volatile float driveGain = 1.0f;
+    volatile float wetGain = 0.0f;
+
+public:
+    void drive(float d) { driveGain = d; }
+    void mix(float wet) { wetGain = wet; }
+
+    void process(float *left, float *right, size_t frames)
+    {
+        // int16 scale to a 32 bit phase: a quarter turn (2^30) per 2^15
+        const float drive = driveGain * 32768.0f;
+        const float wet = wetGain;
+        const float dry = 1.0f - wet;
+        for (size_t i = 0; i < frames; i++)
+        {
+            float foldL = sine_q15((uint32_t)(int64_t)(left[i] * drive));
+            float foldR = sine_q15((uint32_t)(int64_t)(right[i] * drive));
+            left[i] = dry * left[i] + wet * foldL;
+            right[i] = dry * right[i] + wet * foldR;
+        }
+    }
+
+    bool isNeutral() { return wetGain == 0.0f; }
+    const char *name() { return "fold"; }
+};
+
+/// @brief Ring modulator with a sine carrier from the shared table. Both
+/// channels share the carrier.
+class RingModProcessor : public StereoProcessor
+{
+    uint32_t phase = 0;
+    volatile uint32_t increment = frequencyToPhaseIncrement(220.0f);
+    volatile float wetGain = 0.0f;
+
+public:
+    void frequency(float hz) { increment = frequencyToPhaseIncrement(hz); }
+    void mix(float wet) { wetGain = wet; }
+
+    void process(float *left, float *right, size_t frames)
+    {
+        const uint32_t inc = increment;
+        const float wet = wetGain * (1.0f / 32768.0f);
+        const float dry = 1.0f - wetGain;
+        for (size_t i = 0; i < frames; i++)
+        {
+            // dry and ring in one multiply per channel
+            float gain = dry + wet * sine_q15(phase);
+            phase += inc;
+            left[i] *= gain;
+            right[i] *= gain;
+        }
+    }
+
+    bool isNeutral() { return wetGain == 0.0f; }
+    void reset() { phase = 0; }
+    const char *name() { return "ring"; }
+};
@@ -0,0 +1,223 @@
+#include "fx_convolution.h"
+
+/// @brief a spectrum to Q15, scaled to its peak
+/// @return the factor that takes it back
+static float quantize(const float *in, int16_t *out)
+{
+    float peak = 0;
+    for (int k = 0; k < CONVOLUTION_FFT; k++)
+        if (fabsf(in[k]) > peak)
+            peak = fabsf(in[k]);
+    if (peak == 0)
+    {
+        memset(out, 0, CONVOLUTION_FFT * sizeof(int16_t));
+        return 0;
+    }
+    const float toQ15 = 32767.0f / peak;
+    for (int k = 0; k < CONVOLUTION_FFT; k++)
+    {
+        float q = in[k] * toQ15;
+        out[k] = (int16_t)(q < 0 ? q - 0.5f : q + 0.5f);
+    }
+    return peak / 32767.0f;
+}
+
+ConvolutionProcessor::ConvolutionProcessor()
+{
+#ifdef CONVOLUTION_USE_CMSIS
+    arm_rfft_fast_init_f32(&fft, CONVOLUTION_FFT);
+#endif
+    reset();
+}
+
+void ConvolutionProcessor::impulse(const ImpulseResponse &ir)
+{
+    uint16_t length = ir.length;
+    if (length > CONVOLUTION_MAX_PARTITIONS * CONVOLUTION_PARTITION)
+        length = CONVOLUTION_MAX_PARTITIONS * CONVOLUTION_PARTITION;
+    uint8_t count = (length + CONVOLUTION_PARTITION - 1) / CONVOLUTION_PARTITION;
+
+    // silence the wet path while the spectra are rewritten
+    AudioNoInterrupts();
+    partitions = 0;
+    AudioInterrupts();
+
+    float taps[CONVOLUTION_FFT];
+    float spectrum[CONVOLUTION_FFT];
+    for (uint8_t p = 0; p < count; p++)
+    {
+        // each partition zero padded to the FFT size
+        memset(taps, 0, sizeof(taps));
+        for (uint16_t i = 0; i < CONVOLUTION_PARTITION; i++)
+        {
+            uint16_t n = p * CONVOLUTION_PARTITION + i;
+            if (n < length)
+                taps[i] = ir.samples[n] * ir.scale;
+        }
+        forward(taps, spectrum);
+        responseScale[p] = quantize(spectrum, response[p]);
+    }
+
+    AudioNoInterrupts();
+    reset();
+    partitions = count;
+    AudioInterrupts();
+}
+
+void ConvolutionProcessor::reset()
+{
+    memset(history, 0, sizeof(history));
+    memset(spectra, 0, sizeof(spectra));
+    memset(spectraScale, 0, sizeof(spectraScale));
+}
+
+void ConvolutionProcessor::process(float *left, float *right, size_t frames)
+{
+    for (size_t i = 0; i + CONVOLUTION_PARTITION <= frames; i += CONVOLUTION_PARTITION)
+        partition(left + i, right + i);
+}
+
+void ConvolutionProcessor::partition(float *left, float *right)
+{
+    const int N = CONVOLUTION_PARTITION;
+    const uint8_t count = partitions;
+
+    memmove(history, history + N, N * sizeof(float));
+    for (int i = 0; i < N; i++)
+        history[N + i] = 0.5f * (left[i] + right[i]);
+
+    newest = (newest + 1) % CONVOLUTION_MAX_PARTITIONS;
+    memcpy(scratch, history, sizeof(history));
+    forward(scratch, sum);
+    spectraScale[newest] = quantize(sum, spectra[newest]);
+
+    // sum of each IR partition times the input from that many blocks ago.
+    // The products are exact in int32: two full scale Q15 products add up
+    // to just under 2^31.
+    memset(sum, 0, sizeof(sum));
+    for (uint8_t p = 0; p < count; p++)
+    {
+        const uint8_t slot = (newest + CONVOLUTION_MAX_PARTITIONS - p) % CONVOLUTION_MAX_PARTITIONS;
+        const float scale = spectraScale[slot] * responseScale[p];
+        if (scale == 0)
+            continue;
+        const int16_t *x = spectra[slot];
+        const int16_t *h = response[p];
+        // DC and Nyquist are real, packed into the first pair
+        sum[0] += scale * (float)((int32_t)x[0] * h[0]);
+        sum[1] += scale * (float)((int32_t)x[1] * h[1]);
+        for (int k = 2; k < CONVOLUTION_FFT; k += 2)
+        {
+            int32_t re = (int32_t)x[k] * h[k] - (int32_t)x[k + 1] * h[k + 1];
+            int32_t im = (int32_t)x[k] * h[k + 1] + (int32_t)x[k + 1] * h[k];
+            sum[k] += scale * (float)re;
+            sum[k + 1] += scale * (float)im;
+        }
+    }
+    inverse(sum, scratch);
+
+    // overlap-save: the second half is this block's output
+    const float wet = wetGain;
+    const float dry = dryGain;
+    for (int i = 0; i < N; i++)
+    {
+        float y = wet * scratch[N + i];
+        left[i] = dry * left[i] + y;
+        right[i] = dry * right[i] + y;
+    }
+}
+
+#ifdef CONVOLUTION_USE_CMSIS
+
+void ConvolutionProcessor::forward(float *in, float *out)
+{
+    arm_rfft_fast_f32(&fft, in, out, 0);
+}
+
+void ConvolutionProcessor::inverse(float *in, float *out)
+{
+    arm_rfft_fast_f32(&fft, in, out, 1);
+}
+
+#else
+
+// in place complex FFT; the inverse is unscaled
+static void complexFft(float *re, float *im, bool inverse)
+{
+    const int n = CONVOLUTION_FFT;
+    for (int i = 1, j = 0; i < n; i++)
+    {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+        {
+            float t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+    for (int len = 2; len <= n; len <<= 1)
+    {
+        float angle = (inverse ? 2.0f : -2.0f) * 3.14159265f / len;
+        for (int i = 0; i < n; i += len)
+        {
+            for (int k = 0; k < len / 2; k++)
+            {
+                float wr = cosf(angle * k);
+                float wi = sinf(angle * k);
+                int a = i + k;
+                int b = a + len / 2;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
+
+// same packing as arm_rfft_fast_f32
+void ConvolutionProcessor::forward(float *in, float *out)
+{
+    float re[CONVOLUTION_FFT];
+    float im[CONVOLUTION_FFT] = {};
+    memcpy(re, in, sizeof(re));
+    complexFft(re, im, false);
+    out[0] = re[0];
+    out[1] = re[CONVOLUTION_FFT / 2];
+    for (int k = 1; k < CONVOLUTION_FFT / 2; k++)
+    {
+        out[2 * k] = re[k];
+        out[2 * k + 1] = im[k];
+    }
+}
+
+void ConvolutionProcessor::inverse(float *in, float *out)
+{
+    const int n = CONVOLUTION_FFT;
+    float re[CONVOLUTION_FFT];
+    float im[CONVOLUTION_FFT];
+    re[0] = in[0];
+    im[0] = 0;
+    re[n / 2] = in[1];
+    im[n / 2] = 0;
+    for (int k = 1; k < n / 2; k++)
+    {
+        re[k] = in[2 * k];
+        im[k] = in[2 * k + 1];
+        re[n - k] = in[2 * k];
+        im[n - k] = -in[2 * k + 1];
+    }
+    complexFft(re, im, true);
+    for (int i = 0; i < n; i++)
+        out[i] = re[i] / n;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "processor.h"
+#include "impulse_responses.h"
+
+// The M4F has CMSIS-DSP in the core; host builds get a plain radix-2 FFT
+#if defined(__SAMD51__)
+#include <arm_math.h>
+#define CONVOLUTION_USE_CMSIS
+#endif
+
+// samples per partition, one audio block, so no latency is added
+#define CONVOLUTION_PARTITION AUDIO_BLOCK_SAMPLES
+#define CONVOLUTION_FFT (2 * CONVOLUTION_PARTITION)
+// longest IR, 2304 taps (~52ms)
+#define CONVOLUTION_MAX_PARTITIONS 18
+
+/// @brief Convolution with a short impulse response, e.g. an instrument
+/// body, by uniformly partitioned overlap-save FFT convolution.
+///
+/// The IR is cut into block sized partitions and each is transformed once,
+/// when the IR is loaded. Every block the input (summed to mono) is
+/// transformed once, multiplied with each IR partition against the spectrum
+/// of the input that many blocks ago, and transformed back. The cost is
+/// one forward and one inverse 256 point real FFT plus 129 complex
+/// multiply-adds per partition, fixed for a given IR length.
+///
+/// Both sets of spectra are kept as Q15 with one float scale per
+/// spectrum, which halves their RAM. Each spectrum is scaled to its own
+/// peak, so the quiet late partitions keep their resolution. Against a
+/// direct convolution with the same IR the error is 78-90dB down,
+/// measured in test/test_convolution.cpp.
+///
+/// The wet signal goes to both channels. Frames are processed in whole
+/// partitions; the rack always passes whole blocks. Memory is ~22KB, most
+/// of it the two sets of spectra.
+class ConvolutionProcessor : public StereoProcessor
+{
+public:
+    ConvolutionProcessor();
+
+    /// @brief load an impulse response; anything past the longest
+    /// supported length is dropped. Call from the main loop.
+    void impulse(const ImpulseResponse &ir);
+
+    /// @brief wet level; dry is 1 - wet
+    void mix(float wet)
+    {
+        wet = constrain(wet, 0.0f, 1.0f);
+        wetGain = wet;
+        dryGain = 1.0f - wet;
+    }
+
+    void process(float *left, float *right, size_t frames);
+    bool isNeutral() { return wetGain == 0 || partitions == 0; }
+    void reset();
+    const char *name() { return "body"; }
+
+private:
+    // the last two partitions of input, oldest first
+    float history[CONVOLUTION_FFT];
+    // spectra of the IR partitions, and a ring of the recent input spectra;
+    // both packed like arm_rfft_fast_f32 leaves them, as Q15 times a scale
+    int16_t response[CONVOLUTION_MAX_PARTITIONS][CONVOLUTION_FFT];
+    int16_t spectra[CONVOLUTION_MAX_PARTITIONS][CONVOLUTION_FFT];
+    float responseScale[CONVOLUTION_MAX_PARTITIONS];
+    float spectraScale[CONVOLUTION_MAX_PARTITIONS];
+    uint8_t newest = 0;
+    volatile uint8_t partitions = 0;
+
+    float scratch[CONVOLUTION_FFT];
+    float sum[CONVOLUTION_FFT];
+
+    volatile float wetGain = 0;
+    volatile float dryGain = 1.0f;
+
+#ifdef CONVOLUTION_USE_CMSIS
+    arm_rfft_fast_instance_f32 fft;
+#endif
+
+    // both clobber their input
+    void forward(float *in, float *out);
+    void inverse(float *in, float *out);
+    void partition(float *left, float *right);
+};
@@ -0,0 +1,105 @@
+/* Audio Library for Teensy 3.X
+ * Dynamics Processor (Gate, Compressor & Limiter)
+ * Copyright (c) 2017, Marc Paquette (marc@dacsystemes.com)
+ * Based on analyse_rms & mixer objects by Paul Stoffregen
+ *
+ * Development of this audio library was funded by PJRC.COM, LLC by sales of
+ * Teensy and Audio Adaptor boards.  Please support PJRC's efforts to develop
+ * open source software by purchasing Teensy or other PJRC products.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice, development funding notice, and this permission
+ * notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#if !defined(KINETISL)
+
+#include "fx_dynamics.h"
+
+void DynamicsProcessor::process(const float *in, float *out, size_t frames)
+{
+    if (!gateEnabled && !compEnabled && !limiterEnabled)
+    {
+        if (out != in)
+            memcpy(out, in, frames * sizeof(float));
+        return;
+    }
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        float sample = in[i];
+
+        window.push(sample);
+        float inputdb = window.db();
+
+        // Gate
+        if (gateEnabled)
+        {
+            if (inputdb >= gateThresholdOpen)
+                gatedb = (aGateAttack * gatedb) + (aOneMinusGateAttack * MAX_DB);
+            else if (inputdb < gateThresholdClose)
+                gatedb = (aGateRelease * gatedb) + (aOneMinusGateRelease * MIN_DB);
+        }
+        else
+            gatedb = MAX_DB;
+
+        // Compressor
+        if (compEnabled)
+        {
+            float attdb = MAX_DB; // Below knee
+            if (inputdb >= aLowKnee)
+            {
+                if (inputdb <= aHighKnee)
+                {
+                    // Knee transition
+                    float knee = inputdb - aLowKnee;
+                    attdb = aKneeRatio * knee * knee * aTwoKneeWidth;
+                }
+                else
+                {
+                    // Above knee
+                    attdb = compThreshold + ((inputdb - compThreshold) * compRatio) - inputdb;
+                }
+            }
+            if (attdb <= compdb)
+                compdb = (aCompAttack * compdb) + (aOneMinusCompAttack * attdb);
+            else
+                compdb = (aCompRelease * compdb) + (aOneMinusCompRelease * attdb);
+        }
+        else
+            compdb = MAX_DB;
+
+        // Brickwall Limiter
+        if (limiterEnabled)
+        {
+            float outdb = inputdb + compdb + makeupdb;
+            if (outdb >= limitThreshold)
+                limitdb = (aLimitAttack * limitdb) +
+                          (aOneMinusLimitAttack * (limitThreshold - outdb));
+            else
+                limitdb *= aLimitRelease;
+        }
+        else
+            limitdb = MAX_DB;
+
+        // Compute linear gain
+        float totalGain = gatedb + compdb + makeupdb + limitdb;
+
+        out[i] = sample * dbToUnit(totalGain);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -26,13 +26,15 @@
  * THE SOFTWARE.
  */
 
-#ifndef effect_dynamics_h_
-#define effect_dynamics_h_
+#ifndef fx_dynamics_h_
+#define fx_dynamics_h_
 
 #if !defined(KINETISL)
 
 #include "Arduino.h"
 #include "AudioStream.h"
+#include "fast_math.h"
+#include "processor.h"
 
 #define MIN_DB -110.0f
 #define MAX_DB 0.0f
@@ -43,10 +45,71 @@
 #define RATIO_OFF 1.0f
 #define RATIO_INFINITY 60.0f
 
-class AudioEffectDynamics : public AudioStream
+// Computes smoothing time constants for a 10% to 90% change, for an
+// envelope updated once per block
+inline float blockTimeToAlpha(float time)
+{
+    return fast_expf(-0.9542f / (((float)AUDIO_SAMPLE_RATE_EXACT / (float)AUDIO_BLOCK_SAMPLES) * time));
+}
+
+/// @brief Running RMS over the last N samples (rounded down to whole
+/// steps), moving STEP samples at a time. Each step keeps only its mean
+/// square, 4 bytes a step rather than 2 a sample. The sums are kept exact
+/// in integers, so it never drifts however long it runs.
+template <unsigned N, unsigned STEP = 1>
+class RmsWindow
+{
+    static const unsigned STEPS = N / STEP;
+
+    uint64_t sumOfMeanSquares = 0;
+    // mean squares of the last STEPS whole steps
+    uint32_t stepMeanSquares[STEPS] = {0};
+    uint16_t stepIndex = 0;
+    // the step being filled
+    uint64_t partialSum = 0;
+    uint16_t partialCount = 0;
+
+public:
+    inline void push(float sample)
+    {
+        int32_t s16 = saturate16(sample);
+        partialSum += (uint32_t)(s16 * s16);
+        if (++partialCount < STEP)
+            return;
+        uint32_t meanSquare = (uint32_t)(partialSum / STEP);
+        sumOfMeanSquares -= stepMeanSquares[stepIndex];
+        sumOfMeanSquares += meanSquare;
+        stepMeanSquares[stepIndex] = meanSquare;
+        stepIndex = (stepIndex + 1) % STEPS;
+        partialSum = 0;
+        partialCount = 0;
+    }
+
+    /// @brief RMS level in dBFS, MIN_DB for silence
+    inline float db() const
+    {
+        float rms = sqrtf(sumOfMeanSquares / float(STEPS)) / 32768.0f;
+        return rms > 0 ? unitToDb(rms) : MIN_DB;
+    }
+
+    void reset()
+    {
+        sumOfMeanSquares = 0;
+        memset(stepMeanSquares, 0, sizeof(stepMeanSquares));
+        stepIndex = 0;
+        partialSum = 0;
+        partialCount = 0;
+    }
+};
+
+// Ported from AudioEffectDynamics to a kernel that takes any number of
+// frames per call; run it with AudioEffectMonoKernel<DynamicsProcessor>.
+// The smoothing coefficients are still per sample at the block rate based
+// constants the node used, so it sounds the same.
+class DynamicsProcessor : public MonoProcessor
 {
 public:
-    AudioEffectDynamics(void) : AudioStream(1, inputQueueArray)
+    DynamicsProcessor(void)
     {
 
         gate();
@@ -145,9 +208,9 @@ public:
         makeupdb = constrain(gain, -12.0f, 24.0f);
     }
 
-private:
-    audio_block_t *inputQueueArray[1];
+    void process(const float *in, float *out, size_t frames);
 
+private:
     bool gateEnabled = false;
     float gateThresholdOpen;
     float gateThresholdClose;
@@ -183,9 +246,8 @@ private:
     float aOneMinusLimitAttack;
     float aLimitRelease;
     const static unsigned int sampleBufferSize = AUDIO_SAMPLE_RATE / 10; // number of samples to use for running RMS calulation = 1/10th of a second
-    u_int64_t sumOfSamplesSquared = 0;
-    uint32_t samplesSquared[sampleBufferSize] = {0};
-    uint16_t sampleIndex = 0;
+    // in ~1ms steps, ~360 bytes rather than 8.8KB a sample at a time
+    RmsWindow<sampleBufferSize, 49> window;
 
     void computeMakeupGain()
     {
@@ -195,13 +257,7 @@ private:
         }
     }
 
-    // Computes smoothing time constants for a 10% to 90% change
-    float timeToAlpha(float time)
-    {
-        return expf(-0.9542f / (((float)AUDIO_SAMPLE_RATE_EXACT / (float)AUDIO_BLOCK_SAMPLES) * time));
-    }
-
-    virtual void update(void);
+    float timeToAlpha(float time) { return blockTimeToAlpha(time); }
 };
 #endif
 
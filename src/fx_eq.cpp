@@ -0,0 +1,161 @@
+#include "fx_eq.h"
+
+EqProcessor::EqProcessor()
+{
+    bands[0] = {EQ_LOW_SHELF, 120.0f, 0.0f, 0.7f};
+    bands[1] = {EQ_PEAK, 500.0f, 0.0f, 1.0f};
+    bands[2] = {EQ_PEAK, 2500.0f, 0.0f, 1.0f};
+    bands[3] = {EQ_HIGH_SHELF, 8000.0f, 0.0f, 0.7f};
+
+    for (uint8_t b = 0; b < EQ_BANDS; b++)
+    {
+        float *c = coeffs + 5 * b;
+        c[0] = 1.0f;
+        c[1] = c[2] = c[3] = c[4] = 0.0f;
+    }
+
+#ifdef EQ_USE_CMSIS
+    arm_biquad_cascade_df1_init_f32(&cascadeL, EQ_BANDS, coeffs, stateL);
+    arm_biquad_cascade_df1_init_f32(&cascadeR, EQ_BANDS, coeffs, stateR);
+#endif
+    reset();
+}
+
+void EqProcessor::band(uint8_t b, float hz, float db, float q)
+{
+    if (b >= EQ_BANDS)
+        return;
+    bands[b].hz = hz;
+    bands[b].db = db;
+    bands[b].q = q;
+    update(b);
+}
+
+void EqProcessor::frequency(uint8_t b, float hz)
+{
+    if (b >= EQ_BANDS)
+        return;
+    bands[b].hz = hz;
+    update(b);
+}
+
+void EqProcessor::gain(uint8_t b, float db)
+{
+    if (b >= EQ_BANDS)
+        return;
+    bands[b].db = db;
+    update(b);
+}
+
+void EqProcessor::q(uint8_t b, float q)
+{
+    if (b >= EQ_BANDS)
+        return;
+    bands[b].q = q;
+    update(b);
+}
+
+// RBJ audio EQ cookbook
+void EqProcessor::update(uint8_t b)
+{
+    Band &band = bands[b];
+
+    float hz = band.hz;
+    if (hz < 20.0f)
+        hz = 20.0f;
+    else if (hz > AUDIO_SAMPLE_RATE_EXACT * 0.45f)
+        hz = AUDIO_SAMPLE_RATE_EXACT * 0.45f;
+    float q = band.q < 0.1f ? 0.1f : band.q;
+
+    float A = powf(10.0f, band.db / 40.0f);
+    float w0 = 2.0f * 3.14159265f * hz / AUDIO_SAMPLE_RATE_EXACT;
+    float cosw = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+
+    float b0, b1, b2, a0, a1, a2;
+    if (band.db == 0.0f)
+    {
+        b0 = a0 = 1.0f;
+        b1 = b2 = a1 = a2 = 0.0f;
+    }
+    else if (band.type == EQ_PEAK)
+    {
+        b0 = 1.0f + alpha * A;
+        b1 = -2.0f * cosw;
+        b2 = 1.0f - alpha * A;
+        a0 = 1.0f + alpha / A;
+        a1 = -2.0f * cosw;
+        a2 = 1.0f - alpha / A;
+    }
+    else
+    {
+        float sqrtA2alpha = 2.0f * sqrtf(A) * alpha;
+        float sign = band.type == EQ_LOW_SHELF ? 1.0f : -1.0f;
+        // the high shelf is the low shelf with the cosine terms flipped
+        b0 = A * ((A + 1.0f) - sign * (A - 1.0f) * cosw + sqrtA2alpha);
+        b1 = sign * 2.0f * A * ((A - 1.0f) - sign * (A + 1.0f) * cosw);
+        b2 = A * ((A + 1.0f) - sign * (A - 1.0f) * cosw - sqrtA2alpha);
+        a0 = (A + 1.0f) + sign * (A - 1.0f) * cosw + sqrtA2alpha;
+        a1 = -sign * 2.0f * ((A - 1.0f) + sign * (A + 1.0f) * cosw);
+        a2 = (A + 1.0f) + sign * (A - 1.0f) * cosw - sqrtA2alpha;
+    }
+
+    float c[5] = {b0 / a0, b1 / a0, b2 / a0, -a1 / a0, -a2 / a0};
+
+    bool allFlat = true;
+    for (uint8_t i = 0; i < EQ_BANDS; i++)
+        if (bands[i].db != 0.0f)
+            allFlat = false;
+
+    AudioNoInterrupts();
+    memcpy(coeffs + 5 * b, c, sizeof(c));
+    flat = allFlat;
+    AudioInterrupts();
+}
+
+void EqProcessor::reset()
+{
+    memset(stateL, 0, sizeof(stateL));
+    memset(stateR, 0, sizeof(stateR));
+}
+
+#ifdef EQ_USE_CMSIS
+
+void EqProcessor::process(float *left, float *right, size_t frames)
+{
+    arm_biquad_cascade_df1_f32(&cascadeL, left, left, frames);
+    arm_biquad_cascade_df1_f32(&cascadeR, right, right, frames);
+}
+
+#else
+
+void EqProcessor::cascade(const float *c, float *state, float *samples, size_t frames)
+{
+    for (uint8_t s = 0; s < EQ_BANDS; s++, c += 5, state += 4)
+    {
+        const float b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        float x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+        for (size_t i = 0; i < frames; i++)
+        {
+            float x = samples[i];
+            float y = b0 * x + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            samples[i] = y;
+        }
+        state[0] = x1;
+        state[1] = x2;
+        state[2] = y1;
+        state[3] = y2;
+    }
+}
+
+void EqProcessor::process(float *left, float *right, size_t frames)
+{
+    cascade(coeffs, stateL, left, frames);
+    cascade(coeffs, stateR, right, frames);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include "fx_feedback_delay.h"
+
+void FeedbackDelayProcessor::process(float *left, float *right, size_t frames)
+{
+    Channel &l = channels[0];
+    Channel &r = channels[1];
+    if (l.line.size() == 0)
+        return;
+
+    // snapshot the parameters once per call
+    const float drive = driveGain;
+    const float fbGain = feedbackGain;
+    const float xfbGain = crossFeedbackGain;
+    const float f = filterF;
+    const float damp = filterDamp;
+    const float wet = wetGain;
+    const float dry = dryGain;
+
+    l.tap.beginBlock();
+    r.tap.beginBlock();
+
+    float fbL = fb[0];
+    float fbR = fb[1];
+    bool write = writeNext;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        float xl = left[i];
+        float xr = right[i];
+
+        // drive stage, with last sample's filter outputs as feedback
+        float drivenL = l.clipper.tick(drive * xl + fbGain * fbL + xfbGain * fbR);
+        float drivenR = r.clipper.tick(drive * xr + fbGain * fbR + xfbGain * fbL);
+
+        // into the lines at half rate; a tap read just after a write
+        // reaches half a line sample further back, so the delay is the
+        // same on either phase
+        l.decimator.push(drivenL);
+        r.decimator.push(drivenR);
+        float offset = 0;
+        if (write)
+        {
+            l.line.write(saturate16(l.decimator.output()));
+            r.line.write(saturate16(r.decimator.output()));
+            offset = 0.5f;
+        }
+        write = !write;
+
+        float delayedL = l.tap.read(l.line, offset);
+        float delayedR = r.tap.read(r.line, offset);
+
+        // Chamberlin state variable lowpass, run twice per sample like
+        // AudioFilterStateVariable so it stays stable up to fs/2.5
+        for (int k = 0; k < 2; k++)
+        {
+            l.low += f * l.band;
+            r.low += f * r.band;
+            float highL = delayedL - l.low - damp * l.band;
+            float highR = delayedR - r.low - damp * r.band;
+            l.band += f * highL;
+            r.band += f * highR;
+        }
+        fbL = l.low;
+        fbR = r.low;
+
+        left[i] = dry * xl + wet * fbL;
+        right[i] = dry * xr + wet * fbR;
+    }
+
+    fb[0] = fbL;
+    fb[1] = fbR;
+    writeNext = write;
+}
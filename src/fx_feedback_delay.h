@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "delay_line.h"
+#include "fast_math.h"
+#include "fx_soft_clip.h"
+#include "processor.h"
+
+/// @brief Stereo drive -> delay -> state variable lowpass -> feedback loop
+/// with cross feedback and a wet/dry mix, all in one per-sample loop.
+///
+/// This is the FeedbackMonoFilterChannel graph (four mixers, a delay and a
+/// filter per channel) collapsed into a single processor. Because the loop
+/// is closed inside process() the feedback is sample accurate rather than
+/// picking up an extra block of latency from the graph cycle. The signal
+/// going into the delay lines goes through a 2x oversampled soft clipper,
+/// so a driven, self-oscillating loop rounds off instead of folding
+/// harmonics back down as aliases; the output isn't clipped.
+///
+/// The delay lines hold the loop at half the sample rate, through a
+/// halfband decimator, and are read back with linear interpolation. Only
+/// the lowpassed taps are heard or fed back, and the loop filter tops out
+/// at fs/4 = 11kHz, so this loses nothing audible and halves the RAM.
+///
+/// Delay time changes crossfade between two read taps (~46 ms) so tempo
+/// changes don't click.
+class FeedbackDelayProcessor : public StereoProcessor
+{
+public:
+
+    /// @brief hand over the storage for both delay lines, which must
+    /// outlive this object. Each channel gets half, and holds twice its
+    /// length in samples of delay.
+    void begin(int16_t *arena, uint32_t lengthPerChannel)
+    {
+        AudioNoInterrupts();
+        channels[0].line.begin(arena, lengthPerChannel);
+        channels[1].line.begin(arena + lengthPerChannel, lengthPerChannel);
+        AudioInterrupts();
+    }
+
+    /// @brief drop everything in the delay lines and the filters
+    void reset()
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            channels[c].line.clear();
+            channels[c].clipper.reset();
+            channels[c].decimator.reset();
+            channels[c].low = 0;
+            channels[c].band = 0;
+            fb[c] = 0;
+        }
+        writeNext = false;
+    }
+
+    void delay(uint8_t channel, float milliseconds)
+    {
+        if (channel > 1)
+            return;
+        // the clipper's and decimator's latency are part of the loop, take
+        // them off the tap, along with the half sample process() adds
+        // reading just after a write
+        float samples = milliseconds * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f) -
+                        SOFT_CLIP_LATENCY - HalfbandDecimator::LATENCY - 1;
+        float lineSamples = samples * 0.5f;
+        float limit = channels[channel].line.maxDelay() - 0.5f;
+        if (lineSamples < 0)
+            lineSamples = 0;
+        if (lineSamples > limit)
+            lineSamples = limit;
+        channels[channel].tap.set(lineSamples);
+    }
+
+    void drive(float amount) { driveGain = amount; }
+    void feedback(float fb) { feedbackGain = fb; }
+    void crossFeedback(float xfb) { crossFeedbackGain = xfb; }
+
+    // Same ranges as AudioFilterStateVariable, but no higher than the
+    // half rate delay lines carry
+    void frequency(float freq)
+    {
+        if (freq < 20.0f)
+            freq = 20.0f;
+        else if (freq > AUDIO_SAMPLE_RATE_EXACT / 4.0f)
+            freq = AUDIO_SAMPLE_RATE_EXACT / 4.0f;
+        // the filter runs twice per sample, hence the 2x in the denominator
+        filterF = 2.0f * fast_sinf(3.14159265f * freq / (2.0f * AUDIO_SAMPLE_RATE_EXACT));
+    }
+
+    void resonance(float q)
+    {
+        if (q < 0.7f)
+            q = 0.7f;
+        else if (q > 5.0f)
+            q = 5.0f;
+        filterDamp = 1.0f / q;
+    }
+
+    void wetDry(float wet)
+    {
+        wetGain = wet;
+        dryGain = dryMuted ? 0.0f : 1.0f - wet;
+    }
+
+    /// @brief true when none of the delay is mixed in
+    bool isDry() const { return wetGain == 0.0f; }
+
+    /// @brief mute the dry path, for use on a send bus
+    void wetOnly(bool muted)
+    {
+        dryMuted = muted;
+        wetDry(wetGain);
+    }
+
+    bool isNeutral() { return wetGain == 0.0f && !dryMuted; }
+    const char *name() { return "delay"; }
+
+    void process(float *left, float *right, size_t frames);
+
+private:
+    struct Channel
+    {
+        HalfbandDecimator decimator;
+        DelayLine line;
+        CrossfadingTap tap;
+        SoftClipper clipper;
+
+        // filter state
+        float low = 0;
+        float band = 0;
+    };
+
+    Channel channels[2];
+
+    // last filter output of each channel, fed back into the drive stage
+    float fb[2] = {0, 0};
+
+    // whether the next sample is written to the delay lines
+    bool writeNext = false;
+
+    volatile float driveGain = 1.0f;
+    volatile float feedbackGain = 0.4f;
+    volatile float crossFeedbackGain = 0.2f;
+    volatile float filterF = 0.1f;
+    volatile float filterDamp = 1.0f / 0.7f;
+    volatile float wetGain = 0.7f;
+    volatile float dryGain = 0.3f;
+    bool dryMuted = false;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include "fast_math.h"
+
+/// @brief A sine LFO for modulating effects, evaluated at control rate.
+///
+/// The sine is only looked up at block boundaries; in between, effects
+/// ramp linearly from one value to the next, which at a block of ~3ms is
+/// indistinguishable from per-sample evaluation for any sensible rate. One
+/// LFO can feed several channels at different phase offsets, still at one
+/// lookup per channel per block.
+class ControlLfo
+{
+    uint32_t phase = 0;
+    volatile uint32_t increment = 0;
+
+public:
+    /// @brief a linear ramp across one block: value(i) = start + step * i
+    struct Segment
+    {
+        float start;
+        float step;
+
+        float end(size_t frames) const { return start + step * frames; }
+    };
+
+    void rate(float hz) { increment = frequencyToPhaseIncrement(hz); }
+    void reset() { phase = 0; }
+
+    /// @brief the coming block's ramp, -1 to 1, at a phase offset (a full
+    /// turn is 2^32). Doesn't move the LFO on.
+    Segment segment(size_t frames, uint32_t offset = 0) const
+    {
+        float a = fast_sin_phase(phase + offset);
+        float b = fast_sin_phase(phase + offset + increment * frames);
+        return {a, (b - a) / frames};
+    }
+
+    /// @brief move on to the next block
+    void advance(size_t frames) { phase += increment * frames; }
+};
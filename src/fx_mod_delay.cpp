@@ -0,0 +1,55 @@
+#include "fx_mod_delay.h"
+
+void ModDelayProcessor::process(float *left, float *right, size_t n)
+{
+    if (!buffer)
+        return;
+
+    const ModDelayMode m = modMode;
+    const uint8_t v = chorusVoices;
+
+    const bool dry = m != MOD_DELAY_VIBRATO;
+    const int chorusTaps = v > 1 ? v - 1 : 0;
+    const int taps = (dry ? 1 : 0) + (m != MOD_DELAY_OFF ? 1 : 0) + chorusTaps;
+    const float gain = 1.0f / taps;
+    const float modBase = m == MOD_DELAY_VIBRATO ? VIBRATO_BASE : FLANGE_BASE;
+    const float modDepth = m == MOD_DELAY_VIBRATO ? VIBRATO_DEPTH : FLANGE_DEPTH;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        float xl = left[i];
+        float xr = right[i];
+
+        int16_t *w = buffer + 2 * writeIndex;
+        w[0] = saturate16(xl);
+        w[1] = saturate16(xr);
+
+        float s = fast_sin_phase(lfoPhase);
+        float l = dry ? xl : 0.0f;
+        float r = dry ? xr : 0.0f;
+
+        if (m != MOD_DELAY_OFF)
+        {
+            readFrame(writeIndex, modBase + modDepth * s, l, r);
+        }
+
+        if (chorusTaps)
+        {
+            float c = fast_sin_phase(lfoPhase + 0x40000000u);
+            for (int k = 1; k <= chorusTaps; k++)
+            {
+                // sin(phase + offset_k) by angle addition
+                float lfo = s * voiceCos[k] + c * voiceSin[k];
+                l += readSample(writeIndex, voiceBase[k] + CHORUS_DEPTH * lfo, 0);
+                r += readSample(writeIndex, voiceBase[k] - CHORUS_DEPTH * lfo, 1);
+            }
+        }
+
+        lfoPhase += lfoIncrement;
+        if (++writeIndex >= frames)
+            writeIndex = 0;
+
+        left[i] = l * gain;
+        right[i] = r * gain;
+    }
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fast_math.h"
+#include "processor.h"
+
+#define MOD_DELAY_MAX_VOICES 10
+
+enum ModDelayMode
+{
+    MOD_DELAY_OFF = 0,
+    MOD_DELAY_FLANGE,
+    MOD_DELAY_VIBRATO,
+    MOD_DELAY_MODE_COUNT
+};
+
+/// @brief Chorus, flange and vibrato on one shared stereo delay line and
+/// one LFO.
+///
+/// The delay line is interleaved L/R so each tap read touches one place in
+/// memory for both channels. Chorus voices get their own LFO phase by
+/// rotating the single LFO's sin/cos pair rather than running one
+/// oscillator each; the right channel uses the inverted modulation for
+/// width. Taps are read with linear interpolation.
+///
+/// With the modulated tap off and at most one chorus voice it is neutral,
+/// so the rack skips it and the delay line isn't touched. The line holds
+/// int16 to save RAM, so what goes into it is saturated.
+class ModDelayProcessor : public StereoProcessor
+{
+public:
+    /// @brief hand over interleaved stereo storage of `frames_` frames,
+    /// which must outlive this object
+    void begin(int16_t *buffer_, uint32_t frames_)
+    {
+        AudioNoInterrupts();
+        buffer = buffer_;
+        frames = frames_;
+        reset();
+        AudioInterrupts();
+    }
+
+    /// @brief don't replay whatever was left in the line from last time
+    void reset()
+    {
+        writeIndex = 0;
+        if (buffer)
+            memset(buffer, 0, frames * 2 * sizeof(int16_t));
+    }
+
+    /// @brief the single modulated tap: off, flange (mixed with dry) or
+    /// vibrato (replaces dry)
+    void mode(ModDelayMode mode_)
+    {
+        if (mode_ >= MOD_DELAY_MODE_COUNT)
+            mode_ = MOD_DELAY_OFF;
+        AudioNoInterrupts();
+        modMode = mode_;
+        lfoIncrement = frequencyToPhaseIncrement(modMode == MOD_DELAY_VIBRATO ? 5.0f : 0.5f);
+        AudioInterrupts();
+    }
+
+    /// @brief total chorus voices including the dry one, so 0 and 1 are off
+    /// (same convention as AudioEffectChorus)
+    void voices(uint8_t v)
+    {
+        if (v > MOD_DELAY_MAX_VOICES)
+            v = MOD_DELAY_MAX_VOICES;
+
+        // give each voice its own delay and LFO phase offset; process()
+        // reads these for every voice below chorusVoices, so don't let it
+        // see a half written set
+        AudioNoInterrupts();
+        for (int k = 1; k < v; k++)
+        {
+            voiceBase[k] = CHORUS_MIN_DELAY + (CHORUS_MAX_DELAY - CHORUS_MIN_DELAY) * k / v;
+            float angle = 6.2831853f * k / v;
+            voiceCos[k] = fast_cosf(angle);
+            voiceSin[k] = fast_sinf(angle);
+        }
+        chorusVoices = v;
+        AudioInterrupts();
+    }
+
+    bool isActive() const { return modMode != MOD_DELAY_OFF || chorusVoices > 1; }
+    bool isNeutral() { return !isActive(); }
+    const char *name() { return "mod"; }
+
+    void process(float *left, float *right, size_t n);
+
+private:
+    // delays in samples
+    static constexpr float FLANGE_BASE = 192;
+    static constexpr float FLANGE_DEPTH = 191;
+    static constexpr float VIBRATO_BASE = 256;
+    static constexpr float VIBRATO_DEPTH = 128;
+    static constexpr float CHORUS_MIN_DELAY = 220; // ~5ms
+    static constexpr float CHORUS_MAX_DELAY = 1100; // ~25ms
+    static constexpr float CHORUS_DEPTH = 88;       // +-2ms
+
+    int16_t *buffer = NULL;
+    uint32_t frames = 0;
+    uint32_t writeIndex = 0;
+
+    volatile ModDelayMode modMode = MOD_DELAY_OFF;
+    volatile uint8_t chorusVoices = 0;
+
+    uint32_t lfoPhase = 0;
+    uint32_t lfoIncrement = 0;
+
+    float voiceBase[MOD_DELAY_MAX_VOICES];
+    float voiceCos[MOD_DELAY_MAX_VOICES];
+    float voiceSin[MOD_DELAY_MAX_VOICES];
+
+    /// @brief add the frame `delay` samples back from `newest` into l and r
+    inline void readFrame(uint32_t newest, float delay, float &l, float &r) const
+    {
+        uint32_t whole = (uint32_t)delay;
+        float frac = delay - whole;
+        int32_t index = (int32_t)newest - (int32_t)whole;
+        if (index < 0)
+            index += frames;
+        int32_t older = index - 1;
+        if (older < 0)
+            older += frames;
+        const int16_t *a = buffer + 2 * index;
+        const int16_t *b = buffer + 2 * older;
+        l += a[0] + (b[0] - a[0]) * frac;
+        r += a[1] + (b[1] - a[1]) * frac;
+    }
+
+    /// @brief one channel of the frame `delay` samples back from `newest`
+    inline float readSample(uint32_t newest, float delay, int channel) const
+    {
+        uint32_t whole = (uint32_t)delay;
+        float frac = delay - whole;
+        int32_t index = (int32_t)newest - (int32_t)whole;
+        if (index < 0)
+            index += frames;
+        int32_t older = index - 1;
+        if (older < 0)
+            older += frames;
+        float a = buffer[2 * index + channel];
+        float b = buffer[2 * older + channel];
+        return a + (b - a) * frac;
+    }
+};
@@ -0,0 +1,112 @@
+#include "fx_phaser.h"
+
+PhaserProcessor::PhaserProcessor()
+{
+    rate(0.4f);
+    reset();
+}
+
+void PhaserProcessor::stages(uint8_t n)
+{
+    if (n > PHASER_MAX_STAGES)
+        n = PHASER_MAX_STAGES;
+    else if (n < 2)
+        n = 2;
+    stageCount = n & ~1;
+}
+
+void PhaserProcessor::feedback(float fb)
+{
+    if (fb < 0)
+        fb = 0;
+    else if (fb > 0.9f)
+        fb = 0.9f;
+    feedbackQ15 = (int32_t)(fb * 32768.0f);
+}
+
+void PhaserProcessor::reset()
+{
+    memset(channels, 0, sizeof(channels));
+    lfo.reset();
+    wet = 0.0f;
+}
+
+// allpass coefficient, Q15, for an LFO value in [-1, 1]. The corner sweeps
+// exponentially around the middle of the range so the motion sounds even.
+float PhaserProcessor::coefficient(float value) const
+{
+    float octaves = fast_log2f(MAX_HZ / MIN_HZ);
+    float hz = MIN_HZ * fast_exp2f(octaves * 0.5f * (1.0f + sweepDepth * value));
+    // a = (t - 1) / (t + 1) with t = tan(pi f / fs)
+    float w = 3.14159265f * hz / AUDIO_SAMPLE_RATE_EXACT;
+    float t = fast_sinf(w) / fast_cosf(w);
+    return 32767.0f * (t - 1.0f) / (t + 1.0f);
+}
+
+// y[n] = a * (x[n] - y[n-1]) + x[n-1] per stage, the last output fed back
+// into the first. An allpass can peak at nearly 3x its input, so the
+// product is taken to 64 bits (SMULL, still a single instruction). The wet
+// share moves from w toward wTarget; returns where it got to.
+float PhaserProcessor::run(Channel &c, float *samples, size_t frames, int32_t a, int32_t aStep, float w, float wTarget)
+{
+    const float wStep = 1.0f / AUDIO_BLOCK_SAMPLES;
+    const uint8_t n = stageCount;
+    const int32_t fb = feedbackQ15;
+    int32_t last = c.last;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        int32_t x = (int32_t)samples[i] + (int32_t)(((int64_t)fb * last) >> 15);
+        // keep the loop from running away
+        if (x > 32767)
+            x = 32767;
+        else if (x < -32768)
+            x = -32768;
+
+        int32_t coeff = a >> 16;
+        for (uint8_t s = 0; s < n; s++)
+        {
+            int32_t y = (int32_t)(((int64_t)coeff * (x - c.y1[s])) >> 15) + c.x1[s];
+            c.x1[s] = x;
+            c.y1[s] = y;
+            x = y;
+        }
+        last = x;
+        if (w < wTarget)
+        {
+            w += wStep;
+            if (w > wTarget)
+                w = wTarget;
+        }
+        else if (w > wTarget)
+        {
+            w -= wStep;
+            if (w < wTarget)
+                w = wTarget;
+        }
+        // equal dry and wet makes the notches
+        samples[i] += 0.5f * w * (x - samples[i]);
+        a += aStep;
+    }
+    c.last = last;
+    return w;
+}
+
+void PhaserProcessor::process(float *left, float *right, size_t frames)
+{
+    if (frames == 0)
+        return;
+
+    // coefficients at each end of the block, ramped in Q31 so the per
+    // sample step doesn't round away
+    ControlLfo::Segment l = lfo.segment(frames);
+    ControlLfo::Segment r = lfo.segment(frames, 0x40000000u);
+    float la = coefficient(l.start), lb = coefficient(l.end(frames));
+    float ra = coefficient(r.start), rb = coefficient(r.end(frames));
+
+    const float wTarget = sweepDepth > 0.0f ? 1.0f : 0.0f;
+    run(channels[0], left, frames, (int32_t)(la * 65536.0f), (int32_t)((lb - la) * 65536.0f / frames), wet, wTarget);
+    wet = run(channels[1], right, frames, (int32_t)(ra * 65536.0f), (int32_t)((rb - ra) * 65536.0f / frames), wet, wTarget);
+
+    lfo.advance(frames);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fx_lfo.h"
+#include "processor.h"
+
+#define PHASER_MAX_STAGES 8
+
+/// @brief Classic phaser: a chain of first order allpasses swept by an LFO,
+/// with feedback, mixed equally with the dry signal.
+///
+/// The allpasses run in Q15 fixed point, one multiply per stage per sample.
+/// The allpass coefficient is worked out from the LFO only at the ends of
+/// each block and ramped in between, so there is no per-sample tan() or
+/// sine. The right channel sweeps 90 degrees behind the left.
+///
+/// An unswept allpass chain still cuts fixed notches, so at zero depth the
+/// wet signal is faded out over a block, and only then is the phaser
+/// neutral.
+class PhaserProcessor : public StereoProcessor
+{
+public:
+    PhaserProcessor();
+
+    void rate(float hz) { lfo.rate(hz); }
+    /// @brief how much of the sweep range is used, 0 to 1
+    void depth(float d) { sweepDepth = d; }
+    /// @brief 2 to PHASER_MAX_STAGES, rounded down to an even number
+    void stages(uint8_t n);
+    /// @brief 0 to 0.9
+    void feedback(float fb);
+
+    bool isNeutral() { return sweepDepth == 0.0f && wet == 0.0f; }
+    void reset();
+    const char *name() { return "phaser"; }
+
+    void process(float *left, float *right, size_t frames);
+
+private:
+    struct Channel
+    {
+        // previous input and output of each stage
+        int32_t x1[PHASER_MAX_STAGES];
+        int32_t y1[PHASER_MAX_STAGES];
+        int32_t last;
+    };
+
+    ControlLfo lfo;
+    Channel channels[2];
+
+    volatile float sweepDepth = 0.0f;
+    // share of the wet signal in the mix, 1 for the full notches; follows
+    // the depth between 0 and 1 a sample at a time
+    float wet = 0.0f;
+    volatile uint8_t stageCount = 4;
+    volatile int32_t feedbackQ15 = 0;
+
+    // lowest and highest allpass corner in the sweep
+    static constexpr float MIN_HZ = 200.0f;
+    static constexpr float MAX_HZ = 4000.0f;
+
+    float coefficient(float lfo) const;
+    float run(Channel &c, float *samples, size_t frames, int32_t a, int32_t aStep, float w, float wTarget);
+};
@@ -0,0 +1,168 @@
+#include "fx_resonator.h"
+
+// int16 scale; about -78dBFS
+#define RESONATOR_THRESHOLD 4.0f
+
+// how hard the input plucks the strings
+#define RESONATOR_EXCITE 0.05f
+
+// shared scratch for the mono input and one string's output
+static float monoIn[AUDIO_BLOCK_SAMPLES];
+static float stringOut[AUDIO_BLOCK_SAMPLES];
+
+void ResonatorProcessor::begin(float *arena_, uint32_t length_)
+{
+    AudioNoInterrupts();
+    arena = arena_;
+    arenaLength = length_;
+    AudioInterrupts();
+}
+
+void ResonatorProcessor::tune(const float *frequencies, uint8_t count)
+{
+    if (count > RESONATOR_STRINGS)
+        count = RESONATOR_STRINGS;
+
+    AudioNoInterrupts();
+    uint32_t used = 0;
+    for (uint8_t i = 0; i < RESONATOR_STRINGS; i++)
+    {
+        String &s = strings[i];
+        s.line = NULL;
+        s.length = 0;
+        s.active = false;
+        s.frequency = i < count ? frequencies[i] : 0;
+        if (s.frequency < 20.0f || !arena)
+            continue;
+
+        float delay = AUDIO_SAMPLE_RATE_EXACT / s.frequency - 0.5f;
+        uint32_t length = (uint32_t)delay + 2;
+        if (used + length > arenaLength)
+            continue;
+
+        s.line = arena + used;
+        s.length = length;
+        s.writeIndex = 0;
+        s.whole = (uint32_t)delay;
+        s.frac = delay - s.whole;
+        memset(s.line, 0, length * sizeof(float));
+        used += length;
+        updateGain(s);
+    }
+    AudioInterrupts();
+}
+
+void ResonatorProcessor::decay(float seconds)
+{
+    decaySeconds = seconds;
+    for (uint8_t i = 0; i < RESONATOR_STRINGS; i++)
+        updateGain(strings[i]);
+}
+
+void ResonatorProcessor::updateGain(String &s)
+{
+    if (s.frequency <= 0 || decaySeconds <= 0)
+    {
+        s.gain = 0;
+        return;
+    }
+    // -60dB over decaySeconds, spread over the number of trips round the loop
+    s.gain = powf(10.0f, -3.0f / (decaySeconds * s.frequency));
+}
+
+void ResonatorProcessor::reset()
+{
+    for (uint8_t i = 0; i < RESONATOR_STRINGS; i++)
+    {
+        String &s = strings[i];
+        if (s.line)
+            memset(s.line, 0, s.length * sizeof(float));
+        s.active = false;
+    }
+    lastInput = 0;
+}
+
+// y[n] = x[n] + g * (y[n - d] + y[n - d - 1]) / 2 with d fractional. The
+// average is the string's damping and adds the half sample that tune()
+// took off.
+void ResonatorProcessor::run(String &s, const float *in, float *out, size_t frames)
+{
+    const float g = s.gain * 0.5f;
+    const float f = s.frac;
+    const float f1 = 1.0f - f;
+    float *line = s.line;
+    const uint32_t length = s.length;
+    uint32_t w = s.writeIndex;
+    // y[n - whole] sits whole slots behind the write index
+    uint32_t r = w + length - s.whole;
+    if (r >= length)
+        r -= length;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        uint32_t r1 = r == 0 ? length - 1 : r - 1;
+        uint32_t r2 = r1 == 0 ? length - 1 : r1 - 1;
+        float y = in[i] + g * (f1 * line[r] + line[r1] + f * line[r2]);
+        line[w] = y;
+        out[i] = y;
+        if (++w >= length)
+            w = 0;
+        if (++r >= length)
+            r = 0;
+    }
+    s.writeIndex = w;
+}
+
+void ResonatorProcessor::process(float *left, float *right, size_t frames)
+{
+    // the scratch buffers are a block long
+    while (frames > AUDIO_BLOCK_SAMPLES)
+    {
+        process(left, right, AUDIO_BLOCK_SAMPLES);
+        left += AUDIO_BLOCK_SAMPLES;
+        right += AUDIO_BLOCK_SAMPLES;
+        frames -= AUDIO_BLOCK_SAMPLES;
+    }
+
+    const float wet = wetGain;
+
+    // the strings are excited by the difference of the input, so DC (which
+    // every string would otherwise pile up) never gets in
+    float inputPeak = 0;
+    float prev = lastInput;
+    for (size_t i = 0; i < frames; i++)
+    {
+        float x = (left[i] + right[i]) * (0.5f * RESONATOR_EXCITE);
+        monoIn[i] = x - prev;
+        prev = x;
+        float a = fabsf(monoIn[i]);
+        if (a > inputPeak)
+            inputPeak = a;
+    }
+    lastInput = prev;
+    const bool excited = inputPeak > RESONATOR_THRESHOLD * RESONATOR_EXCITE;
+
+    for (uint8_t k = 0; k < RESONATOR_STRINGS; k++)
+    {
+        String &s = strings[k];
+        if (!s.line || (!s.active && !excited))
+            continue;
+
+        run(s, monoIn, stringOut, frames);
+
+        float peak = 0;
+        float *out = (k & 1) ? right : left;
+        for (size_t i = 0; i < frames; i++)
+        {
+            float a = fabsf(stringOut[i]);
+            if (a > peak)
+                peak = a;
+            out[i] += wet * stringOut[i];
+        }
+
+        // rung out: stop computing it until the input picks up again
+        s.active = excited || peak > RESONATOR_THRESHOLD;
+        if (!s.active)
+            memset(s.line, 0, s.length * sizeof(float));
+    }
+}
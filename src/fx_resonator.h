@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "processor.h"
+
+// Strings in the resonator bank, one per column of the note grid
+#define RESONATOR_STRINGS 8
+
+/// @brief A bank of Karplus-Strong strings tuned to the notes of the scale,
+/// excited by whatever is played through it: a sympathetic sitar or harp
+/// body ring added on top of the dry signal.
+///
+/// All strings share one float arena handed over with begin(), carved up
+/// by tune() to each string's length. Strings that are idle (the input and
+/// their own ring both below the threshold) are skipped and cleared, so an
+/// idle bank costs next to nothing and a ringing one ~15 cycles per string
+/// per sample.
+///
+/// Strings alternate left and right in the output.
+class ResonatorProcessor : public StereoProcessor
+{
+public:
+    /// @brief hand over the storage for all the strings, which must outlive
+    /// this object
+    void begin(float *arena, uint32_t length);
+
+    /// @brief retune the strings, one per frequency (up to
+    /// RESONATOR_STRINGS). Strings that don't fit in the arena stay silent.
+    void tune(const float *frequencies, uint8_t count);
+
+    /// @brief time for a string to ring down by 60dB, in seconds
+    void decay(float seconds);
+
+    /// @brief level of the strings added to the dry signal
+    void mix(float wet) { wetGain = wet; }
+
+    bool isNeutral() { return wetGain == 0.0f; }
+    void reset();
+    const char *name() { return "resonator"; }
+
+    void process(float *left, float *right, size_t frames);
+
+private:
+    struct String
+    {
+        float *line = NULL;
+        uint32_t length = 0;
+        uint32_t writeIndex = 0;
+
+        // loop delay less the half sample of the averaging lowpass, split
+        // into whole and fractional samples
+        uint32_t whole = 1;
+        float frac = 0;
+        float frequency = 0;
+
+        // loop gain for the decay time
+        volatile float gain = 0;
+        bool active = false;
+    };
+
+    String strings[RESONATOR_STRINGS];
+    float *arena = NULL;
+    uint32_t arenaLength = 0;
+    float decaySeconds = 2.0f;
+
+    volatile float wetGain = 0.0f;
+    float lastInput = 0;
+
+    void updateGain(String &s);
+    static void run(String &s, const float *in, float *out, size_t frames);
+};
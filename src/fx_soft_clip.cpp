@@ -0,0 +1,90 @@
+#include "fx_soft_clip.h"
+
+// tanh(4x) for x in [0, 1]. Generated with round(32767 * tanh(4 * i / 256))
+const int16_t SOFT_CLIP_TABLE_Q15[257] = {
+    0, 512, 1024, 1535, 2045, 2555, 3063, 3570, 4075, 4578, 5079, 5577, 6073, 6566, 7056, 7542,
+    8025, 8505, 8980, 9452, 9919, 10382, 10840, 11294, 11742, 12186, 12625, 13058, 13486, 13908, 14325, 14737,
+    15142, 15542, 15936, 16324, 16706, 17081, 17451, 17815, 18173, 18524, 18869, 19208, 19541, 19868, 20189, 20503,
+    20812, 21114, 21411, 21701, 21986, 22264, 22537, 22804, 23065, 23320, 23570, 23815, 24053, 24287, 24515, 24738,
+    24955, 25168, 25375, 25578, 25775, 25968, 26156, 26339, 26518, 26693, 26863, 27029, 27190, 27348, 27501, 27650,
+    27796, 27937, 28075, 28210, 28340, 28468, 28592, 28712, 28829, 28943, 29054, 29162, 29267, 29369, 29469, 29565,
+    29659, 29750, 29839, 29925, 30009, 30090, 30169, 30246, 30321, 30393, 30464, 30532, 30599, 30663, 30726, 30787,
+    30846, 30903, 30959, 31013, 31066, 31117, 31166, 31215, 31261, 31306, 31350, 31393, 31435, 31475, 31514, 31552,
+    31588, 31624, 31658, 31692, 31725, 31756, 31787, 31817, 31845, 31873, 31900, 31927, 31952, 31977, 32001, 32024,
+    32047, 32069, 32090, 32111, 32131, 32150, 32169, 32187, 32205, 32222, 32239, 32255, 32270, 32286, 32300, 32315,
+    32328, 32342, 32355, 32367, 32380, 32391, 32403, 32414, 32425, 32435, 32446, 32455, 32465, 32474, 32483, 32492,
+    32500, 32508, 32516, 32524, 32531, 32539, 32546, 32553, 32559, 32565, 32572, 32578, 32583, 32589, 32595, 32600,
+    32605, 32610, 32615, 32619, 32624, 32628, 32633, 32637, 32641, 32645, 32648, 32652, 32656, 32659, 32662, 32666,
+    32669, 32672, 32675, 32677, 32680, 32683, 32685, 32688, 32690, 32693, 32695, 32697, 32699, 32701, 32703, 32705,
+    32707, 32709, 32711, 32713, 32714, 32716, 32717, 32719, 32720, 32722, 32723, 32725, 32726, 32727, 32728, 32730,
+    32731, 32732, 32733, 32734, 32735, 32736, 32737, 32738, 32739, 32740, 32740, 32741, 32742, 32743, 32744, 32744,
+    32745,
+};
+
+// Least squares halfband, passband to 0.18 of the 2x rate. Only the side
+// taps are stored; the center tap is 0.5 and every other tap is zero.
+// Interpolation gains are doubled to make up for the zero stuffing.
+static const int16_t INTERP_Q15[5] = {20407, -5789, 2458, -983, 291};
+static const int16_t DECIM_Q15[5] = {10204, -2895, 1229, -491, 145};
+
+static inline int16_t sat16(int32_t x)
+{
+    if (x > 32767)
+        return 32767;
+    if (x < -32768)
+        return -32768;
+    return x;
+}
+
+// +-4x full scale in
+#define SOFT_CLIP_RANGE 131071
+
+// x is at int16 scale with +-4x headroom, the table spans all of it
+inline int16_t SoftClipper::shape(int32_t x)
+{
+    uint32_t mag = x < 0 ? -x : x;
+    if (mag > SOFT_CLIP_RANGE)
+        mag = SOFT_CLIP_RANGE;
+    uint32_t index = mag >> 9;
+    int32_t frac = mag & 511;
+    int32_t a = SOFT_CLIP_TABLE_Q15[index];
+    int32_t b = SOFT_CLIP_TABLE_Q15[index + 1];
+    int32_t y = a + (((b - a) * frac) >> 9);
+    return x < 0 ? -y : y;
+}
+
+float SoftClipper::tick(float x)
+{
+    int32_t xi = (int32_t)x;
+    if (xi > SOFT_CLIP_RANGE)
+        xi = SOFT_CLIP_RANGE;
+    else if (xi < -SOFT_CLIP_RANGE)
+        xi = -SOFT_CLIP_RANGE;
+
+    if (position == 0)
+        position = TAPS;
+    position--;
+    up[position] = up[position + TAPS] = xi;
+    const int32_t *u = up + position;
+
+    // 2x interpolation: one phase is the symmetric FIR, the other is the
+    // center tap, which is a plain delay. The headroom takes the sums past
+    // 32 bits, so this accumulates in 64 (SMLAL, still one cycle)
+    int64_t acc = 1 << 14;
+    for (int i = 0; i < TAPS / 2; i++)
+        acc += (int64_t)INTERP_Q15[i] * (u[TAPS / 2 - 1 - i] + u[TAPS / 2 + i]);
+    int32_t v0 = (int32_t)(acc >> 15);
+    int32_t v1 = u[TAPS / 2 - 1];
+
+    // shape both, the output is back at full scale
+    even[position] = even[position + TAPS] = shape(v0);
+    odd[position] = odd[position + TAPS] = shape(v1);
+    const int16_t *e = even + position;
+
+    // 2x decimation: FIR over one phase plus the center tap of the other
+    int32_t sum = (odd[position + TAPS / 2] << 14) + (1 << 14);
+    for (int i = 0; i < TAPS / 2; i++)
+        sum += DECIM_Q15[i] * (e[TAPS / 2 - 1 - i] + e[TAPS / 2 + i]);
+
+    return sat16(sum >> 15);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include "processor.h"
+
+// Input samples of delay through the clipper's two halfband filters
+#define SOFT_CLIP_LATENCY 9
+
+// tanh(4x) for x in [0, 1] in Q15, 256 segments plus a guard point
+extern const int16_t SOFT_CLIP_TABLE_Q15[257];
+
+/// @brief tanh shaped saturation run at twice the sample rate, so the
+/// harmonics it adds above fs/2 are filtered out instead of aliasing.
+///
+/// Each sample is taken to an integer with +-4x full scale of headroom,
+/// interpolated to 2x by a 19 tap halfband filter, shaped by a table
+/// lookup and decimated by the same halfband. Both filters are polyphase
+/// with Q15 coefficients, so each costs 5 multiply-accumulates per input
+/// sample, and the cost is the same whatever the signal.
+///
+/// Small signals come through at unity gain, delayed by SOFT_CLIP_LATENCY.
+/// The response is flat to +-0.05dB up to 14kHz, then -0.2dB at 16kHz,
+/// -1.4dB at 18kHz and -4.1dB at 20kHz. Driven 2.5dB into compression,
+/// the third harmonic of a 10-15kHz tone folds back below -70dB. Both
+/// measured in test/test_soft_clip.cpp.
+class SoftClipper : public MonoProcessor
+{
+public:
+    /// @brief one sample in, one sample out, at int16 scale
+    float tick(float x);
+
+    void process(const float *in, float *out, size_t frames)
+    {
+        for (size_t i = 0; i < frames; i++)
+            out[i] = tick(in[i]);
+    }
+
+    void reset()
+    {
+        memset(up, 0, sizeof(up));
+        memset(even, 0, sizeof(even));
+        memset(odd, 0, sizeof(odd));
+        position = 0;
+    }
+
+private:
+    static const int TAPS = 10;
+
+    // The histories are rings written twice, TAPS apart, so the last TAPS
+    // samples are always in one run starting at `position`, newest first,
+    // without shifting anything along each sample.
+
+    // interpolator input, clamped to +-4x full scale
+    int32_t up[2 * TAPS] = {};
+    // shaped 2x samples for the decimator
+    int16_t even[2 * TAPS] = {};
+    int16_t odd[2 * TAPS] = {};
+    uint8_t position = 0;
+
+    static inline int16_t shape(int32_t x);
+};
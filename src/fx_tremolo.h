@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Arduino.h>
+#include "fx_lfo.h"
+#include "processor.h"
+
+/// @brief Tremolo that turns into auto-pan: both channels' gains follow
+/// one LFO, the right one up to 180 degrees behind the left.
+///
+/// Gains are ramped across each block from the LFO's control-rate
+/// segments, so the loop is two multiply-adds per frame.
+class TremoloProcessor : public StereoProcessor
+{
+    ControlLfo lfo;
+
+    volatile float modDepth = 0.0f;
+    volatile float panSpread = 0.0f;
+    volatile float shapeGain = 1.0f;
+
+    // gain for an LFO value: 1 at the top, 1 - depth at the bottom
+    float gainFor(float value) const
+    {
+        // push the sine towards a square, clipped at +-1
+        value *= shapeGain;
+        if (value > 1.0f)
+            value = 1.0f;
+        else if (value < -1.0f)
+            value = -1.0f;
+        return 1.0f - modDepth * 0.5f * (1.0f - value);
+    }
+
+public:
+    TremoloProcessor() { rate(4.0f); }
+
+    void rate(float hz) { lfo.rate(hz); }
+    /// @brief 0 (off) to 1 (full cut at the bottom of each cycle)
+    void depth(float d) { modDepth = d; }
+    /// @brief 0 is tremolo, 1 is auto-pan (channels in opposite phase)
+    void pan(float spread) { panSpread = spread; }
+    /// @brief 1 is a sine, higher gets squarer
+    void shape(float s) { shapeGain = s < 1.0f ? 1.0f : s; }
+
+    bool isNeutral() { return modDepth == 0.0f; }
+    void reset() { lfo.reset(); }
+    const char *name() { return "tremolo"; }
+
+    void process(float *left, float *right, size_t frames)
+    {
+        if (frames == 0)
+            return;
+
+        ControlLfo::Segment l = lfo.segment(frames);
+        ControlLfo::Segment r = lfo.segment(frames, (uint32_t)(panSpread * 2147483648.0f));
+        float gl = gainFor(l.start);
+        float gr = gainFor(r.start);
+        const float stepL = (gainFor(l.end(frames)) - gl) / frames;
+        const float stepR = (gainFor(r.end(frames)) - gr) / frames;
+
+        for (size_t i = 0; i < frames; i++)
+        {
+            left[i] *= gl;
+            right[i] *= gr;
+            gl += stepL;
+            gr += stepR;
+        }
+        lfo.advance(frames);
+    }
+};
@@ -15,6 +15,7 @@ public:
     void noteOff() override;
     void enable() override;
     void disable() override;
+    void park(bool parked) override { NodeActivity::set(note, !parked); }
     void setFrequency(float freq) override;
     AudioStream &getOutputLeft() override { return note; }
     AudioStream &getOutputRight() override { return note; }
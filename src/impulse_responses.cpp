@@ -0,0 +1,402 @@
+#include "impulse_responses.h"
+
+// Synthesized from a modal model of each body: a handful of low
+// resonances (air and top plate modes) over a dense spread of short
+// high modes, faded out over the last 256 samples. 44.1kHz, Q15.
+
+PROGMEM
+const int16_t IR_ACOUSTIC_BODY_DATA[2304] = {
+    -32767, -27300, -24218, -23946, -25388, -25825, -23122, -18163, -14498, -15055, -19157, -23016,
+    -23218, -19661, -15187, -12707, -12875, -14238, -15036, -14557, -13140, -11541, -10567, -10959,
+    -13056, -16368, -19740, -22246, -23962, -25704, -27912, -29904, -30332, -28361, -24341, -19427,
+    -14690, -10584, -7024, -3683, -246, 3301, 6365, 7875, 7110, 4658, 2438, 2391,
+    4926, 8636, 11602, 12972, 13285, 13437, 13648, 13494, 12675, 11342, 9640, 7325,
+    4237, 1119, -525, 187, 2261, 3316, 1605, -2414, -6613, -9214, -10177, -10638,
+    -11364, -12098, -12365, -12448, -13144, -14630, -15962, -15987, -14602, -12796, -11392, -10052,
+    -7833, -4618, -1648, -363, -865, -1822, -1978, -1529, -1767, -3434, -5674, -6750,
+    -5665, -2901, 308, 3109, 5297, 6739, 7093, 6331, 5320, 5393, 7058, 9262,
+    10175, 8837, 6008, 3395, 2145, 2155, 2657, 3188, 3817, 4634, 5379, 5713,
+    5697, 5726, 5923, 5809, 4747, 2741, 625, -624, -739, -285, 0, -124,
+    -391, -512, -491, -462, -397, -120, 408, 989, 1457, 1967, 2884, 4334,
+    5947, 7119, 7530, 7359, 7017, 6763, 6617, 6560, 6643, 6825, 6795, 6118,
+    4632, 2681, 907, -188, -479, -123, 622, 1396, 1663, 885, -1068, -3675,
+    -6052, -7604, -8444, -9171, -10277, -11754, -13218, -14283, -14772, -14667, -14038, -13131,
+    -12402, -12266, -12685, -13053, -12624, -11180, -9292, -7909, -7675, -8571, -10104, -11716,
+    -12979, -13570, -13280, -12174, -10689, -9402, -8610, -8108, -7443, -6365, -5022, -3734,
+    -2645, -1665, -696, 161, 710, 908, 950, 1053, 1225, 1277, 1067, 679,
+    338, 204, 306, 655, 1333, 2388, 3659, 4775, 5421, 5604, 5644, 5879,
+    6387, 6961, 7311, 7238, 6663, 5595, 4162, 2666, 1517, 1014, 1150, 1666,
+    2292, 2952, 3730, 4695, 5793, 6925, 8060, 9231, 10423, 11526, 12438, 13204,
+    14009, 15002, 16161, 17335, 18420, 19447, 20504, 21618, 22753, 23928, 25258, 26815,
+    28457, 29825, 30583, 30665, 30309, 29852, 29517, 29350, 29312, 29338, 29320, 29103,
+    28590, 27871, 27204, 26809, 26667, 26527, 26149, 25527, 24877, 24414, 24159, 23952,
+    23613, 23070, 22352, 21514, 20624, 19777, 19076, 18531, 18014, 17340, 16452, 15512,
+    14781, 14397, 14259, 14135, 13860, 13446, 13017, 12671, 12408, 12154, 11818, 11318,
+    10591, 9637, 8570, 7592, 6891, 6524, 6409, 6419, 6488, 6626, 6856, 7154,
+    7472, 7786, 8112, 8461, 8785, 8981, 8953, 8670, 8187, 7619, 7107, 6773,
+    6662, 6711, 6774, 6727, 6568, 6421, 6433, 6636, 6905, 7034, 6868, 6387,
+    5697, 4967, 4345, 3895, 3566, 3217, 2706, 2009, 1251, 633, 274, 130,
+    45, -113, -364, -641, -884, -1095, -1318, -1581, -1880, -2198, -2527, -2864,
+    -3202, -3546, -3942, -4458, -5118, -5841, -6484, -6950, -7273, -7580, -7968, -8412,
+    -8785, -8976, -8975, -8873, -8775, -8747, -8808, -8948, -9140, -9345, -9523, -9674,
+    -9837, -10051, -10285, -10434, -10392, -10137, -9752, -9346, -8971, -8596, -8172, -7702,
+    -7260, -6938, -6786, -6791, -6902, -7057, -7203, -7313, -7397, -7499, -7657, -7864,
+    -8055, -8147, -8103, -7963, -7810, -7710, -7676, -7685, -7715, -7767, -7858, -7998,
+    -8173, -8351, -8500, -8603, -8668, -8726, -8812, -8936, -9068, -9156, -9166, -9117,
+    -9068, -9074, -9142, -9221, -9238, -9148, -8957, -8728, -8546, -8476, -8524, -8633,
+    -8706, -8669, -8523, -8342, -8220, -8205, -8266, -8325, -8306, -8177, -7948, -7663,
+    -7382, -7165, -7060, -7076, -7181, -7328, -7488, -7666, -7883, -8150, -8455, -8772,
+    -9076, -9343, -9545, -9653, -9662, -9611, -9569, -9587, -9669, -9772, -9847, -9877,
+    -9883, -9905, -9970, -10082, -10224, -10354, -10413, -10341, -10109, -9738, -9287, -8816,
+    -8355, -7899, -7432, -6955, -6481, -6027, -5603, -5212, -4861, -4561, -4312, -4105,
+    -3924, -3764, -3634, -3547, -3507, -3509, -3539, -3591, -3657, -3734, -3817, -3908,
+    -4016, -4149, -4308, -4480, -4651, -4809, -4954, -5089, -5222, -5356, -5498, -5653,
+    -5820, -5986, -6133, -6236, -6274, -6236, -6122, -5950, -5742, -5522, -5296, -5058,
+    -4797, -4511, -4214, -3926, -3658, -3411, -3174, -2937, -2690, -2427, -2147, -1851,
+    -1542, -1220, -885, -533, -173, 173, 481, 740, 957, 1151, 1331, 1491,
+    1623, 1723, 1807, 1897, 2007, 2136, 2269, 2387, 2473, 2517, 2524, 2511,
+    2500, 2507, 2525, 2530, 2503, 2441, 2361, 2286, 2232, 2196, 2173, 2158,
+    2149, 2143, 2132, 2106, 2063, 2008, 1951, 1900, 1862, 1837, 1825, 1821,
+    1819, 1820, 1831, 1861, 1909, 1957, 1977, 1947, 1866, 1759, 1659, 1588,
+    1546, 1517, 1478, 1419, 1347, 1286, 1259, 1279, 1337, 1408, 1467, 1501,
+    1513, 1520, 1534, 1559, 1590, 1619, 1644, 1670, 1709, 1769, 1848, 1939,
+    2029, 2113, 2190, 2263, 2334, 2396, 2441, 2463, 2466, 2458, 2449, 2443,
+    2435, 2420, 2395, 2361, 2326, 2297, 2276, 2263, 2249, 2225, 2188, 2143,
+    2103, 2077, 2067, 2067, 2072, 2084, 2111, 2159, 2226, 2303, 2376, 2440,
+    2498, 2560, 2635, 2730, 2844, 2970, 3096, 3215, 3331, 3454, 3596, 3757,
+    3928, 4092, 4238, 4365, 4483, 4601, 4724, 4851, 4978, 5103, 5229, 5358,
+    5497, 5650, 5820, 6004, 6197, 6393, 6585, 6772, 6949, 7112, 7259, 7388,
+    7505, 7615, 7721, 7820, 7903, 7965, 8004, 8026, 8041, 8055, 8067, 8072,
+    8060, 8022, 7958, 7875, 7784, 7695, 7615, 7540, 7465, 7385, 7298, 7208,
+    7121, 7040, 6966, 6897, 6829, 6759, 6686, 6613, 6545, 6485, 6437, 6403,
+    6384, 6375, 6371, 6366, 6358, 6347, 6335, 6325, 6314, 6297, 6266, 6216,
+    6144, 6052, 5946, 5835, 5726, 5621, 5516, 5405, 5284, 5154, 5020, 4887,
+    4757, 4630, 4504, 4376, 4248, 4121, 3999, 3886, 3785, 3698, 3623, 3556,
+    3497, 3443, 3399, 3364, 3340, 3324, 3313, 3305, 3299, 3293, 3286, 3278,
+    3269, 3260, 3249, 3236, 3218, 3192, 3158, 3113, 3058, 2991, 2913, 2826,
+    2732, 2634, 2533, 2427, 2314, 2192, 2058, 1913, 1757, 1591, 1417, 1235,
+    1045, 846, 638, 424, 205, -13, -228, -436, -637, -829, -1014, -1191,
+    -1362, -1528, -1690, -1850, -2008, -2167, -2327, -2489, -2651, -2811, -2965, -3108,
+    -3239, -3356, -3463, -3563, -3657, -3749, -3836, -3919, -3997, -4070, -4140, -4211,
+    -4288, -4372, -4461, -4553, -4645, -4735, -4823, -4911, -4998, -5087, -5176, -5267,
+    -5358, -5449, -5540, -5632, -5725, -5818, -5911, -6000, -6086, -6166, -6241, -6311,
+    -6376, -6438, -6497, -6554, -6611, -6665, -6713, -6754, -6787, -6813, -6836, -6855,
+    -6873, -6888, -6899, -6904, -6903, -6897, -6892, -6889, -6891, -6898, -6909, -6920,
+    -6931, -6941, -6948, -6953, -6952, -6946, -6932, -6911, -6883, -6850, -6813, -6774,
+    -6733, -6690, -6645, -6597, -6548, -6495, -6439, -6380, -6316, -6248, -6174, -6095,
+    -6011, -5922, -5826, -5724, -5618, -5510, -5403, -5297, -5194, -5092, -4991, -4890,
+    -4790, -4688, -4587, -4487, -4386, -4287, -4190, -4095, -4003, -3914, -3827, -3739,
+    -3651, -3561, -3470, -3378, -3287, -3194, -3101, -3004, -2905, -2805, -2706, -2609,
+    -2516, -2426, -2339, -2254, -2170, -2089, -2011, -1936, -1862, -1788, -1712, -1632,
+    -1548, -1464, -1380, -1298, -1220, -1145, -1071, -998, -926, -853, -780, -706,
+    -630, -553, -473, -390, -303, -211, -115, -16, 84, 184, 282, 377,
+    468, 556, 641, 724, 804, 879, 952, 1021, 1088, 1155, 1221, 1284,
+    1344, 1399, 1447, 1488, 1524, 1556, 1584, 1607, 1625, 1638, 1646, 1648,
+    1646, 1640, 1632, 1622, 1610, 1597, 1583, 1567, 1549, 1530, 1509, 1488,
+    1466, 1444, 1423, 1402, 1380, 1357, 1331, 1303, 1273, 1239, 1203, 1163,
+    1120, 1073, 1023, 971, 920, 869, 818, 767, 716, 665, 612, 561,
+    509, 458, 406, 354, 301, 247, 193, 140, 87, 35, -14, -60,
+    -102, -139, -172, -202, -228, -251, -273, -292, -309, -322, -332, -340,
+    -344, -345, -342, -336, -325, -311, -292, -270, -244, -215, -182, -147,
+    -109, -69, -27, 17, 62, 109, 157, 206, 257, 308, 361, 416,
+    471, 527, 582, 636, 688, 739, 789, 839, 889, 940, 992, 1043,
+    1093, 1143, 1193, 1243, 1293, 1343, 1394, 1444, 1495, 1545, 1595, 1647,
+    1699, 1753, 1810, 1868, 1929, 1993, 2059, 2127, 2199, 2272, 2348, 2424,
+    2501, 2578, 2655, 2731, 2808, 2885, 2962, 3039, 3117, 3194, 3270, 3345,
+    3418, 3491, 3563, 3634, 3704, 3773, 3839, 3904, 3967, 4027, 4085, 4141,
+    4195, 4247, 4297, 4345, 4390, 4433, 4473, 4510, 4544, 4574, 4602, 4627,
+    4648, 4667, 4683, 4696, 4707, 4715, 4720, 4721, 4719, 4713, 4704, 4691,
+    4674, 4655, 4633, 4609, 4581, 4552, 4520, 4486, 4451, 4414, 4375, 4335,
+    4295, 4252, 4209, 4163, 4116, 4067, 4016, 3963, 3909, 3854, 3799, 3743,
+    3687, 3630, 3572, 3514, 3456, 3396, 3334, 3271, 3207, 3140, 3072, 3002,
+    2930, 2857, 2781, 2704, 2626, 2547, 2466, 2385, 2303, 2221, 2138, 2055,
+    1973, 1890, 1806, 1722, 1638, 1554, 1469, 1386, 1303, 1220, 1138, 1056,
+    973, 890, 807, 724, 641, 557, 474, 391, 307, 224, 141, 58,
+    -25, -108, -190, -272, -355, -437, -519, -602, -684, -767, -850, -933,
+    -1016, -1099, -1182, -1264, -1345, -1425, -1504, -1581, -1657, -1732, -1806, -1879,
+    -1951, -2022, -2092, -2160, -2226, -2291, -2355, -2417, -2477, -2536, -2593, -2647,
+    -2700, -2752, -2801, -2848, -2894, -2938, -2980, -3020, -3059, -3096, -3131, -3164,
+    -3195, -3224, -3251, -3277, -3300, -3321, -3341, -3359, -3375, -3390, -3404, -3416,
+    -3427, -3435, -3443, -3448, -3452, -3455, -3456, -3456, -3456, -3453, -3450, -3446,
+    -3441, -3434, -3427, -3419, -3409, -3398, -3386, -3373, -3358, -3342, -3323, -3303,
+    -3281, -3258, -3234, -3209, -3183, -3156, -3128, -3100, -3071, -3041, -3011, -2980,
+    -2948, -2916, -2882, -2848, -2814, -2778, -2742, -2706, -2669, -2632, -2595, -2558,
+    -2520, -2483, -2445, -2408, -2370, -2333, -2295, -2257, -2218, -2179, -2140, -2100,
+    -2060, -2020, -1980, -1940, -1899, -1858, -1817, -1775, -1733, -1691, -1650, -1608,
+    -1566, -1524, -1483, -1442, -1401, -1361, -1321, -1282, -1243, -1205, -1168, -1131,
+    -1095, -1060, -1025, -991, -958, -926, -895, -864, -834, -806, -779, -753,
+    -728, -703, -680, -657, -634, -613, -591, -571, -551, -531, -513, -495,
+    -477, -461, -446, -431, -417, -404, -392, -381, -370, -359, -350, -340,
+    -331, -322, -313, -304, -295, -287, -278, -270, -262, -255, -247, -240,
+    -232, -225, -218, -210, -203, -195, -188, -181, -173, -166, -159, -153,
+    -146, -139, -133, -127, -121, -115, -110, -105, -100, -96, -92, -89,
+    -86, -84, -82, -81, -81, -81, -81, -81, -82, -83, -83, -84,
+    -84, -85, -85, -85, -85, -85, -85, -84, -84, -83, -81, -80,
+    -78, -75, -72, -69, -65, -61, -56, -51, -45, -39, -32, -25,
+    -18, -11, -3, 5, 14, 23, 32, 42, 52, 63, 75, 87,
+    100, 113, 128, 142, 157, 173, 190, 207, 225, 243, 263, 283,
+    303, 324, 346, 369, 392, 417, 442, 467, 494, 521, 548, 577,
+    606, 636, 666, 698, 729, 762, 795, 828, 862, 895, 929, 964,
+    998, 1033, 1068, 1103, 1138, 1173, 1208, 1244, 1279, 1314, 1349, 1384,
+    1419, 1453, 1487, 1520, 1553, 1585, 1617, 1648, 1678, 1707, 1736, 1764,
+    1791, 1818, 1844, 1869, 1893, 1917, 1940, 1962, 1983, 2003, 2023, 2041,
+    2059, 2076, 2092, 2107, 2121, 2135, 2148, 2159, 2171, 2181, 2190, 2199,
+    2207, 2214, 2220, 2225, 2229, 2233, 2235, 2237, 2238, 2237, 2237, 2235,
+    2232, 2229, 2224, 2219, 2213, 2206, 2198, 2190, 2181, 2171, 2160, 2148,
+    2136, 2123, 2110, 2095, 2080, 2064, 2047, 2029, 2011, 1992, 1972, 1951,
+    1930, 1908, 1885, 1862, 1838, 1813, 1788, 1762, 1736, 1709, 1681, 1653,
+    1624, 1595, 1565, 1535, 1504, 1473, 1442, 1410, 1378, 1345, 1313, 1280,
+    1247, 1214, 1180, 1147, 1113, 1080, 1046, 1012, 978, 944, 910, 876,
+    842, 807, 773, 739, 704, 669, 635, 600, 565, 530, 496, 461,
+    426, 391, 356, 321, 287, 252, 217, 183, 149, 115, 81, 48,
+    14, -19, -51, -84, -116, -148, -179, -210, -241, -271, -301, -330,
+    -359, -387, -415, -443, -471, -498, -524, -551, -577, -602, -627, -652,
+    -677, -701, -724, -748, -771, -793, -816, -838, -859, -881, -902, -922,
+    -943, -963, -983, -1002, -1021, -1040, -1058, -1076, -1094, -1111, -1128, -1144,
+    -1160, -1176, -1191, -1205, -1220, -1234, -1247, -1260, -1273, -1285, -1296, -1308,
+    -1318, -1329, -1338, -1348, -1357, -1365, -1373, -1381, -1388, -1394, -1400, -1406,
+    -1410, -1415, -1419, -1422, -1425, -1428, -1430, -1432, -1433, -1434, -1434, -1434,
+    -1434, -1433, -1432, -1431, -1430, -1428, -1425, -1423, -1420, -1416, -1413, -1409,
+    -1405, -1401, -1396, -1392, -1387, -1381, -1376, -1370, -1365, -1358, -1352, -1346,
+    -1339, -1332, -1324, -1317, -1309, -1302, -1294, -1285, -1277, -1269, -1260, -1251,
+    -1242, -1233, -1224, -1215, -1205, -1195, -1186, -1176, -1166, -1156, -1146, -1136,
+    -1126, -1115, -1105, -1095, -1084, -1074, -1063, -1052, -1041, -1030, -1019, -1008,
+    -997, -986, -974, -963, -951, -939, -927, -915, -903, -890, -878, -865,
+    -852, -839, -825, -812, -798, -784, -771, -757, -742, -728, -714, -700,
+    -685, -670, -656, -641, -626, -612, -597, -582, -567, -552, -538, -523,
+    -509, -494, -480, -466, -452, -438, -425, -411, -398, -385, -372, -360,
+    -347, -335, -323, -311, -300, -289, -277, -267, -256, -245, -235, -224,
+    -214, -204, -194, -184, -175, -165, -155, -146, -136, -127, -117, -107,
+    -98, -88, -79, -69, -59, -49, -40, -30, -20, -11, -1, 9,
+    19, 28, 38, 47, 57, 66, 75, 84, 94, 103, 111, 120,
+    129, 137, 146, 154, 162, 170, 178, 185, 193, 200, 208, 215,
+    222, 230, 237, 244, 251, 258, 266, 273, 280, 287, 294, 302,
+    309, 316, 324, 331, 338, 346, 353, 361, 369, 376, 384, 392,
+    399, 407, 415, 423, 430, 438, 446, 454, 461, 469, 477, 484,
+    492, 500, 507, 515, 522, 530, 537, 545, 552, 560, 567, 574,
+    582, 589, 597, 604, 612, 620, 627, 635, 643, 651, 658, 666,
+    674, 682, 690, 699, 707, 715, 723, 732, 740, 748, 757, 765,
+    773, 782, 790, 798, 807, 815, 823, 831, 838, 846, 853, 861,
+    868, 874, 881, 887, 892, 898, 903, 907, 912, 916, 919, 923,
+    926, 928, 930, 932, 933, 934, 935, 935, 935, 935, 934, 933,
+    932, 930, 928, 926, 923, 921, 917, 914, 910, 907, 902, 898,
+    893, 888, 883, 878, 872, 866, 860, 854, 847, 840, 833, 826,
+    818, 811, 803, 795, 786, 778, 769, 760, 751, 741, 732, 722,
+    712, 702, 692, 681, 671, 660, 649, 638, 627, 616, 604, 593,
+    581, 570, 558, 546, 534, 522, 510, 498, 486, 474, 462, 449,
+    437, 425, 413, 400, 388, 376, 363, 351, 339, 327, 315, 302,
+    290, 278, 266, 254, 242, 231, 219, 207, 196, 184, 173, 162,
+    151, 140, 129, 118, 107, 97, 87, 77, 67, 57, 48, 38,
+    29, 20, 12, 3, -5, -13, -21, -28, -36, -43, -49, -56,
+    -62, -68, -74, -80, -85, -91, -95, -100, -105, -109, -113, -117,
+    -120, -124, -127, -130, -133, -135, -138, -140, -142, -144, -146, -147,
+    -149, -150, -151, -152, -152, -153, -153, -153, -153, -153, -153, -153,
+    -152, -151, -151, -150, -149, -147, -146, -145, -143, -141, -139, -138,
+    -136, -133, -131, -129, -127, -124, -122, -119, -116, -114, -111, -108,
+    -105, -103, -100, -97, -94, -91, -88, -85, -82, -80, -77, -74,
+    -71, -68, -65, -63, -60, -57, -55, -52, -49, -47, -44, -42,
+    -40, -38, -35, -33, -31, -29, -27, -25, -23, -22, -20, -18,
+    -17, -15, -14, -13, -11, -10, -9, -8, -7, -6, -5, -5,
+    -4, -3, -3, -2, -2, -1, -1, -1, 0, 0, 0, 0,
+};
+
+PROGMEM
+const int16_t IR_PARLOR_BODY_DATA[2304] = {
+    11455, 13744, 10066, 3599, 1534, 6073, 11434, 10784, 4435, -1201, -2281, -2069,
+    -5573, -12297, -17244, -17984, -17186, -17627, -18055, -16149, -13161, -12352, -13669, -13471,
+    -10240, -7437, -8760, -12717, -14731, -13782, -13891, -18397, -25201, -29314, -28719, -25843,
+    -23718, -22545, -20477, -16464, -11370, -6642, -2668, 1246, 5377, 8317, 7841, 3484,
+    -2212, -5894, -6713, -6408, -6093, -4656, -1397, 1268, 33, -4578, -8043, -7272,
+    -4348, -3356, -4931, -6224, -5755, -5589, -7807, -10942, -11819, -9890, -7763, -7654,
+    -9129, -10726, -12097, -13509, -14387, -13827, -12213, -11028, -10957, -11168, -10733, -9888,
+    -9317, -8803, -7296, -4156, 154, 4499, 7896, 10131, 11957, 14449, 17728, 20495,
+    21424, 20882, 20468, 20768, 20571, 18911, 16984, 16923, 19010, 21400, 22711, 23637,
+    25347, 27410, 28492, 28605, 29234, 31063, 32767, 32712, 31044, 29297, 28409, 28029,
+    27588, 27103, 26675, 25960, 24644, 22985, 21421, 19979, 18562, 17547, 17442, 17895,
+    17681, 15977, 13327, 11071, 10070, 10214, 10886, 11500, 11739, 11680, 11711, 12043,
+    12314, 12045, 11495, 11543, 12468, 13288, 12815, 11134, 9499, 8787, 8661, 8397,
+    7964, 7829, 8085, 8376, 8598, 9095, 10041, 11092, 11907, 12630, 13495, 14209,
+    14196, 13418, 12524, 12099, 12082, 12079, 11932, 11713, 11371, 10737, 9822, 8816,
+    7758, 6511, 5126, 3958, 3203, 2551, 1540, 193, -985, -1636, -1965, -2433,
+    -3248, -4245, -5116, -5635, -5765, -5716, -5816, -6168, -6497, -6526, -6471, -6890,
+    -7930, -8989, -9348, -9025, -8728, -8998, -9654, -10161, -10294, -10265, -10358, -10649,
+    -11049, -11422, -11635, -11672, -11734, -12070, -12634, -13060, -13103, -13023, -13307, -14073,
+    -14917, -15422, -15619, -15843, -16260, -16713, -16994, -17085, -17094, -17077, -17009, -16856,
+    -16615, -16296, -15939, -15606, -15312, -14998, -14640, -14347, -14269, -14411, -14639, -14892,
+    -15271, -15852, -16496, -16967, -17219, -17427, -17721, -18003, -18075, -17884, -17521, -17067,
+    -16531, -15940, -15375, -14871, -14377, -13855, -13357, -12927, -12485, -11912, -11236, -10646,
+    -10270, -10022, -9710, -9245, -8667, -8029, -7319, -6535, -5739, -5002, -4337, -3716,
+    -3127, -2573, -2038, -1503, -1001, -592, -294, -46, 236, 590, 1012, 1454,
+    1827, 2024, 2019, 1919, 1864, 1878, 1864, 1758, 1623, 1528, 1397, 1058,
+    475, -159, -580, -699, -639, -567, -529, -443, -209, 191, 685, 1171,
+    1608, 2051, 2566, 3104, 3505, 3667, 3689, 3799, 4112, 4497, 4718, 4663,
+    4432, 4206, 4080, 4021, 3960, 3885, 3853, 3923, 4058, 4118, 3977, 3664,
+    3368, 3268, 3353, 3446, 3403, 3261, 3161, 3180, 3268, 3344, 3398, 3476,
+    3589, 3682, 3675, 3529, 3276, 2998, 2772, 2610, 2449, 2199, 1821, 1354,
+    871, 428, 57, -218, -390, -483, -544, -605, -670, -727, -762, -749,
+    -658, -490, -309, -204, -209, -280, -353, -401, -444, -504, -592, -729,
+    -946, -1260, -1644, -2044, -2415, -2732, -2989, -3205, -3417, -3661, -3927, -4161,
+    -4312, -4371, -4370, -4335, -4272, -4183, -4087, -4001, -3918, -3802, -3624, -3386,
+    -3135, -2930, -2800, -2724, -2648, -2538, -2403, -2267, -2126, -1962, -1785, -1643,
+    -1574, -1547, -1482, -1324, -1091, -835, -579, -299, 34, 416, 819, 1226,
+    1641, 2077, 2523, 2948, 3314, 3605, 3852, 4116, 4438, 4803, 5157, 5462,
+    5732, 6010, 6319, 6639, 6946, 7246, 7571, 7935, 8306, 8617, 8824, 8937,
+    9011, 9092, 9173, 9210, 9178, 9107, 9051, 9038, 9046, 9044, 9030, 9031,
+    9058, 9088, 9078, 9009, 8894, 8763, 8636, 8513, 8376, 8205, 7988, 7741,
+    7491, 7256, 7037, 6823, 6618, 6441, 6299, 6179, 6057, 5916, 5763, 5612,
+    5474, 5343, 5203, 5048, 4885, 4740, 4636, 4572, 4534, 4506, 4488, 4486,
+    4498, 4509, 4504, 4477, 4439, 4398, 4355, 4294, 4197, 4058, 3892, 3723,
+    3562, 3401, 3224, 3029, 2839, 2674, 2531, 2391, 2247, 2109, 1996, 1907,
+    1821, 1718, 1597, 1475, 1369, 1278, 1188, 1082, 956, 818, 675, 523,
+    351, 154, -58, -266, -468, -669, -876, -1078, -1253, -1386, -1480, -1546,
+    -1595, -1630, -1648, -1652, -1648, -1643, -1641, -1636, -1627, -1625, -1645, -1695,
+    -1769, -1849, -1928, -2010, -2103, -2208, -2317, -2424, -2532, -2647, -2772, -2901,
+    -3029, -3156, -3292, -3443, -3611, -3780, -3933, -4055, -4147, -4218, -4273, -4312,
+    -4334, -4343, -4346, -4351, -4353, -4348, -4336, -4326, -4331, -4357, -4400, -4452,
+    -4502, -4548, -4594, -4641, -4691, -4736, -4772, -4796, -4809, -4811, -4804, -4788,
+    -4769, -4756, -4754, -4766, -4783, -4794, -4788, -4766, -4736, -4707, -4681, -4653,
+    -4618, -4579, -4540, -4504, -4466, -4423, -4380, -4346, -4324, -4311, -4294, -4265,
+    -4224, -4179, -4137, -4097, -4053, -3997, -3928, -3850, -3766, -3678, -3584, -3489,
+    -3404, -3337, -3288, -3244, -3196, -3140, -3082, -3032, -2988, -2947, -2900, -2846,
+    -2790, -2733, -2673, -2606, -2533, -2462, -2399, -2343, -2284, -2215, -2137, -2055,
+    -1977, -1904, -1834, -1763, -1692, -1619, -1544, -1463, -1378, -1291, -1207, -1129,
+    -1057, -985, -909, -827, -740, -652, -565, -478, -390, -300, -210, -119,
+    -28, 62, 145, 217, 276, 324, 366, 405, 445, 486, 525, 562,
+    598, 633, 666, 700, 735, 775, 818, 860, 899, 933, 962, 987,
+    1011, 1034, 1057, 1078, 1097, 1113, 1128, 1145, 1165, 1189, 1215, 1243,
+    1270, 1293, 1308, 1314, 1311, 1304, 1296, 1287, 1277, 1264, 1249, 1235,
+    1223, 1213, 1205, 1198, 1193, 1189, 1185, 1177, 1162, 1139, 1111, 1078,
+    1039, 993, 935, 869, 798, 726, 656, 588, 526, 470, 425, 388,
+    359, 333, 310, 293, 283, 281, 282, 284, 286, 290, 297, 306,
+    315, 324, 333, 344, 357, 371, 383, 394, 408, 425, 446, 468,
+    490, 510, 531, 554, 579, 607, 637, 671, 708, 750, 793, 837,
+    880, 924, 968, 1013, 1057, 1098, 1136, 1173, 1208, 1244, 1280, 1316,
+    1351, 1386, 1421, 1455, 1488, 1522, 1555, 1590, 1627, 1665, 1704, 1742,
+    1781, 1821, 1862, 1905, 1949, 1993, 2038, 2083, 2126, 2169, 2210, 2249,
+    2285, 2317, 2346, 2369, 2387, 2400, 2410, 2417, 2424, 2431, 2437, 2443,
+    2448, 2452, 2456, 2458, 2459, 2458, 2455, 2449, 2441, 2428, 2412, 2394,
+    2374, 2353, 2331, 2307, 2283, 2258, 2233, 2208, 2184, 2160, 2137, 2114,
+    2091, 2066, 2038, 2007, 1975, 1941, 1908, 1876, 1844, 1813, 1783, 1755,
+    1729, 1703, 1678, 1653, 1629, 1604, 1576, 1544, 1510, 1473, 1436, 1397,
+    1358, 1317, 1276, 1236, 1197, 1160, 1124, 1091, 1061, 1035, 1010, 986,
+    962, 935, 907, 878, 847, 815, 780, 744, 706, 668, 629, 589,
+    550, 510, 471, 432, 391, 347, 301, 253, 203, 152, 98, 43,
+    -15, -75, -138, -202, -267, -334, -401, -468, -535, -603, -672, -743,
+    -814, -887, -961, -1035, -1109, -1184, -1259, -1333, -1407, -1479, -1548, -1615,
+    -1679, -1740, -1798, -1855, -1910, -1963, -2015, -2065, -2113, -2159, -2203, -2246,
+    -2289, -2330, -2370, -2408, -2446, -2482, -2516, -2549, -2580, -2611, -2640, -2668,
+    -2693, -2715, -2734, -2751, -2765, -2776, -2783, -2788, -2789, -2786, -2781, -2772,
+    -2762, -2751, -2739, -2727, -2715, -2703, -2691, -2679, -2666, -2652, -2637, -2619,
+    -2600, -2578, -2553, -2524, -2492, -2458, -2421, -2383, -2343, -2302, -2259, -2216,
+    -2172, -2128, -2083, -2039, -1995, -1950, -1906, -1860, -1814, -1767, -1719, -1670,
+    -1622, -1574, -1526, -1478, -1431, -1385, -1339, -1293, -1248, -1202, -1155, -1108,
+    -1059, -1009, -956, -903, -848, -793, -737, -682, -626, -570, -515, -461,
+    -408, -356, -305, -256, -207, -158, -110, -61, -12, 37, 86, 135,
+    184, 232, 280, 328, 373, 418, 460, 500, 539, 576, 611, 644,
+    676, 706, 735, 761, 786, 809, 829, 848, 866, 881, 895, 906,
+    916, 925, 931, 937, 941, 944, 946, 947, 947, 946, 943, 940,
+    935, 928, 921, 911, 900, 886, 872, 856, 838, 820, 800, 780,
+    760, 738, 716, 693, 669, 645, 620, 594, 568, 541, 513, 485,
+    457, 429, 401, 373, 345, 317, 290, 263, 236, 210, 184, 159,
+    134, 110, 85, 62, 39, 17, -4, -24, -42, -58, -73, -86,
+    -98, -107, -115, -122, -127, -130, -133, -135, -136, -136, -135, -133,
+    -129, -124, -118, -110, -100, -89, -77, -63, -48, -31, -13, 5,
+    24, 45, 65, 87, 109, 132, 155, 180, 205, 231, 258, 286,
+    315, 344, 374, 405, 436, 466, 497, 527, 557, 587, 617, 646,
+    675, 705, 734, 763, 793, 822, 852, 881, 911, 940, 968, 996,
+    1023, 1049, 1075, 1099, 1122, 1144, 1164, 1183, 1202, 1219, 1234, 1249,
+    1263, 1277, 1289, 1300, 1310, 1319, 1328, 1335, 1342, 1348, 1353, 1357,
+    1360, 1363, 1365, 1366, 1367, 1367, 1365, 1363, 1360, 1356, 1350, 1344,
+    1336, 1328, 1319, 1308, 1297, 1284, 1271, 1257, 1243, 1227, 1211, 1195,
+    1178, 1160, 1141, 1121, 1101, 1080, 1058, 1035, 1012, 988, 963, 937,
+    910, 883, 856, 827, 798, 769, 739, 708, 677, 645, 612, 579,
+    546, 513, 479, 446, 412, 378, 344, 311, 277, 243, 210, 176,
+    142, 108, 73, 39, 3, -32, -68, -104, -140, -177, -213, -249,
+    -285, -320, -355, -390, -424, -457, -491, -523, -555, -587, -618, -649,
+    -680, -710, -740, -769, -797, -826, -853, -880, -906, -931, -955, -979,
+    -1002, -1024, -1045, -1065, -1084, -1103, -1120, -1137, -1153, -1167, -1181, -1193,
+    -1205, -1215, -1224, -1232, -1239, -1246, -1251, -1256, -1260, -1263, -1265, -1267,
+    -1268, -1269, -1269, -1268, -1266, -1263, -1260, -1256, -1251, -1245, -1238, -1230,
+    -1222, -1212, -1202, -1192, -1180, -1168, -1156, -1142, -1128, -1114, -1099, -1083,
+    -1067, -1050, -1033, -1015, -996, -977, -958, -938, -918, -897, -876, -854,
+    -832, -810, -787, -764, -741, -718, -694, -670, -646, -622, -598, -574,
+    -551, -527, -503, -480, -457, -434, -412, -389, -367, -345, -324, -302,
+    -281, -260, -240, -220, -200, -180, -161, -143, -124, -107, -89, -73,
+    -56, -40, -24, -9, 5, 20, 34, 47, 60, 72, 84, 95,
+    106, 116, 125, 134, 143, 151, 158, 165, 172, 178, 184, 190,
+    195, 200, 205, 209, 212, 215, 218, 220, 222, 223, 224, 224,
+    224, 223, 222, 221, 219, 217, 215, 213, 210, 207, 204, 201,
+    197, 193, 189, 184, 179, 174, 169, 164, 158, 152, 147, 141,
+    134, 128, 122, 116, 109, 103, 96, 89, 82, 76, 69, 62,
+    56, 49, 43, 37, 31, 25, 20, 15, 10, 5, 1, -3,
+    -6, -9, -12, -15, -17, -18, -20, -21, -21, -21, -21, -20,
+    -19, -17, -15, -12, -9, -5, -1, 4, 9, 15, 21, 28,
+    35, 43, 51, 59, 68, 78, 87, 97, 107, 117, 128, 139,
+    150, 161, 173, 184, 196, 208, 220, 233, 245, 258, 271, 284,
+    297, 310, 323, 336, 350, 363, 376, 389, 402, 414, 427, 439,
+    452, 464, 475, 487, 498, 509, 520, 530, 540, 550, 559, 568,
+    577, 585, 592, 600, 606, 613, 619, 624, 630, 634, 638, 642,
+    645, 647, 649, 651, 652, 652, 652, 651, 649, 648, 645, 642,
+    639, 636, 632, 627, 622, 617, 611, 605, 599, 592, 585, 578,
+    570, 561, 553, 544, 534, 525, 515, 504, 494, 483, 472, 461,
+    449, 438, 426, 414, 401, 389, 376, 363, 351, 338, 324, 311,
+    298, 284, 271, 257, 243, 230, 216, 202, 188, 174, 160, 146,
+    132, 117, 103, 89, 75, 61, 47, 33, 20, 6, -7, -21,
+    -34, -47, -60, -73, -86, -99, -111, -124, -136, -148, -160, -172,
+    -184, -195, -206, -217, -228, -239, -249, -260, -270, -280, -289, -299,
+    -308, -317, -325, -334, -342, -349, -357, -364, -371, -378, -385, -391,
+    -397, -403, -409, -414, -419, -424, -428, -432, -436, -440, -443, -447,
+    -449, -452, -454, -456, -458, -459, -460, -461, -462, -463, -463, -463,
+    -462, -462, -461, -460, -459, -457, -456, -454, -452, -449, -447, -444,
+    -441, -438, -435, -432, -428, -424, -420, -416, -412, -408, -403, -398,
+    -393, -388, -383, -378, -373, -367, -362, -356, -351, -345, -339, -334,
+    -328, -322, -316, -310, -305, -299, -293, -287, -281, -275, -269, -263,
+    -258, -252, -246, -240, -234, -229, -223, -217, -212, -206, -201, -195,
+    -190, -184, -179, -173, -168, -163, -158, -153, -147, -142, -137, -132,
+    -127, -122, -118, -113, -108, -103, -98, -94, -89, -84, -80, -75,
+    -71, -66, -62, -57, -53, -49, -45, -41, -37, -33, -29, -26,
+    -22, -19, -15, -12, -9, -5, -2, 1, 4, 6, 9, 12,
+    14, 17, 19, 22, 24, 26, 28, 30, 32, 33, 35, 37,
+    38, 40, 41, 42, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 55, 56, 57, 58, 58, 59, 60, 60,
+    61, 62, 63, 63, 64, 65, 65, 66, 67, 68, 69, 69,
+    70, 71, 72, 73, 74, 75, 76, 78, 79, 80, 81, 83,
+    84, 86, 87, 89, 90, 92, 94, 96, 97, 99, 101, 103,
+    105, 108, 110, 112, 114, 117, 119, 122, 124, 127, 129, 132,
+    135, 137, 140, 143, 146, 148, 151, 154, 157, 160, 162, 165,
+    168, 171, 174, 176, 179, 182, 185, 187, 190, 193, 195, 198,
+    200, 203, 205, 208, 210, 212, 214, 216, 218, 220, 222, 223,
+    225, 226, 228, 229, 230, 231, 232, 233, 234, 234, 235, 235,
+    236, 236, 236, 236, 236, 235, 235, 234, 234, 233, 232, 231,
+    230, 229, 227, 226, 224, 222, 221, 219, 217, 215, 212, 210,
+    208, 205, 202, 200, 197, 194, 191, 188, 185, 182, 178, 175,
+    172, 168, 164, 161, 157, 153, 149, 145, 141, 137, 133, 129,
+    125, 121, 116, 112, 108, 103, 99, 94, 90, 85, 81, 76,
+    72, 67, 62, 58, 53, 48, 44, 39, 34, 30, 25, 20,
+    16, 11, 7, 2, -3, -7, -12, -16, -21, -25, -30, -34,
+    -39, -43, -47, -52, -56, -60, -64, -68, -72, -76, -80, -84,
+    -88, -91, -95, -99, -102, -106, -109, -112, -115, -119, -122, -125,
+    -127, -130, -133, -135, -138, -140, -143, -145, -147, -149, -151, -152,
+    -154, -156, -157, -159, -160, -161, -162, -163, -164, -164, -165, -165,
+    -166, -166, -166, -166, -166, -166, -166, -165, -165, -165, -164, -163,
+    -162, -162, -161, -159, -158, -157, -156, -155, -153, -152, -150, -148,
+    -147, -145, -143, -141, -139, -137, -135, -133, -131, -129, -127, -125,
+    -122, -120, -118, -115, -113, -111, -108, -106, -103, -101, -98, -96,
+    -93, -91, -89, -86, -84, -81, -79, -76, -74, -72, -69, -67,
+    -64, -62, -60, -58, -55, -53, -51, -49, -47, -45, -43, -41,
+    -39, -37, -35, -33, -31, -29, -28, -26, -24, -23, -21, -20,
+    -18, -17, -16, -14, -13, -12, -11, -10, -8, -7, -6, -6,
+    -5, -4, -3, -2, -1, -1, 0, 1, 1, 2, 2, 3,
+    3, 3, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 4, 4,
+    4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const ImpulseResponse IR_ACOUSTIC_BODY = {"dread", IR_ACOUSTIC_BODY_DATA, 2304, 3.455213e-06f};
+const ImpulseResponse IR_PARLOR_BODY = {"parlor", IR_PARLOR_BODY_DATA, 2304, 3.897185e-06f};
+
+const ImpulseResponse *const IMPULSE_RESPONSES[IMPULSE_RESPONSE_COUNT] = {&IR_ACOUSTIC_BODY, &IR_PARLOR_BODY};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+
+/// @brief An impulse response kept in flash: Q15 taps plus the factor that
+/// takes them back to their real size. The taps are normalized to full
+/// scale so short IRs keep their resolution; `scale` makes the whole IR
+/// unit energy, so the wet signal is about as loud as the dry.
+struct ImpulseResponse
+{
+    const char *name;
+    const int16_t *samples;
+    uint16_t length;
+    float scale;
+};
+
+// guitar bodies, ~52ms each
+extern const ImpulseResponse IR_ACOUSTIC_BODY;
+extern const ImpulseResponse IR_PARLOR_BODY;
+
+#define IMPULSE_RESPONSE_COUNT 2
+extern const ImpulseResponse *const IMPULSE_RESPONSES[IMPULSE_RESPONSE_COUNT];
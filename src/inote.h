@@ -1,5 +1,6 @@
 #pragma once
 #include <Audio.h>
+#include "node_activity.h"
 
 // Interface for all note types
 class INote
@@ -25,6 +26,10 @@ public:
     // prevent note from using cpu
     virtual void disable() = 0;
 
+    // take the note's nodes off the audio update pass entirely (or put them
+    // back). Only call while the note is disabled.
+    virtual void park(bool parked) = 0;
+
     virtual void setFrequency(float freq) = 0;
     virtual AudioStream &getOutputLeft() = 0;
     virtual AudioStream &getOutputRight() = 0;
@@ -14,6 +14,9 @@ public:
     virtual void begin() = 0;
     virtual void enable() = 0;
     virtual void disable() = 0;
+    /// @brief take the whole layer, notes and mixers, off the audio update
+    /// pass (or put it back). Only call while the layer is disabled.
+    virtual void park(bool parked) = 0;
     virtual void noteOn(int index) = 0;
     virtual void noteOff(int index) = 0;
     virtual AudioStream &getOutputLeft() = 0;
@@ -37,6 +40,18 @@ public:
     AudioStream &getOutputRight() { return finalRight; }
     T notes[ILayer::NOTES_PER_ROW];
 
+    void park(bool parked)
+    {
+        for (size_t i = 0; i < ILayer::NOTES_PER_ROW; i++)
+            notes[i].park(parked);
+        NodeActivity::set(mixLeft1, !parked);
+        NodeActivity::set(mixLeft2, !parked);
+        NodeActivity::set(finalLeft, !parked);
+        NodeActivity::set(mixRight1, !parked);
+        NodeActivity::set(mixRight2, !parked);
+        NodeActivity::set(finalRight, !parked);
+    }
+
 protected:
     friend class Layer<T>;
 
@@ -103,6 +118,14 @@ public:
                       { note.disable(); });
     }
 
+    void park(bool parked)
+    {
+        for (size_t j = 0; j < ROW_COUNT; j++)
+            rows[j].park(parked);
+        NodeActivity::set(finalLeft, !parked);
+        NodeActivity::set(finalRight, !parked);
+    }
+
     void noteOn(int index)
     {
         rows[index / NOTES_PER_ROW].notes[index % NOTES_PER_ROW].noteOn();
@@ -137,3 +160,120 @@ protected:
     AudioConnection patchRF3{rows[2].getOutputRight(), 0, finalRight, 2};
     AudioConnection patchRF4{rows[3].getOutputRight(), 0, finalRight, 3};
 };
+
+/// @brief A layer whose keys share one row of voices instead of having a
+/// note each, for notes too big to keep 32 of. A key takes back the voice
+/// it last played if that is free, else the voice released longest ago,
+/// else the one that started longest ago, and is tuned as it starts.
+template <typename T>
+class PooledLayer : public ILayer
+{
+public:
+    static const size_t VOICES = NOTES_PER_ROW;
+    static const size_t KEYS = ROW_COUNT * NOTES_PER_ROW;
+
+    PooledLayer()
+    {
+        for (size_t i = 0; i < VOICES; i++)
+            keys[i] = -1;
+    }
+
+    template <typename Func>
+    inline void for_all_notes(Func operation)
+    {
+        for (size_t i = 0; i < VOICES; i++)
+            operation(voices.notes[i]);
+    }
+
+    virtual void begin()
+    {
+        for_all_notes([](INote &note)
+                      { note.begin(); });
+    }
+
+    void enable()
+    {
+        for_all_notes([](INote &note)
+                      { note.enable(); });
+    }
+
+    void disable()
+    {
+        for_all_notes([](INote &note)
+                      { note.disable(); });
+        for (size_t i = 0; i < VOICES; i++)
+            held[i] = false;
+    }
+
+    void park(bool parked) { voices.park(parked); }
+
+    void noteOn(int index)
+    {
+        if (index < 0 || (size_t)index >= KEYS)
+            return;
+        size_t voice = pick(index);
+        keys[voice] = index;
+        held[voice] = true;
+        started[voice] = ++events;
+        tune(voices.notes[voice], frequencies[index]);
+        voices.notes[voice].noteOn();
+    }
+
+    void noteOff(int index)
+    {
+        for (size_t i = 0; i < VOICES; i++)
+            if (held[i] && keys[i] == index)
+            {
+                held[i] = false;
+                released[i] = ++events;
+                voices.notes[i].noteOff();
+            }
+    }
+
+    AudioStream &getOutputLeft() { return voices.getOutputLeft(); }
+    AudioStream &getOutputRight() { return voices.getOutputRight(); }
+
+    virtual void setScale(float const *scale)
+    {
+        memcpy(frequencies, scale, sizeof(frequencies));
+    }
+
+protected:
+    Row<T> voices;
+
+    /// @brief set a voice up to play a key, just before its noteOn
+    virtual void tune(T &note, float frequency)
+    {
+        note.setFrequency(frequency);
+    }
+
+private:
+    float frequencies[KEYS] = {0};
+    int keys[VOICES];
+    bool held[VOICES] = {false};
+    // when each voice last started and was last released, counted in
+    // note events; 0 for never
+    uint32_t started[VOICES] = {0};
+    uint32_t released[VOICES] = {0};
+    uint32_t events = 0;
+
+    size_t pick(int index)
+    {
+        for (size_t i = 0; i < VOICES; i++)
+            if (!held[i] && keys[i] == index)
+                return i;
+
+        size_t best = VOICES;
+        for (size_t i = 0; i < VOICES; i++)
+            if (!held[i] && (best == VOICES || released[i] < released[best]))
+                best = i;
+        if (best < VOICES)
+            return best;
+
+        best = 0;
+        for (size_t i = 1; i < VOICES; i++)
+            if (started[i] < started[best])
+                best = i;
+        return best;
+    }
+};
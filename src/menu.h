@@ -21,6 +21,10 @@ public:
     virtual void display(Adafruit_GFX &d) = 0;
     virtual void begin() = 0;
 
+    // called when this setting's encoder button is pressed.
+    // return true to consume the press instead of changing slides
+    virtual bool buttonDown() { return false; }
+
 protected:
     // Protected constructor prevents instantiation of interface
     ISetting() = default;
@@ -102,6 +106,8 @@ public:
         set(initialValue);
     }
 
+    V get() const { return value; }
+
     void publish()
     {
         publisher(value);
@@ -151,6 +157,35 @@ public:
 template <typename V>
 Setting(const char *, V, V, V, V (*)(V), V (*)(V), void (*)(V), int (*)(V)) -> Setting<V>;
 
+/// @brief A setting that does something when its encoder button is pressed,
+/// e.g. tap tempo. Turning the encoder does nothing.
+class ButtonSetting : public ISetting
+{
+    using Action = void (*)();
+    using Displayer = void (*)(Adafruit_GFX &);
+
+private:
+    Action action;
+    Displayer displayer;
+
+public:
+    ButtonSetting(Action action_, Displayer displayer_)
+        : action(action_), displayer(displayer_) {}
+
+    void increment() {}
+    void decrement() {}
+    void publish() {}
+    void begin() {}
+
+    void display(Adafruit_GFX &d) { displayer(d); }
+
+    bool buttonDown()
+    {
+        action();
+        return true;
+    }
+};
+
 template <size_t N, typename... Args>
 class Menu
 {
@@ -160,8 +195,20 @@ class Menu
     int currentSlide = 0;
     bool leftIsDown = false;
     bool rightIsDown = false;
+    // a press changes slides when it is let go, unless it was used for
+    // something else in the meantime: its setting took it, the encoders
+    // were turned while it was held, or both buttons were held together
+    // (the sketch uses that chord on its own)
+    bool leftPressUsed = false;
+    bool rightPressUsed = false;
     bool began = false;
 
+    void turnedWhileHeld()
+    {
+        leftPressUsed = leftPressUsed || leftIsDown;
+        rightPressUsed = rightPressUsed || rightIsDown;
+    }
+
 public:
     Menu(Adafruit_SSD1306 &gfx_,
          Args... slides_)
@@ -220,29 +267,46 @@ public:
     void leftDown()
     {
         leftIsDown = true;
-        prevSlide();
+        leftPressUsed = rightIsDown;
+        rightPressUsed = rightPressUsed || rightIsDown;
+        if (!leftPressUsed && slides[currentSlide].left.buttonDown())
+        {
+            leftPressUsed = true;
+            display();
+        }
     }
 
     void leftUp()
     {
         leftIsDown = false;
+        if (!leftPressUsed)
+            prevSlide();
     }
 
     void rightDown()
     {
         rightIsDown = true;
-        nextSlide();
+        rightPressUsed = leftIsDown;
+        leftPressUsed = leftPressUsed || leftIsDown;
+        if (!rightPressUsed && slides[currentSlide].right.buttonDown())
+        {
+            rightPressUsed = true;
+            display();
+        }
     }
 
     void rightUp()
     {
         rightIsDown = false;
+        if (!rightPressUsed)
+            nextSlide();
     }
 
     void leftInc(int delta)
     {
         if (leftIsDown || rightIsDown)
         {
+            turnedWhileHeld();
             nextSlide();
         }
         else
@@ -260,6 +324,7 @@ public:
     {
         if (leftIsDown || rightIsDown)
         {
+            turnedWhileHeld();
             prevSlide();
         }
         else
@@ -277,6 +342,7 @@ public:
     {
         if (leftIsDown || rightIsDown)
         {
+            turnedWhileHeld();
             nextSlide();
         }
         else
@@ -294,6 +360,7 @@ public:
     {
         if (leftIsDown || rightIsDown)
         {
+            turnedWhileHeld();
             prevSlide();
         }
         else
@@ -52,40 +52,31 @@ const SampleData MeowSamples[] = {
 
 const size_t MEOW_SAMPLE_COUNT = sizeof(MeowSamples) / sizeof(MeowSamples[0]);
 
-class MeowLayer : public Layer<SampleNote>
+class MeowLayer : public PooledLayer<SampleNote>
 {
-
-public:
-    virtual void setScale(float const *frequencies)
+protected:
+    virtual void tune(SampleNote &note, float freq)
     {
-        for (size_t j = 0; j < ROW_COUNT; j++)
-            for (size_t i = 0; i < NOTES_PER_ROW; i++)
+        // set the frequency
+        note.setFrequency(freq);
+
+        // now set the best sample
+        const SampleData *bestSample = &MeowSamples[0];
+        float bestDelta = std::fabs(bestSample->referenceFrequency - freq);
+        for (size_t k = 1; k < MEOW_SAMPLE_COUNT; k++)
+        {
+            const SampleData *thisSample = &MeowSamples[k];
+            float thisDelta = std::fabs(thisSample->referenceFrequency - freq);
+
+            if (thisDelta < bestDelta)
             {
-                SampleNote &note = rows[j].notes[i];
-                float freq = *(frequencies++);
-
-                // set the frequency
-                note.setFrequency(freq);
-
-                // now set the best sample
-                const SampleData *bestSample = &MeowSamples[0];
-                float bestDelta = std::fabs(bestSample->referenceFrequency - freq);
-                for (size_t k = 1; k < MEOW_SAMPLE_COUNT; k++)
-                {
-                    const SampleData *thisSample = &MeowSamples[k];
-                    float thisDelta = std::fabs(thisSample->referenceFrequency - freq);
-
-                    if (thisDelta < bestDelta)
-                    {
-                        bestDelta = thisDelta;
-                        bestSample = thisSample;
-                    }
-
-                    note.setSample(bestSample->data, bestSample->length, bestSample->referenceFrequency);
-                }
-
-                // these meows is quiet!
-                note.setGain(4.0);
+                bestDelta = thisDelta;
+                bestSample = thisSample;
             }
+        }
+        note.setSample(bestSample->data, bestSample->length, bestSample->referenceFrequency);
+
+        // these meows is quiet!
+        note.setGain(4.0);
     }
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include "inote.h"
+#include "layer.h"
+#include "synth_modal.h"
+
+/// @brief A struck, tuned percussion note (marimba, glockenspiel, bell).
+/// Notes ring out whether or not the key is held, and take themselves off
+/// the update pass once they have.
+class ModalNote : public INote
+{
+private:
+    AudioSynthModal modal;
+
+public:
+    void begin() override {}
+
+    void noteOn() override { modal.strike(0.8f); }
+    // struck bars aren't damped when the mallet comes off
+    void noteOff() override {}
+
+    void enable() override {}
+    void disable() override { modal.stop(); }
+
+    // a parked voice is only woken by strike(), which can't happen while
+    // the layer is disabled
+    void park(bool parked) override
+    {
+        if (parked)
+            NodeActivity::set(modal, false);
+    }
+
+    void setFrequency(float freq) override { modal.frequency(freq); }
+    void preset(const ModalPreset &p) { modal.preset(p); }
+    void decayScale(float scale) { modal.decayScale(scale); }
+
+    AudioStream &getOutputLeft() override { return modal; }
+    AudioStream &getOutputRight() override { return modal; }
+};
+
+/// @brief Bars ring on after their key is let go, and a row of voices is
+/// shared between the keys, so eight bars at most ring at once. A new
+/// strike cuts the bar whose key was let go longest ago.
+class ModalLayer : public PooledLayer<ModalNote>
+{
+public:
+    /// @brief pick one of MODAL_PRESETS for every note
+    void preset(int index)
+    {
+        if (index < 0 || index >= MODAL_PRESET_COUNT)
+            return;
+        for_all_notes([index](ModalNote &note)
+                      { note.preset(MODAL_PRESETS[index]); });
+    }
+
+    void decayScale(float scale)
+    {
+        for_all_notes([scale](ModalNote &note)
+                      { note.decayScale(scale); });
+    }
+};
@@ -0,0 +1,15 @@
+#pragma once
+#include <Audio.h>
+
+/// @brief Switches a node's `active` flag, which the audio library keeps
+/// protected. The library skips inactive nodes on its update pass, so this
+/// is how a FilterChain runs its filters' nodes itself, in chain order, and
+/// how idle voices are taken off the pass altogether.
+class NodeActivity : public AudioStream
+{
+public:
+    static void set(AudioStream &node, bool active_)
+    {
+        node.*(&NodeActivity::active) = active_;
+    }
+};
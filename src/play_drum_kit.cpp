@@ -0,0 +1,156 @@
+#include "play_drum_kit.h"
+
+// u-law to 16 bit linear as wav2sketch encodes it, the same table as the
+// audio library's AudioPlayMemory. Unlike G.711 the codes aren't inverted:
+// 0 is the smallest positive step and 0x80 the smallest negative one.
+static const int16_t ULAW_DECODE[256] = {
+    4, 12, 20, 28, 36, 44, 52, 60,
+    68, 76, 84, 92, 100, 108, 116, 124,
+    136, 152, 168, 184, 200, 216, 232, 248,
+    264, 280, 296, 312, 328, 344, 360, 376,
+    400, 432, 464, 496, 528, 560, 592, 624,
+    656, 688, 720, 752, 784, 816, 848, 880,
+    928, 992, 1056, 1120, 1184, 1248, 1312, 1376,
+    1440, 1504, 1568, 1632, 1696, 1760, 1824, 1888,
+    1984, 2112, 2240, 2368, 2496, 2624, 2752, 2880,
+    3008, 3136, 3264, 3392, 3520, 3648, 3776, 3904,
+    4096, 4352, 4608, 4864, 5120, 5376, 5632, 5888,
+    6144, 6400, 6656, 6912, 7168, 7424, 7680, 7936,
+    8320, 8832, 9344, 9856, 10368, 10880, 11392, 11904,
+    12416, 12928, 13440, 13952, 14464, 14976, 15488, 16000,
+    16768, 17792, 18816, 19840, 20864, 21888, 22912, 23936,
+    24960, 25984, 27008, 28032, 29056, 30080, 31104, 32128,
+    -4, -12, -20, -28, -36, -44, -52, -60,
+    -68, -76, -84, -92, -100, -108, -116, -124,
+    -136, -152, -168, -184, -200, -216, -232, -248,
+    -264, -280, -296, -312, -328, -344, -360, -376,
+    -400, -432, -464, -496, -528, -560, -592, -624,
+    -656, -688, -720, -752, -784, -816, -848, -880,
+    -928, -992, -1056, -1120, -1184, -1248, -1312, -1376,
+    -1440, -1504, -1568, -1632, -1696, -1760, -1824, -1888,
+    -1984, -2112, -2240, -2368, -2496, -2624, -2752, -2880,
+    -3008, -3136, -3264, -3392, -3520, -3648, -3776, -3904,
+    -4096, -4352, -4608, -4864, -5120, -5376, -5632, -5888,
+    -6144, -6400, -6656, -6912, -7168, -7424, -7680, -7936,
+    -8320, -8832, -9344, -9856, -10368, -10880, -11392, -11904,
+    -12416, -12928, -13440, -13952, -14464, -14976, -15488, -16000,
+    -16768, -17792, -18816, -19840, -20864, -21888, -22912, -23936,
+    -24960, -25984, -27008, -28032, -29056, -30080, -31104, -32128,
+};
+
+void AudioPlayDrumKit::trigger(const unsigned int *sample, float speed, float gain, uint8_t chokeGroup)
+{
+    const uint32_t format = sample[0] >> 24;
+    const uint32_t length = sample[0] & 0xffffff;
+    // 16.16 step at speed 1, the sample rate over ours
+    uint32_t baseStep;
+    if (format == 0x01)
+        baseStep = 0x10000;
+    else if (format == 0x02)
+        baseStep = 0x8000;
+    else
+        return; // only u-law is decoded here
+    // positions are 16.16, so samples are up to 64k long
+    if (length < 2 || length > 0xffff || speed <= 0)
+        return;
+
+    AudioNoInterrupts();
+    if (chokeGroup)
+        for (int n = 0; n < DRUM_VOICES; n++)
+            if (voices[n].data && voices[n].chokeGroup == chokeGroup)
+                voices[n].fading = true;
+
+    // a free voice, else the oldest sounding one
+    Voice *voice = NULL;
+    uint32_t oldest = 0;
+    for (int n = 0; n < DRUM_VOICES; n++)
+    {
+        if (!voices[n].data)
+        {
+            voice = &voices[n];
+            break;
+        }
+        uint32_t age = triggers - voices[n].started;
+        if (!voice || age > oldest)
+        {
+            voice = &voices[n];
+            oldest = age;
+        }
+    }
+
+    voice->data = (const uint8_t *)(sample + 1);
+    voice->length = length;
+    voice->position = 0;
+    voice->step = (uint32_t)(baseStep * speed);
+    voice->gain = (int32_t)(constrain(gain, 0.0f, 2.0f) * 32767.0f);
+    voice->chokeGroup = chokeGroup;
+    voice->fading = false;
+    voice->started = triggers++;
+    active = true;
+    AudioInterrupts();
+}
+
+void AudioPlayDrumKit::stop()
+{
+    AudioNoInterrupts();
+    for (int n = 0; n < DRUM_VOICES; n++)
+        voices[n].data = NULL;
+    active = false;
+    AudioInterrupts();
+}
+
+void AudioPlayDrumKit::update(void)
+{
+    bool playing = false;
+    for (int n = 0; n < DRUM_VOICES; n++)
+        playing |= voices[n].data != NULL;
+    if (!playing)
+    {
+        active = false;
+        return;
+    }
+
+    audio_block_t *block = allocate();
+    if (!block)
+        return;
+
+    int32_t mix[AUDIO_BLOCK_SAMPLES] = {0};
+    for (int n = 0; n < DRUM_VOICES; n++)
+    {
+        Voice &v = voices[n];
+        if (!v.data)
+            continue;
+
+        const uint8_t *data = v.data;
+        // the last position with a sample after it to interpolate to
+        const uint32_t end = (v.length - 1) << 16;
+        const uint32_t step = v.step;
+        uint32_t pos = v.position;
+        int32_t gain = v.gain;
+        // a choked voice ramps down to silence over this block
+        const int32_t fade = v.fading ? gain / AUDIO_BLOCK_SAMPLES : 0;
+
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES && pos < end; i++)
+        {
+            uint32_t index = pos >> 16;
+            int32_t a = ULAW_DECODE[data[index]];
+            int32_t b = ULAW_DECODE[data[index + 1]];
+            int32_t frac = (pos & 0xffff) >> 1;
+            int32_t sample = a + (((b - a) * frac) >> 15);
+            mix[i] += (sample * gain) >> 15;
+            gain -= fade;
+            pos += step;
+        }
+
+        if (pos >= end || v.fading)
+            v.data = NULL;
+        else
+            v.position = pos;
+    }
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        block->data[i] = constrain(mix[i], -32768, 32767);
+
+    transmit(block);
+    release(block);
+}
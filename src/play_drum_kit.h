@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+
+// most hits sounding at once; a new one past that takes the oldest's voice
+#define DRUM_VOICES 6
+
+/// @brief Plays one shot samples for a whole kit from a small pool of
+/// voices, mixed into one output, instead of a player per key.
+///
+/// Samples are in the wav2sketch layout (see AudioSampleDrums.h), u-law at
+/// 44.1kHz (format 0x01) or 22.05kHz (0x02), up to 64k samples long, and
+/// are decoded as they play with linear interpolation between samples.
+/// The work is bounded by DRUM_VOICES however fast the pads are hit.
+///
+/// Hits in the same choke group cut each other off, e.g. the closed hat
+/// stops an open one ringing. A choked voice fades out over one block
+/// rather than clicking. The node takes itself off the update pass once
+/// nothing is playing.
+///
+/// No inputs. Output: 0 = mono.
+class AudioPlayDrumKit : public AudioStream
+{
+public:
+    AudioPlayDrumKit(void) : AudioStream(0, NULL) {}
+
+    /// @brief start a sample. speed 1 plays it at its own pitch, gain is
+    /// linear, choke group 0 chokes nothing.
+    void trigger(const unsigned int *sample, float speed, float gain, uint8_t chokeGroup);
+
+    /// @brief silence every voice at once
+    void stop();
+
+    virtual void update(void);
+
+private:
+    struct Voice
+    {
+        const uint8_t *data = NULL;
+        uint32_t length = 0;
+        // 16.16 fixed point position and step, in samples of the data
+        uint32_t position = 0;
+        uint32_t step = 0;
+        // Q15
+        int32_t gain = 0;
+        uint8_t chokeGroup = 0;
+        bool fading = false;
+        // trigger count when started, to find the oldest
+        uint32_t started = 0;
+    };
+    Voice voices[DRUM_VOICES];
+    uint32_t triggers = 0;
+};
@@ -1,10 +1,11 @@
 #include <Audio.h>
+#include "effect_kernel.h"
 
-class AudioPlayPlayMemoryVariable : public AudioStream
+/// @brief Plays an int16 sample from memory at a variable speed with
+/// linear interpolation.
+class VariableRatePlayer : public MonoGenerator
 {
 public:
-    AudioPlayPlayMemoryVariable(void) : AudioStream(0, NULL) {}
-
     void play(const int16_t *data, uint32_t length);
 
     void stop(void)
@@ -16,7 +17,7 @@ public:
 
     void setSpeed(float new_speed) { speed = new_speed; }
 
-    virtual void update(void);
+    void process(float *out, size_t frames);
 
 private:
     volatile bool playing = false;
@@ -27,4 +28,15 @@ private:
 
     /// @brief fast forward to the first zero crossing to avoid a starting click.
     void findZeroCrossing();
-};
\ No newline at end of file
+};
+
+class AudioPlayPlayMemoryVariable : public AudioPlayKernel<VariableRatePlayer>
+{
+public:
+    void play(const int16_t *data, uint32_t length)
+    {
+        AudioNoInterrupts();
+        VariableRatePlayer::play(data, length);
+        AudioInterrupts();
+    }
+};
@@ -1,13 +1,16 @@
 #include "polysynth32.h"
 
-Polysynth32::Polysynth32() {}
+Polysynth32::Polysynth32()
+{
+    inserts.connectTo(returnMixLeft, 0, returnMixRight, 0);
+    sends.connectTo(sendReturnLeft, 0, sendReturnRight, 0);
+    // off until tracking is turned on
+    NodeActivity::set(pitchTracker, false);
+}
 
 void Polysynth32::setupScales()
 {
 
-    // Scale configuration
-    float scale[ILayer::NOTES_PER_ROW * ILayer::ROW_COUNT];
-
     scaleGen.generateFullScale(scale);
     // // Row 1: C3 pentatonic
     // scale[0] = 130.81; // C3
@@ -32,11 +35,17 @@ void Polysynth32::setupScales()
     // Set scales for each row
     for (int j = 0; j < LAYER_COUNT; j++)
         layers[j]->setScale(scale);
+
+    // and retune the effects that follow the scale
+    inserts.setScale(scale);
+    sends.setScale(scale);
+    master.setScale(scale);
 }
 
 void Polysynth32::begin()
 {
     setupScales();
+    setInputLevel(inputLevel);
 
     // Initialize synth layers
     for (int i = 0; i < LAYER_COUNT; i++)
@@ -48,19 +57,150 @@ void Polysynth32::begin()
 void Polysynth32::selectVoice(uint8_t idx)
 {
     currentLayer = idx;
+    // the new layer starts with no tracked note down
+    trackedKey = -1;
+    // the voice is picked up again when the layers are unparked
+    if (inputMode == INPUT_FX_ONLY)
+        return;
+
     for (int i = 0; i < LAYER_COUNT; i++)
     {
         if (i == idx)
         {
-            finalMixLeft.gain(i, 1.0);
-            finalMixRight.gain(i, 1.0);
+            layerGain(i, 1.0, sendLevels[i]);
             layers[i]->enable();
         }
         else
         {
-            finalMixLeft.gain(i, 0);
-            finalMixRight.gain(i, 0);
+            layerGain(i, 0, 0);
             layers[i]->disable();
         }
     }
 }
+
+void Polysynth32::setSendLevel(float level)
+{
+    sendLevels[currentLayer] = level;
+    layerGain(currentLayer, 1.0, level);
+}
+
+void Polysynth32::layerGain(int layer, float dry, float send)
+{
+    int mixer = layer / 4;
+    int port = layer % 4;
+    layerMixLeft[mixer].gain(port, dry);
+    layerMixRight[mixer].gain(port, dry);
+    sendLayerMixLeft[mixer].gain(port, send);
+    sendLayerMixRight[mixer].gain(port, send);
+}
+
+void Polysynth32::setInputMode(int mode)
+{
+    InputMode newMode = (InputMode)constrain(mode, 0, INPUT_MODE_COUNT - 1);
+    bool wasParked = inputMode == INPUT_FX_ONLY;
+    bool parked = newMode == INPUT_FX_ONLY;
+    inputMode = newMode;
+
+    if (parked != wasParked)
+    {
+        if (parked)
+        {
+            for (int i = 0; i < LAYER_COUNT; i++)
+                layers[i]->disable();
+        }
+
+        // with no voices running their mixers only ever see silence, so
+        // they come off the update pass too
+        AudioNoInterrupts();
+        for (int i = 0; i < LAYER_COUNT; i++)
+            layers[i]->park(parked);
+        for (int i = 0; i < LAYER_MIXERS; i++)
+        {
+            NodeActivity::set(layerMixLeft[i], !parked);
+            NodeActivity::set(layerMixRight[i], !parked);
+            NodeActivity::set(sendLayerMixLeft[i], !parked);
+            NodeActivity::set(sendLayerMixRight[i], !parked);
+        }
+        NodeActivity::set(finalMixLeft, !parked);
+        NodeActivity::set(finalMixRight, !parked);
+        NodeActivity::set(sendMixLeft, !parked);
+        NodeActivity::set(sendMixRight, !parked);
+        AudioInterrupts();
+
+        if (!parked)
+            selectVoice(currentLayer);
+    }
+
+    setInputLevel(inputLevel);
+}
+
+void Polysynth32::setInputLevel(float level)
+{
+    inputLevel = level;
+    float gain = inputMode == INPUT_OFF ? 0.0f : level;
+    dryMixLeft.gain(1, gain);
+    dryMixRight.gain(1, gain);
+    sendTotalLeft.gain(1, gain);
+    sendTotalRight.gain(1, gain);
+}
+
+void Polysynth32::setPitchTracking(bool on)
+{
+    tracking = on;
+    NodeActivity::set(pitchTracker, on);
+    if (!on && trackedKey >= 0)
+    {
+        playTracked(trackedKey, false);
+        trackedKey = -1;
+    }
+    pendingKey = -1;
+}
+
+int Polysynth32::nearestKey(float hz)
+{
+    int nearest = 0;
+    float nearestRatio = 0;
+    for (int i = 0; i < ILayer::NOTES_PER_ROW * (int)ILayer::ROW_COUNT; i++)
+    {
+        float ratio = hz > scale[i] ? hz / scale[i] : scale[i] / hz;
+        if (i == 0 || ratio < nearestRatio)
+        {
+            nearest = i;
+            nearestRatio = ratio;
+        }
+    }
+    return nearest;
+}
+
+void Polysynth32::trackPitch()
+{
+    if (!tracking || !pitchTracker.available())
+        return;
+
+    float hz = pitchTracker.read();
+    int key = hz > 0 ? nearestKey(hz) : -1;
+
+    // only move once two estimates in a row agree, so a glitch in one
+    // analysis doesn't retrigger the note
+    bool agreed = key == pendingKey;
+    pendingKey = key;
+    if (!agreed || key == trackedKey)
+        return;
+
+    if (trackedKey >= 0)
+        playTracked(trackedKey, false);
+    trackedKey = key;
+    if (key >= 0)
+        playTracked(key, true);
+}
+
+// like noteOn/noteOff, but leaves the held keys to the grid
+void Polysynth32::playTracked(int key, bool on)
+{
+    if (inputMode == INPUT_FX_ONLY)
+        return;
+    if (on)
+        layers[currentLayer]->noteOn(key);
+    else
+        layers[currentLayer]->noteOff(key);
+}
@@ -2,7 +2,6 @@
 #include <Arduino.h>
 #include <Audio.h>
 #include "inote.h"
-#include "effect_dynamics.h"
 
 #include "simplesynthnote.h"
 #include "guitarnote.h"
@@ -11,61 +10,257 @@
 
 #include "layer.h"
 #include "filters.h"
+#include "filter_chain.h"
 #include "debug.h"
 #include "meow_layer.h"
+#include "modal_note.h"
+#include "fm_note.h"
+#include "drum_layer.h"
 #include "scale_generator.h"
+#include "analyze_pitch.h"
 
 class Polysynth32
 {
 public:
-    static const int LAYER_COUNT = 4;
+    static const int LAYER_COUNT = 7;
+
+    enum InputMode
+    {
+        INPUT_OFF,     // synth only, the input still feeds the vocoder
+        INPUT_MIX,     // input summed with the synth into the effects
+        INPUT_FX_ONLY, // input only, the voice layers are parked
+        INPUT_MODE_COUNT
+    };
 
 private:
-    Layer<SimpleSynthNote> layer1;
+    // declared first so a block of input is captured before anything that
+    // reads it updates, rather than one block later
+    AudioInputAnalogStereo audioIn;
+
+    // plays the current layer from the left input, see trackPitch()
+    AudioAnalyzePitch pitchTracker;
+    AudioConnection patchPitch{audioIn, 0, pitchTracker, 0};
+    bool tracking = false;
+    // key sounding from the tracker, and the key it last heard
+    int trackedKey = -1;
+    int pendingKey = -1;
+    void playTracked(int key, bool on);
+
+    // Few keys sound at once on a grid, so these share a row of voices
+    // rather than keeping a note per key; the guitar alone is ~39KB as 32
+    // strings
+    PooledLayer<SimpleSynthNote> layer1;
     MeowLayer layer2;
-    Layer<GuitarNote> layer3;
-    Layer<CheapGuitarNote> layer4;
+    PooledLayer<GuitarNote> layer3;
+    PooledLayer<CheapGuitarNote> layer4;
+    ModalLayer layer5;
+    FmLayer layer6;
+    DrumLayer layer7;
 
-    ILayer *layers[LAYER_COUNT] = {&layer1, &layer2, &layer3, &layer4};
+    ILayer *layers[LAYER_COUNT] = {&layer1, &layer2, &layer3, &layer4, &layer5, &layer6, &layer7};
     size_t currentLayer = 0;
 
+    // Layers 0-3 are mixed on the first of each pair of mixers, 4-7 on the
+    // second, then the pair is summed
+    static const int LAYER_MIXERS = 2;
+    AudioMixer4 layerMixLeft[LAYER_MIXERS];
+    AudioMixer4 layerMixRight[LAYER_MIXERS];
+
+    AudioConnection patchL1{layer1.getOutputLeft(), 0, layerMixLeft[0], 0};
+    AudioConnection patchL2{layer2.getOutputLeft(), 0, layerMixLeft[0], 1};
+    AudioConnection patchL3{layer3.getOutputLeft(), 0, layerMixLeft[0], 2};
+    AudioConnection patchL4{layer4.getOutputLeft(), 0, layerMixLeft[0], 3};
+    AudioConnection patchL5{layer5.getOutputLeft(), 0, layerMixLeft[1], 0};
+    AudioConnection patchL6{layer6.getOutputLeft(), 0, layerMixLeft[1], 1};
+    AudioConnection patchL7{layer7.getOutputLeft(), 0, layerMixLeft[1], 2};
+
+    AudioConnection patchR1{layer1.getOutputRight(), 0, layerMixRight[0], 0};
+    AudioConnection patchR2{layer2.getOutputRight(), 0, layerMixRight[0], 1};
+    AudioConnection patchR3{layer3.getOutputRight(), 0, layerMixRight[0], 2};
+    AudioConnection patchR4{layer4.getOutputRight(), 0, layerMixRight[0], 3};
+    AudioConnection patchR5{layer5.getOutputRight(), 0, layerMixRight[1], 0};
+    AudioConnection patchR6{layer6.getOutputRight(), 0, layerMixRight[1], 1};
+    AudioConnection patchR7{layer7.getOutputRight(), 0, layerMixRight[1], 2};
+
+    // Aux send bus: each layer at its own send level
+    AudioMixer4 sendLayerMixLeft[LAYER_MIXERS];
+    AudioMixer4 sendLayerMixRight[LAYER_MIXERS];
+
+    AudioConnection patchSendL1{layer1.getOutputLeft(), 0, sendLayerMixLeft[0], 0};
+    AudioConnection patchSendL2{layer2.getOutputLeft(), 0, sendLayerMixLeft[0], 1};
+    AudioConnection patchSendL3{layer3.getOutputLeft(), 0, sendLayerMixLeft[0], 2};
+    AudioConnection patchSendL4{layer4.getOutputLeft(), 0, sendLayerMixLeft[0], 3};
+    AudioConnection patchSendL5{layer5.getOutputLeft(), 0, sendLayerMixLeft[1], 0};
+    AudioConnection patchSendL6{layer6.getOutputLeft(), 0, sendLayerMixLeft[1], 1};
+    AudioConnection patchSendL7{layer7.getOutputLeft(), 0, sendLayerMixLeft[1], 2};
+
+    AudioConnection patchSendR1{layer1.getOutputRight(), 0, sendLayerMixRight[0], 0};
+    AudioConnection patchSendR2{layer2.getOutputRight(), 0, sendLayerMixRight[0], 1};
+    AudioConnection patchSendR3{layer3.getOutputRight(), 0, sendLayerMixRight[0], 2};
+    AudioConnection patchSendR4{layer4.getOutputRight(), 0, sendLayerMixRight[0], 3};
+    AudioConnection patchSendR5{layer5.getOutputRight(), 0, sendLayerMixRight[1], 0};
+    AudioConnection patchSendR6{layer6.getOutputRight(), 0, sendLayerMixRight[1], 1};
+    AudioConnection patchSendR7{layer7.getOutputRight(), 0, sendLayerMixRight[1], 2};
+
+    float sendLevels[LAYER_COUNT] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+
     // Final mixing
     AudioMixer4 finalMixLeft;
     AudioMixer4 finalMixRight;
+    AudioMixer4 sendMixLeft;
+    AudioMixer4 sendMixRight;
+
+    AudioConnection patchFinalL1{layerMixLeft[0], 0, finalMixLeft, 0};
+    AudioConnection patchFinalL2{layerMixLeft[1], 0, finalMixLeft, 1};
+    AudioConnection patchFinalR1{layerMixRight[0], 0, finalMixRight, 0};
+    AudioConnection patchFinalR2{layerMixRight[1], 0, finalMixRight, 1};
+    AudioConnection patchSendFinalL1{sendLayerMixLeft[0], 0, sendMixLeft, 0};
+    AudioConnection patchSendFinalL2{sendLayerMixLeft[1], 0, sendMixLeft, 1};
+    AudioConnection patchSendFinalR1{sendLayerMixRight[0], 0, sendMixRight, 0};
+    AudioConnection patchSendFinalR2{sendLayerMixRight[1], 0, sendMixRight, 1};
+
+    // gain of a layer on the dry and send mixers
+    void layerGain(int layer, float dry, float send);
 
-    // Audio connections for final mix stage
-    AudioConnection patchL1{layer1.getOutputLeft(), 0, finalMixLeft, 0};
-    AudioConnection patchL2{layer2.getOutputLeft(), 0, finalMixLeft, 1};
-    AudioConnection patchL3{layer3.getOutputLeft(), 0, finalMixLeft, 2};
-    AudioConnection patchL4{layer4.getOutputLeft(), 0, finalMixLeft, 3};
+    // synth on input 0, audio input on input 1
+    AudioMixer4 dryMixLeft;
+    AudioMixer4 dryMixRight;
+    AudioMixer4 sendTotalLeft;
+    AudioMixer4 sendTotalRight;
 
-    AudioConnection patchR1{layer1.getOutputRight(), 0, finalMixRight, 0};
-    AudioConnection patchR2{layer2.getOutputRight(), 0, finalMixRight, 1};
-    AudioConnection patchR3{layer3.getOutputRight(), 0, finalMixRight, 2};
-    AudioConnection patchR4{layer4.getOutputRight(), 0, finalMixRight, 3};
+    AudioConnection patchDryL{finalMixLeft, 0, dryMixLeft, 0};
+    AudioConnection patchDryR{finalMixRight, 0, dryMixRight, 0};
+    AudioConnection patchDryInL{audioIn, 0, dryMixLeft, 1};
+    AudioConnection patchDryInR{audioIn, 1, dryMixRight, 1};
 
-    // current left and right outputs
-    AudioStream *outputLeft = &finalMixLeft;
-    AudioStream *outputRight = &finalMixRight;
+    AudioConnection patchSendTotalL{sendMixLeft, 0, sendTotalLeft, 0};
+    AudioConnection patchSendTotalR{sendMixRight, 0, sendTotalRight, 0};
+    AudioConnection patchSendInL{audioIn, 0, sendTotalLeft, 1};
+    AudioConnection patchSendInR{audioIn, 1, sendTotalRight, 1};
+
+    InputMode inputMode = INPUT_OFF;
+    float inputLevel = 1.0f;
+
+    // The chains run their filters in their own update, so each has to be
+    // declared between the mixer it hangs off and the one it feeds.
+
+    // insert effects on the dry path
+    FilterChain inserts{dryMixLeft, dryMixRight};
+    // wet only time based effects on the send bus, in parallel
+    FilterChain sends{sendTotalLeft, sendTotalRight, 0, true};
+    // one input per send effect, summing their returns
+    AudioMixer4 sendReturnLeft;
+    AudioMixer4 sendReturnRight;
+
+    // Dry (insert) path on input 0, send returns on input 1
+    AudioMixer4 returnMixLeft;
+    AudioMixer4 returnMixRight;
+    AudioConnection patchReturnL{sendReturnLeft, 0, returnMixLeft, 1};
+    AudioConnection patchReturnR{sendReturnRight, 0, returnMixRight, 1};
+
+    // after dry and returns are summed
+    FilterChain master{returnMixLeft, returnMixRight};
 
     ScaleGenerator scaleGen{C3, &SCALE_PATTERNS[4]};
+    // the current note grid, for filters pushed after it was generated
+    float scale[ILayer::NOTES_PER_ROW * ILayer::ROW_COUNT] = {};
+    // one bit per key on the grid
+    uint32_t heldKeys = 0;
 
 public:
     Polysynth32();
     void begin();
-    void noteOn(int noteIndex) { layers[currentLayer]->noteOn(noteIndex); }
-    void noteOff(int noteIndex) { layers[currentLayer]->noteOff(noteIndex); }
+    void noteOn(int noteIndex)
+    {
+        heldKeys |= 1ul << noteIndex;
+        if (inputMode != INPUT_FX_ONLY)
+            layers[currentLayer]->noteOn(noteIndex);
+    }
+    void noteOff(int noteIndex)
+    {
+        heldKeys &= ~(1ul << noteIndex);
+        if (inputMode != INPUT_FX_ONLY)
+            layers[currentLayer]->noteOff(noteIndex);
+    }
+
+    /// @brief frequency of the lowest key held down, 0 if none are
+    float lowestHeldFrequency()
+    {
+        float lowest = 0;
+        for (int i = 0; i < ILayer::NOTES_PER_ROW * (int)ILayer::ROW_COUNT; i++)
+            if ((heldKeys & (1ul << i)) && (lowest == 0 || scale[i] < lowest))
+                lowest = scale[i];
+        return lowest;
+    }
 
+    /// @brief add an insert effect on the dry path
     void pushFilter(Filter &filter)
     {
-        filter.connect(*outputLeft, *outputRight);
-        filter.begin();
-        outputLeft = &filter.outL();
-        outputRight = &filter.outR();
+        inserts.push(filter);
+        filter.setScale(scale);
     }
 
-    AudioStream &getOutputLeft() { return *outputLeft; }
-    AudioStream &getOutputRight() { return *outputRight; }
+    /// @brief add a shared effect on the send bus, it returns wet only
+    void pushSendFilter(Filter &filter)
+    {
+        sends.push(filter);
+        filter.setScale(scale);
+    }
+
+    /// @brief add an effect after the dry path and returns are summed
+    void pushMasterFilter(Filter &filter)
+    {
+        master.push(filter);
+        filter.setScale(scale);
+    }
+
+    /// @brief the ADC input, captured a block at a time by DMA
+    AudioStream &getInput() { return audioIn; }
+
+    /// @brief how the audio input joins the synth, see InputMode
+    void setInputMode(int mode);
+    InputMode getInputMode() { return inputMode; }
+
+    /// @brief level of the audio input into the effects, dry and send alike
+    void setInputLevel(float level);
+
+    /// @brief play the current layer from the pitch of the audio input
+    void setPitchTracking(bool on);
+
+    /// @brief inputs quieter than this (dBFS) release the tracked note
+    void setTrackingGate(float db) { pitchTracker.gate(db); }
+
+    /// @brief call from the main loop while tracking, to follow the input
+    void trackPitch();
+
+    /// @brief the grid key nearest a frequency
+    int nearestKey(float hz);
+
+    /// @brief connect the end of the master chain to a stereo output
+    void connectOutput(AudioStream &out) { master.connectTo(out, 0, out, 1); }
+
+    /// @brief call from the main loop so the chains follow filter bypasses
+    void updateFilters()
+    {
+        inserts.loop();
+        sends.loop();
+        master.loop();
+    }
+
+    FilterChain &getInserts() { return inserts; }
+    FilterChain &getSends() { return sends; }
+    FilterChain &getMaster() { return master; }
+
+    /// @brief send level of the current layer
+    void setSendLevel(float level);
+    float getSendLevel() { return sendLevels[currentLayer]; }
+
+    /// @brief level of the send bus returns in the master mix
+    void setReturnLevel(float level)
+    {
+        returnMixLeft.gain(1, level);
+        returnMixRight.gain(1, level);
+    }
     void setupScales();
     void selectVoice(uint8_t idx);
 
@@ -74,6 +269,21 @@ public:
         scaleGen.setPattern(&SCALE_PATTERNS[idx]);
         setupScales();
     }
+    /// @brief sound of the modal voice, one of MODAL_PRESETS
+    void setModalPreset(int idx) { layer5.preset(idx); }
+    /// @brief scale the modal voice's ring time
+    void setModalDecay(float scale) { layer5.decayScale(scale); }
+
+    /// @brief sound of the FM voice, one of FM_PRESETS
+    void setFmPreset(int idx) { layer6.preset(idx); }
+    /// @brief scale the FM voice's modulation index
+    void setFmBrightness(float scale) { layer6.indexScale(scale); }
+
+    /// @brief retune the drum kit by semitones
+    void setDrumTuning(int semitones) { layer7.tune(semitones); }
+    /// @brief level of every drum hit
+    void setDrumLevel(float gain) { layer7.setLevel(gain); }
+
     void selectScaleRoot(size_t idx)
     {
         scaleGen.setRoot(ROOT_NOTES[idx]);
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Arduino.h>
+
+/*
+ * Plain DSP kernels, free of the audio library.
+ *
+ * A kernel works on float samples at int16 scale (full scale is +-32768),
+ * so code ported from int16 nodes keeps its constants, and on any number of
+ * frames per call. That lets kernels be fused into one loop (see
+ * AudioEffectFxRack), run at any block size and be driven from a host
+ * program. Kernels only take the sample rate constants from AudioStream.h;
+ * effect_kernel.h has the thin AudioStream adapters.
+ */
+
+/// @brief saturate an int16 scale float back to int16
+inline int16_t saturate16(float x)
+{
+    if (x > 32767.0f)
+        return 32767;
+    if (x < -32768.0f)
+        return -32768;
+    return (int16_t)x;
+}
+
+/// @brief One channel in, one channel out. `in` and `out` may be the same
+/// buffer.
+class MonoProcessor
+{
+public:
+    virtual ~MonoProcessor() = default;
+    virtual void process(const float *in, float *out, size_t frames) = 0;
+};
+
+/// @brief One channel out, nothing in; players and oscillators.
+class MonoGenerator
+{
+public:
+    virtual ~MonoGenerator() = default;
+    virtual void process(float *out, size_t frames) = 0;
+};
+
+/// @brief A stereo effect that works in place, for running back to back
+/// inside an AudioEffectFxRack.
+///
+/// Nothing is clipped between processors; the rack saturates once on the
+/// way out.
+class StereoProcessor
+{
+public:
+    virtual ~StereoProcessor() = default;
+
+    virtual void process(float *left, float *right, size_t frames) = 0;
+
+    /// @brief true when process() would leave the samples as they are, so
+    /// the rack can skip it. Called from the audio interrupt.
+    virtual bool isNeutral() { return false; }
+
+    /// @brief drop any state left over from before the processor was last
+    /// skipped. Called from the audio interrupt before it runs again.
+    virtual void reset() {}
+
+    /// @brief short name for the menu
+    virtual const char *name() = 0;
+};
+
+/// @brief A MonoProcessor run independently on each channel. Settings are
+/// made on `left` and `right` directly.
+template <typename K>
+class DualMonoProcessor : public StereoProcessor
+{
+    const char *label;
+
+public:
+    K left;
+    K right;
+
+    DualMonoProcessor(const char *label_) : label(label_) {}
+
+    void process(float *l, float *r, size_t frames)
+    {
+        left.process(l, l, frames);
+        right.process(r, r, frames);
+    }
+
+    const char *name() { return label; }
+};
@@ -37,6 +37,11 @@ public:
     {
         player.stop();
     }
+    void park(bool parked) override
+    {
+        NodeActivity::set(player, !parked);
+        NodeActivity::set(finalMix, !parked);
+    }
 
     void setFrequency(float freq) override { baseFreq = freq; }
     void setSample(const int16_t *new_buffer, size_t new_buffer_len, float new_referenceFreq)
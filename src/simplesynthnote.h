@@ -18,6 +18,11 @@ public:
     void noteOff() override;
     void enable() override;
     void disable() override;
+    void park(bool parked) override
+    {
+        NodeActivity::set(wav, !parked);
+        NodeActivity::set(env, !parked);
+    }
     void setFrequency(float freq) override;
     AudioStream &getOutputLeft() override { return env; }
     AudioStream &getOutputRight() override { return env; }
@@ -0,0 +1,165 @@
+#include "synth_fm.h"
+
+const FmPreset FM_PRESETS[FM_PRESET_COUNT] = {
+    // the classic tine piano: bright strike fading to a near sine
+    {"e-piano", 1.0f, 3.0f, {0.002f, 2.5f, 0.0f, 0.4f}, {0.001f, 0.6f, 0.1f, 0.3f}},
+    // inharmonic ratio for a metallic strike
+    {"fm bell", 3.5f, 2.5f, {0.001f, 4.0f, 0.0f, 1.5f}, {0.001f, 2.0f, 0.0f, 1.0f}},
+    {"fm bass", 1.0f, 4.5f, {0.002f, 0.8f, 0.6f, 0.08f}, {0.001f, 0.15f, 0.15f, 0.08f}},
+    // the modulator swells in behind the carrier
+    {"brass", 1.0f, 2.5f, {0.04f, 0.3f, 0.8f, 0.15f}, {0.08f, 0.4f, 0.6f, 0.15f}},
+};
+
+// blocks per second
+#define FM_BLOCK_RATE (AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES)
+
+// level at which decays are treated as finished
+#define FM_SILENCE 0.0001f
+
+void FmEnvelope::shape(const FmEnvelopeShape &s)
+{
+    float attackBlocks = s.attack * FM_BLOCK_RATE;
+    attackStep = attackBlocks > 1.0f ? 1.0f / attackBlocks : 1.0f;
+    // decay and release take their time to fall by 60dB, log2(1000) octaves
+    decayCoeff = fast_exp2f(-9.9658f / (fmaxf(s.decay, 0.001f) * FM_BLOCK_RATE));
+    releaseCoeff = fast_exp2f(-9.9658f / (fmaxf(s.release, 0.001f) * FM_BLOCK_RATE));
+    sustain = s.sustain;
+}
+
+float FmEnvelope::next()
+{
+    switch (stage)
+    {
+    case ATTACK:
+        level += attackStep;
+        if (level >= 1.0f)
+        {
+            level = 1.0f;
+            stage = DECAY;
+        }
+        break;
+    case DECAY:
+        level = sustain + (level - sustain) * decayCoeff;
+        // a percussive shape is done once it has died away
+        if (sustain == 0 && level < FM_SILENCE)
+            stop();
+        break;
+    case RELEASE:
+        level *= releaseCoeff;
+        if (level < FM_SILENCE)
+            stop();
+        break;
+    case IDLE:
+        break;
+    }
+    return level;
+}
+
+void AudioSynthFm::preset(const FmPreset &p)
+{
+    patch = &p;
+    AudioNoInterrupts();
+    carrierEnv.shape(p.carrier);
+    modulatorEnv.shape(p.modulator);
+    AudioInterrupts();
+    recalculate();
+}
+
+void AudioSynthFm::frequency(float hz)
+{
+    baseFreq = hz;
+    recalculate();
+}
+
+void AudioSynthFm::indexScale(float scale)
+{
+    indexMult = scale;
+    recalculate();
+}
+
+void AudioSynthFm::recalculate()
+{
+    uint32_t carrier = frequencyToPhaseIncrement(baseFreq);
+    uint32_t modulator = frequencyToPhaseIncrement(baseFreq * patch->ratio);
+    // index radians is index / 2pi of a turn, a turn is 2^32
+    float d = patch->index * indexMult * (4294967296.0f / (2.0f * 3.14159265f)) / 32768.0f;
+
+    AudioNoInterrupts();
+    carrierStep = carrier;
+    modulatorStep = modulator;
+    depth = d;
+    AudioInterrupts();
+}
+
+void AudioSynthFm::noteOn()
+{
+    AudioNoInterrupts();
+    // restart the phases so every strike has the same attack
+    carrierPhase = 0;
+    modulatorPhase = 0;
+    carrierEnv.noteOn();
+    modulatorEnv.noteOn();
+    AudioInterrupts();
+}
+
+void AudioSynthFm::noteOff()
+{
+    AudioNoInterrupts();
+    carrierEnv.noteOff();
+    modulatorEnv.noteOff();
+    AudioInterrupts();
+}
+
+void AudioSynthFm::stop()
+{
+    AudioNoInterrupts();
+    carrierEnv.stop();
+    modulatorEnv.stop();
+    AudioInterrupts();
+}
+
+void AudioSynthFm::update(void)
+{
+    if (carrierEnv.isIdle())
+        return;
+
+    audio_block_t *block = allocate();
+    if (!block)
+        return;
+
+    // envelope ramps across the block, in Q15 and in phase units per Q15
+    const float g = gain;
+    float carrierFrom = carrierEnv.current() * g;
+    float carrierTo = carrierEnv.next() * g;
+    float modulatorFrom = modulatorEnv.current() * depth;
+    float modulatorTo = modulatorEnv.next() * depth;
+
+    int32_t level = (int32_t)(carrierFrom * 32767.0f);
+    int32_t levelStep = (int32_t)((carrierTo - carrierFrom) * 32767.0f) / AUDIO_BLOCK_SAMPLES;
+    // depth is up to ~2^18, so there's room for 8 bits of fraction
+    int32_t mod = (int32_t)(modulatorFrom * 256.0f);
+    int32_t modStep = (int32_t)((modulatorTo - modulatorFrom) * 256.0f) / AUDIO_BLOCK_SAMPLES;
+
+    const uint32_t cStep = carrierStep;
+    const uint32_t mStep = modulatorStep;
+    uint32_t cPhase = carrierPhase;
+    uint32_t mPhase = modulatorPhase;
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        int32_t m = sine_q15(mPhase);
+        // unsigned, so the offset wraps around the turn like the phase
+        uint32_t offset = (uint32_t)m * (uint32_t)(mod >> 8);
+        block->data[i] = (sine_q15(cPhase + offset) * level) >> 15;
+        cPhase += cStep;
+        mPhase += mStep;
+        level += levelStep;
+        mod += modStep;
+    }
+
+    carrierPhase = cPhase;
+    modulatorPhase = mPhase;
+
+    transmit(block);
+    release(block);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fast_math.h"
+
+/// @brief attack, decay and release in seconds, sustain 0 to 1
+struct FmEnvelopeShape
+{
+    float attack;
+    float decay;
+    float sustain;
+    float release;
+};
+
+/// @brief A two operator patch. The modulator runs at `ratio` times the
+/// note and swings the carrier's phase by up to `index` radians.
+struct FmPreset
+{
+    const char *name;
+    float ratio;
+    float index;
+    FmEnvelopeShape carrier;
+    FmEnvelopeShape modulator;
+};
+
+#define FM_PRESET_COUNT 4
+extern const FmPreset FM_PRESETS[FM_PRESET_COUNT];
+
+/// @brief An ADSR worked out once per block; the oscillators ramp linearly
+/// from one block's level to the next. Attack is linear, decay and release
+/// are exponential.
+class FmEnvelope
+{
+public:
+    enum Stage
+    {
+        IDLE,
+        ATTACK,
+        DECAY,
+        RELEASE
+    };
+
+    void shape(const FmEnvelopeShape &s);
+    void noteOn() { stage = ATTACK; }
+    void noteOff()
+    {
+        if (stage != IDLE)
+            stage = RELEASE;
+    }
+    void stop()
+    {
+        stage = IDLE;
+        level = 0;
+    }
+    bool isIdle() const { return stage == IDLE; }
+
+    /// @brief level at the end of the coming block
+    float next();
+    float current() const { return level; }
+
+private:
+    Stage stage = IDLE;
+    float level = 0;
+    float attackStep = 1.0f;
+    float decayCoeff = 0;
+    float sustain = 1.0f;
+    float releaseCoeff = 0;
+};
+
+/// @brief Two operator FM voice: a sine modulator, with its own envelope,
+/// on the phase of a sine carrier.
+///
+/// Both operators are 32 bit phase accumulators into the shared Q15
+/// SINE_TABLE_Q15 (sine_q15), and the modulation depth is a single
+/// multiply into phase units, wrapping like the phase does. Envelopes are
+/// evaluated per block and ramped per sample. Per sample that is two table
+/// lookups and five multiplies, and nothing at all once the carrier has
+/// released. No cycle count has been measured on the board; the host cost
+/// is printed by test/test_fm.cpp.
+///
+/// No inputs. Output: 0 = mono.
+class AudioSynthFm : public AudioStream
+{
+public:
+    AudioSynthFm(void) : AudioStream(0, NULL) { preset(FM_PRESETS[0]); }
+
+    void preset(const FmPreset &p);
+    void frequency(float hz);
+
+    /// @brief scale the modulation index, i.e. brightness
+    void indexScale(float scale);
+
+    /// @brief output level, 0 to 1
+    void amplitude(float a) { gain = a; }
+
+    void noteOn();
+    void noteOff();
+    void stop();
+
+    virtual void update(void);
+
+private:
+    const FmPreset *patch = &FM_PRESETS[0];
+    float baseFreq = 440.0f;
+    float indexMult = 1.0f;
+    volatile float gain = 0.5f;
+
+    volatile uint32_t carrierStep = 0;
+    volatile uint32_t modulatorStep = 0;
+    // phase units per unit of Q15 modulator output at full index
+    volatile float depth = 0;
+
+    uint32_t carrierPhase = 0;
+    uint32_t modulatorPhase = 0;
+    FmEnvelope carrierEnv;
+    FmEnvelope modulatorEnv;
+
+    void recalculate();
+};
@@ -0,0 +1,168 @@
+#include "synth_modal.h"
+
+// below this the note has rung out (about -66dBFS)
+#define MODAL_IDLE_LEVEL 16
+
+const ModalPreset MODAL_PRESETS[MODAL_PRESET_COUNT] = {
+    // a tuned bar, 1:4:10, the overtones dying away fast
+    {"marimba", 3, {1.0f, 3.99f, 10.65f}, {0.6f, 0.25f, 0.1f}, {1.2f, 0.4f, 0.12f}, 1.0f},
+    // a free bar, harder mallet, longer ring
+    {"glock", 4, {1.0f, 2.76f, 5.40f, 8.93f}, {0.45f, 0.25f, 0.15f, 0.1f}, {3.0f, 1.2f, 0.6f, 0.3f}, 0.25f},
+    // church bell partials: hum, prime, tierce, quint, nominal, superquint
+    {"bell", 6, {0.5f, 1.0f, 1.2f, 1.5f, 2.0f, 3.0f}, {0.2f, 0.25f, 0.2f, 0.1f, 0.15f, 0.08f}, {4.5f, 3.0f, 2.5f, 1.8f, 1.5f, 0.8f}, 0.15f},
+};
+
+void AudioSynthModal::preset(const ModalPreset &p)
+{
+    shape = &p;
+    recalculate();
+}
+
+void AudioSynthModal::frequency(float hz)
+{
+    baseFreq = hz;
+    recalculate();
+}
+
+void AudioSynthModal::decayScale(float scale)
+{
+    decayMult = scale;
+    recalculate();
+}
+
+void AudioSynthModal::recalculate()
+{
+    Bank next;
+    const float nyquist = AUDIO_SAMPLE_RATE_EXACT * 0.45f;
+    for (uint8_t m = 0; m < shape->modes && m < MODAL_MAX_MODES; m++)
+    {
+        float hz = baseFreq * shape->ratio[m];
+        // modes past the top of the band are left out
+        if (hz >= nyquist)
+            continue;
+        float w = 2.0f * 3.14159265f * hz / AUDIO_SAMPLE_RATE_EXACT;
+        float t60 = shape->decay[m] * decayMult;
+        float r = expf(-6.9078f / (t60 * AUDIO_SAMPLE_RATE_EXACT));
+        next.cosine[next.modes] = r * cosf(w);
+        next.sine[next.modes] = r * sinf(w);
+        next.gain[next.modes] = shape->gain[m];
+        next.modes++;
+    }
+
+    // a half sine of the hardness' length, but no longer than half a cycle
+    // of the note so high notes still speak, scaled so the fundamental
+    // rings at about the velocity whatever the length
+    float samples = shape->hardness * 0.001f * AUDIO_SAMPLE_RATE_EXACT;
+    float halfCycle = AUDIO_SAMPLE_RATE_EXACT / (2.0f * baseFreq);
+    if (samples > halfCycle)
+        samples = halfCycle;
+    if (samples < 1.0f)
+        samples = 1.0f;
+    next.pulseStep = (uint32_t)(2147483648.0f / samples);
+    next.pulseLevel = 1.5708f / samples;
+
+    AudioNoInterrupts();
+    bank = next;
+    AudioInterrupts();
+}
+
+void AudioSynthModal::strike(float velocity)
+{
+    AudioNoInterrupts();
+    pulsePhase = 0;
+    pulseAmplitude = constrain(velocity, 0.0f, 1.0f) * bank.pulseLevel;
+    pulsing = true;
+    active = true;
+    AudioInterrupts();
+}
+
+void AudioSynthModal::stop()
+{
+    AudioNoInterrupts();
+    pulsing = false;
+    memset(stateSine, 0, sizeof(stateSine));
+    memset(stateCosine, 0, sizeof(stateCosine));
+    active = false;
+    AudioInterrupts();
+}
+
+void AudioSynthModal::update(void)
+{
+    const uint8_t modes = bank.modes;
+    if (!pulsing && !modes)
+    {
+        active = false;
+        return;
+    }
+
+    audio_block_t *block = allocate();
+    if (!block)
+        return;
+
+    // the strike, if it's still going
+    float excite[AUDIO_BLOCK_SAMPLES];
+    bool excited = pulsing;
+    if (pulsing)
+    {
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            excite[i] = pulsing ? sine_q15(pulsePhase) * pulseAmplitude : 0.0f;
+            pulsePhase += bank.pulseStep;
+            // done after half a cycle
+            if (pulsePhase >= 0x80000000u)
+                pulsing = false;
+        }
+    }
+
+    float out[AUDIO_BLOCK_SAMPLES] = {};
+    for (uint8_t m = 0; m < modes; m++)
+    {
+        const float rc = bank.cosine[m];
+        const float rs = bank.sine[m];
+        const float g = bank.gain[m];
+        float s = stateSine[m];
+        float c = stateCosine[m];
+        if (excited)
+        {
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                float next = rc * s - rs * c + g * excite[i];
+                c = rs * s + rc * c;
+                s = next;
+                out[i] += s;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                float next = rc * s - rs * c;
+                c = rs * s + rc * c;
+                s = next;
+                out[i] += s;
+            }
+        }
+        stateSine[m] = s;
+        stateCosine[m] = c;
+    }
+
+    float peak = 0;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+    {
+        block->data[i] = saturate16(out[i]);
+        float magnitude = fabsf(out[i]);
+        if (magnitude > peak)
+            peak = magnitude;
+    }
+
+    transmit(block);
+    release(block);
+
+    if (!pulsing && peak < MODAL_IDLE_LEVEL)
+    {
+        // rung out
+        memset(stateSine, 0, sizeof(stateSine));
+        memset(stateCosine, 0, sizeof(stateCosine));
+        active = false;
+    }
+}
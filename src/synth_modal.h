@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include "fast_math.h"
+#include "processor.h"
+
+#define MODAL_MAX_MODES 6
+
+/// @brief The modes of a struck object, relative to the note played.
+struct ModalPreset
+{
+    const char *name;
+    uint8_t modes;
+    float ratio[MODAL_MAX_MODES];
+    // level of each mode; they should add up to no more than 1
+    float gain[MODAL_MAX_MODES];
+    // seconds to fall by 60dB
+    float decay[MODAL_MAX_MODES];
+    // length of the strike in ms; longer is a softer mallet
+    float hardness;
+};
+
+#define MODAL_PRESET_COUNT 3
+extern const ModalPreset MODAL_PRESETS[MODAL_PRESET_COUNT];
+
+/// @brief A struck bar or bell: a short half sine pulse into a bank of
+/// tuned, decaying resonators.
+///
+/// Each mode is a coupled form (rotating phasor) resonator: two multiplies
+/// and two multiply-adds a sample, run a mode at a time over the block so
+/// its state stays in registers, about 6 cycles a sample. That is ~20
+/// cycles for the marimba, ~40 for the bell, and only while the note
+/// rings. They run in float: in Q15 the pole radius can't be set finer than
+/// 1 - r is for a few seconds of decay, and rounding leaves limit cycles
+/// ringing at -40dB.
+///
+/// The node takes itself off the update pass once it has rung out, so a
+/// silent note costs nothing; strike() puts it back.
+///
+/// No inputs. Output: 0 = mono.
+class AudioSynthModal : public AudioStream
+{
+public:
+    AudioSynthModal(void) : AudioStream(0, NULL) {}
+
+    void preset(const ModalPreset &p);
+    void frequency(float hz);
+
+    /// @brief scale every mode's decay time
+    void decayScale(float scale);
+
+    /// @brief hit it, velocity 0 to 1; a ringing note is hit again as is
+    void strike(float velocity);
+
+    /// @brief silence it at once
+    void stop();
+
+    virtual void update(void);
+
+private:
+    const ModalPreset *shape = &MODAL_PRESETS[0];
+    float baseFreq = 440.0f;
+    float decayMult = 1.0f;
+
+    struct Bank
+    {
+        // r cos w and r sin w of each mode
+        float cosine[MODAL_MAX_MODES] = {};
+        float sine[MODAL_MAX_MODES] = {};
+        float gain[MODAL_MAX_MODES] = {};
+        uint8_t modes = 0;
+        uint32_t pulseStep = 0;
+        float pulseLevel = 0;
+    };
+    Bank bank;
+
+    // each mode's phasor
+    float stateSine[MODAL_MAX_MODES] = {};
+    float stateCosine[MODAL_MAX_MODES] = {};
+
+    // the strike, half a cycle of a sine
+    uint32_t pulsePhase = 0;
+    float pulseAmplitude = 0;
+    bool pulsing = false;
+
+    void recalculate();
+};
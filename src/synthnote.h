@@ -27,6 +27,14 @@ public:
     void setFrequency(float freq) override;
     void enable() override;
     void disable() override;
+    void park(bool parked) override
+    {
+        NodeActivity::set(waveform1, !parked);
+        NodeActivity::set(waveform2, !parked);
+        NodeActivity::set(waveMixer, !parked);
+        NodeActivity::set(filter, !parked);
+        NodeActivity::set(env, !parked);
+    }
     AudioStream &getOutputLeft() override { return env; }
     AudioStream &getOutputRight() override { return env; }
 };
\ No newline at end of file
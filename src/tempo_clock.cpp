@@ -0,0 +1,36 @@
+#include "tempo_clock.h"
+#include <stdio.h>
+
+const NoteDivision NOTE_DIVISIONS[] = {
+    {"free", 0},
+    {"1/4", 1.0f},
+    {"1/8.", 0.75f},
+    {"1/4T", 2.0f / 3.0f},
+    {"1/8", 0.5f},
+    {"1/16.", 0.375f},
+    {"1/8T", 1.0f / 3.0f},
+    {"1/16", 0.25f},
+    {"1/16T", 1.0f / 6.0f},
+};
+
+const size_t NUM_NOTE_DIVISIONS = sizeof(NOTE_DIVISIONS) / sizeof(NOTE_DIVISIONS[0]);
+
+void TempoClock::playedName(size_t division, float maxMs, char *name, size_t size) const
+{
+    if (division >= NUM_NOTE_DIVISIONS)
+    {
+        snprintf(name, size, "?");
+        return;
+    }
+    const char *own = NOTE_DIVISIONS[division].name;
+    int halvings = divisionHalvings(division, maxMs);
+    char *rest;
+    long denominator = strncmp(own, "1/", 2) == 0 ? strtol(own + 2, &rest, 10) : 0;
+    if (halvings == 0 || denominator <= 0)
+    {
+        snprintf(name, size, "%s", own);
+        return;
+    }
+    // the dotted or triplet suffix carries over
+    snprintf(name, size, "1/%ld%s", denominator << halvings, rest);
+}
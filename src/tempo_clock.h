@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Arduino.h>
+
+// A note length expressed in beats (quarter notes)
+struct NoteDivision
+{
+    const char *name;
+    float beats; // 0 means not synced to the clock
+};
+
+// Divisions offered for tempo synced effects; entry 0 is "free"
+extern const NoteDivision NOTE_DIVISIONS[];
+extern const size_t NUM_NOTE_DIVISIONS;
+
+class TempoClock
+{
+private:
+    static const int MAX_TAPS = 4;
+    static const unsigned long TAP_TIMEOUT_MS = 2000;
+
+    float bpm;
+    unsigned long taps[MAX_TAPS];
+    int tapCount = 0;
+
+public:
+    static constexpr float MIN_BPM = 40.0f;
+    static constexpr float MAX_BPM = 240.0f;
+
+    TempoClock(float bpm_ = 120.0f) : bpm(bpm_) {}
+
+    float getBpm() const { return bpm; }
+
+    void setBpm(float bpm_)
+    {
+        bpm = constrain(bpm_, MIN_BPM, MAX_BPM);
+    }
+
+    /// @brief register a tap at `now` (millis). Averages the intervals of
+    /// the last few taps; a pause longer than TAP_TIMEOUT_MS starts over.
+    /// @return true if the tempo changed
+    bool tap(unsigned long now)
+    {
+        if (tapCount > 0 && now - taps[tapCount - 1] > TAP_TIMEOUT_MS)
+            tapCount = 0;
+
+        if (tapCount == MAX_TAPS)
+        {
+            for (int i = 1; i < MAX_TAPS; i++)
+                taps[i - 1] = taps[i];
+            tapCount--;
+        }
+        taps[tapCount++] = now;
+
+        if (tapCount < 2)
+            return false;
+
+        float interval = (float)(taps[tapCount - 1] - taps[0]) / (tapCount - 1);
+        setBpm(60000.0f / interval);
+        return true;
+    }
+
+    float beatMs() const { return 60000.0f / bpm; }
+
+    /// @brief how many times divisionMs() halves a division to fit in maxMs
+    int divisionHalvings(size_t division, float maxMs) const
+    {
+        if (division >= NUM_NOTE_DIVISIONS || NOTE_DIVISIONS[division].beats <= 0)
+            return 0;
+        float ms = beatMs() * NOTE_DIVISIONS[division].beats;
+        int halvings = 0;
+        while (ms > maxMs)
+        {
+            ms *= 0.5f;
+            halvings++;
+        }
+        return halvings;
+    }
+
+    /// @brief length of a division in ms, halved until it is no longer than
+    /// maxMs so it stays on the beat grid. Returns 0 for unsynced divisions.
+    float divisionMs(size_t division, float maxMs) const
+    {
+        if (division >= NUM_NOTE_DIVISIONS || NOTE_DIVISIONS[division].beats <= 0)
+            return 0;
+        return beatMs() * NOTE_DIVISIONS[division].beats / (1 << divisionHalvings(division, maxMs));
+    }
+
+    /// @brief the name of what divisionMs() plays, e.g. "1/16" for a 1/4
+    /// halved twice; the division's own name when it fits
+    void playedName(size_t division, float maxMs, char *name, size_t size) const;
+};
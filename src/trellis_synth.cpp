@@ -17,6 +17,7 @@
 
 #include "menu.h"
 #include "scale_generator.h"
+#include "tempo_clock.h"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -46,12 +47,6 @@ Polysynth32 synthinstance;
 
 AudioOutputAnalogStereo audioOut;
 
-// delayed init of these connections
-alignas(AudioConnection) byte bpol[sizeof(AudioConnection)];
-alignas(AudioConnection) byte bpor[sizeof(AudioConnection)];
-AudioConnection *patchOutLeft;
-AudioConnection *patchOutRight;
-
 void monitorUsage();
 
 Adafruit_NeoTrellisM4 trellis = Adafruit_NeoTrellisM4();
@@ -60,12 +55,42 @@ Adafruit_NeoTrellisM4 trellis = Adafruit_NeoTrellisM4();
 #define ENCODER2_ADDR 0x37
 
 // effects and postprocessing
-GainFilter gainFilter;
-BitCrusherFilter bitCrusherFilter;
-LimiterFilter limiterFilter;
+OutputFilter outputFilter;
 FeeedbackFilter feedbackFilter;
-FlangeFilter flangeFilter;
-ChorusFilter chorusFilter;
+InsertRackFilter insertRack;
+ReverbFilter reverbFilter;
+FreezeFilter freezeFilter;
+EqFilter eqFilter;
+ResonatorFilter resonatorFilter;
+ConvolutionFilter bodyFilter;
+VocoderFilter vocoderFilter;
+AutoWahFilter autoWahFilter;
+WavefolderFilter wavefolderFilter;
+RingModFilter ringModFilter;
+PhaserFilter phaserFilter;
+TremoloFilter tremoloFilter;
+
+// Everything big in RAM is static: the voices, the effects' buffers and
+// the audio block pool. Check at compile time that they leave
+// RAM_RESERVE of the SAMD51's 192KB for the libraries, heap and stack;
+// `pio run -t size` shows the whole picture after linking.
+#define AUDIO_MEMORY_BLOCKS 80
+#define RAM_SIZE (192 * 1024)
+#define RAM_RESERVE (16 * 1024)
+static_assert(sizeof(synthinstance) + sizeof(outputFilter) + sizeof(feedbackFilter) +
+                      sizeof(insertRack) + sizeof(reverbFilter) + sizeof(freezeFilter) +
+                      sizeof(eqFilter) + sizeof(resonatorFilter) + sizeof(bodyFilter) +
+                      sizeof(vocoderFilter) + sizeof(autoWahFilter) + sizeof(wavefolderFilter) +
+                      sizeof(ringModFilter) + sizeof(phaserFilter) + sizeof(tremoloFilter) +
+                      AUDIO_MEMORY_BLOCKS * sizeof(audio_block_t) <=
+                  RAM_SIZE - RAM_RESERVE,
+              "the audio graph has outgrown the RAM budget");
+
+TempoClock tempoClock;
+void updateDelayTimes();
+void updateFreezeSlice();
+void printDivision(Adafruit_GFX &gfx, const char *label, int division, float maxMs);
+bool freezeLatched = false;
 
 #define PERCENT_CONVERSION SIMPLE_LAMBDA(float f, (int)(f * 100))
 
@@ -73,14 +98,102 @@ auto volumeSetting =
     Setting("Vol: %d%%", 0.2f, 0.0f, 1.0f,
             SIMPLE_LAMBDA(float f, f + 0.05f),
             SIMPLE_LAMBDA(float f, f - 0.05f),
-            PUBLISH_METHOD(gainFilter.gain, float),
+            PUBLISH_METHOD(outputFilter.gain, float),
+            PERCENT_CONVERSION);
+
+// send level of the current voice into the send bus effects
+auto sendSetting =
+    Setting("Send: %d%%", 1.0f, 0.0f, 1.0f,
+            SIMPLE_LAMBDA(float f, f + 0.05f),
+            SIMPLE_LAMBDA(float f, f - 0.05f),
+            PUBLISH_METHOD(synthinstance.setSendLevel, float),
             PERCENT_CONVERSION);
 
+auto returnSetting =
+    Setting("Return: %d%%", 1.0f, 0.0f, 1.0f,
+            SIMPLE_LAMBDA(float f, f + 0.05f),
+            SIMPLE_LAMBDA(float f, f - 0.05f),
+            PUBLISH_METHOD(synthinstance.setReturnLevel, float),
+            PERCENT_CONVERSION);
+
+// audio input: off, mixed with the synth, or effects only
+const char *INPUT_MODE_NAMES[] = {"off", "mix", "fx only"};
+auto inputModeSetting =
+    Setting<int>("Input: %d", Polysynth32::INPUT_OFF, Polysynth32::INPUT_OFF, Polysynth32::INPUT_MODE_COUNT - 1,
+                 SIMPLE_LAMBDA(int i, i + 1),
+                 SIMPLE_LAMBDA(int i, i - 1),
+                 PUBLISH_METHOD(synthinstance.setInputMode, int), NULL,
+                 DISPLAY_LAMBDA(int i, { gfx.printf("In: %s", INPUT_MODE_NAMES[i]); }));
+
+auto inputLevelSetting =
+    Setting("In lvl: %d%%", 1.0f, 0.0f, 2.0f,
+            SIMPLE_LAMBDA(float f, f + 0.05f),
+            SIMPLE_LAMBDA(float f, f - 0.05f),
+            PUBLISH_METHOD(synthinstance.setInputLevel, float),
+            PERCENT_CONVERSION);
+
+// play the current voice by singing into the input
+auto trackSetting =
+    Setting<int>("Track: %d", 0, 0, 1,
+                 SIMPLE_LAMBDA(int i, i + 1),
+                 SIMPLE_LAMBDA(int i, i - 1),
+                 PUBLISH_METHOD(synthinstance.setPitchTracking, int), NULL,
+                 DISPLAY_LAMBDA(int i, { gfx.printf("Track: %s", i ? "on" : "off"); }));
+
+auto trackGateSetting =
+    Setting<int>("Gate: %ddB", -45, -70, -20,
+                 SIMPLE_LAMBDA(int i, i + 5),
+                 SIMPLE_LAMBDA(int i, i - 5),
+                 PUBLISH_METHOD(synthinstance.setTrackingGate, int));
+
 auto voiceSetting =
-    Setting("Voice: %d", 0, 0, Polysynth32::LAYER_COUNT - 1,
-            SIMPLE_LAMBDA(int i, i + 1),
-            SIMPLE_LAMBDA(int i, i - 1),
-            PUBLISH_METHOD(synthinstance.selectVoice, int));
+    Setting<int>("Voice: %d", 0, 0, Polysynth32::LAYER_COUNT - 1,
+                 SIMPLE_LAMBDA(int i, i + 1),
+                 SIMPLE_LAMBDA(int i, i - 1),
+                 +[](int i)
+                 {
+                   synthinstance.selectVoice(i);
+                   // each voice has its own send level
+                   sendSetting.set(synthinstance.getSendLevel());
+                 });
+
+// the struck voice's instrument and how long it rings
+auto modalPresetSetting = Setting<int>("Mallet: %d", 0, 0, MODAL_PRESET_COUNT - 1,
+                                       SIMPLE_LAMBDA(int i, i + 1),
+                                       SIMPLE_LAMBDA(int i, i - 1),
+                                       PUBLISH_METHOD(synthinstance.setModalPreset, int), NULL,
+                                       DISPLAY_LAMBDA(int i, { gfx.printf("%s", MODAL_PRESETS[i].name); }));
+
+auto modalDecaySetting = Setting("Ring: %d%%", 1.0f, 0.25f, 2.0f,
+                                 SIMPLE_LAMBDA(float f, f + 0.05f),
+                                 SIMPLE_LAMBDA(float f, f - 0.05f),
+                                 PUBLISH_METHOD(synthinstance.setModalDecay, float),
+                                 PERCENT_CONVERSION);
+
+// the FM voice's patch and its modulation index
+auto fmPresetSetting = Setting<int>("FM: %d", 0, 0, FM_PRESET_COUNT - 1,
+                                    SIMPLE_LAMBDA(int i, i + 1),
+                                    SIMPLE_LAMBDA(int i, i - 1),
+                                    PUBLISH_METHOD(synthinstance.setFmPreset, int), NULL,
+                                    DISPLAY_LAMBDA(int i, { gfx.printf("%s", FM_PRESETS[i].name); }));
+
+auto fmBrightnessSetting = Setting("Bright: %d%%", 1.0f, 0.0f, 2.0f,
+                                   SIMPLE_LAMBDA(float f, f + 0.05f),
+                                   SIMPLE_LAMBDA(float f, f - 0.05f),
+                                   PUBLISH_METHOD(synthinstance.setFmBrightness, float),
+                                   PERCENT_CONVERSION);
+
+// the drum kit's pitch and how loud it hits
+auto drumTuningSetting = Setting<int>("Tune: %d", 0, -12, 12,
+                                      SIMPLE_LAMBDA(int i, i + 1),
+                                      SIMPLE_LAMBDA(int i, i - 1),
+                                      PUBLISH_METHOD(synthinstance.setDrumTuning, int));
+
+auto drumLevelSetting = Setting("Level: %d%%", 1.0f, 0.0f, 2.0f,
+                                SIMPLE_LAMBDA(float f, f + 0.05f),
+                                SIMPLE_LAMBDA(float f, f - 0.05f),
+                                PUBLISH_METHOD(synthinstance.setDrumLevel, float),
+                                PERCENT_CONVERSION);
 
 auto scalePatternSetting = Setting<int>("Pat: %d", 0, 0, NUM_SCALES - 1,
                                         SIMPLE_LAMBDA(int i, i + 1),
@@ -105,13 +218,13 @@ auto crusherBitsSetting =
     Setting("Bits: %d", 16, 2, 16,
             SIMPLE_LAMBDA(int i, i + 1),
             SIMPLE_LAMBDA(int i, i - 1),
-            PUBLISH_METHOD(bitCrusherFilter.bits, int));
+            PUBLISH_METHOD(insertRack.bits, int));
 
 auto crusherSampleRateSetting =
     Setting("SR: %d", 44100, 690, 44100,
             SIMPLE_LAMBDA(int i, i * 2),
             SIMPLE_LAMBDA(int i, i / 2),
-            PUBLISH_METHOD(bitCrusherFilter.sampleRate, int));
+            PUBLISH_METHOD(insertRack.sampleRate, int));
 
 //
 
@@ -128,15 +241,62 @@ auto wetDrySetting = Setting("Wet/Dry: %d%%", 0.7f, 0.0f, 1.0f,
                              PERCENT_CONVERSION);
 //
 
-auto delayRightSetting = Setting("DelayR: %d", 266, 0, 660,
+// free running delay times, used when the sync division is "free"
+auto delayRightSetting = Setting("DelayR: %d", 266, 0, FEEDBACK_DELAY_MAX_MS,
                                  SIMPLE_LAMBDA(int i, i < 10 ? i + 1 : i * 130 / 100),
                                  SIMPLE_LAMBDA(int i, i * 100 / 130),
-                                 PUBLISH_METHOD(feedbackFilter.setDelayRight, int));
+                                 SIMPLE_LAMBDA(int, updateDelayTimes()));
 
-auto delayLeftSetting = Setting("DelayL: %d", 399, 0, 660,
+auto delayLeftSetting = Setting("DelayL: %d", 399, 0, FEEDBACK_DELAY_MAX_MS,
                                 SIMPLE_LAMBDA(int i, i < 10 ? i + 1 : i * 130 / 100),
                                 SIMPLE_LAMBDA(int i, i * 100 / 130),
-                                PUBLISH_METHOD(feedbackFilter.setDelayLeft, int));
+                                SIMPLE_LAMBDA(int, updateDelayTimes()));
+
+//
+
+auto tempoSetting = Setting<int>("BPM: %d", 120, (int)TempoClock::MIN_BPM, (int)TempoClock::MAX_BPM,
+                                 SIMPLE_LAMBDA(int i, i + 1),
+                                 SIMPLE_LAMBDA(int i, i - 1),
+                                 +[](int i)
+                                 {
+                                   tempoClock.setBpm(i);
+                                   updateDelayTimes();
+                                   updateFreezeSlice();
+                                 });
+
+auto tapTempoSetting = ButtonSetting(
+    +[]()
+    {
+      if (tempoClock.tap(millis()))
+        tempoSetting.set((int)(tempoClock.getBpm() + 0.5f));
+    },
+    +[](Adafruit_GFX &gfx)
+    { gfx.print("tap"); });
+
+// freeze slice length as a note division; "free" loops the whole buffer
+auto freezeSliceSetting = Setting<int>("Slice: %d", 7, 0, NUM_NOTE_DIVISIONS - 1,
+                                       SIMPLE_LAMBDA(int i, i + 1),
+                                       SIMPLE_LAMBDA(int i, i - 1),
+                                       SIMPLE_LAMBDA(int, updateFreezeSlice()), NULL,
+                                       DISPLAY_LAMBDA(int i, { printDivision(gfx, "Slice", i, FREEZE_MAX_MS); }));
+
+auto freezeLatchSetting = ButtonSetting(
+    +[]()
+    { freezeLatched = !freezeLatched; },
+    +[](Adafruit_GFX &gfx)
+    { gfx.print(freezeLatched ? "latched" : "latch?"); });
+
+auto syncLeftSetting = Setting<int>("L: %d", 0, 0, NUM_NOTE_DIVISIONS - 1,
+                                    SIMPLE_LAMBDA(int i, i + 1),
+                                    SIMPLE_LAMBDA(int i, i - 1),
+                                    SIMPLE_LAMBDA(int, updateDelayTimes()), NULL,
+                                    DISPLAY_LAMBDA(int i, { printDivision(gfx, "L", i, FEEDBACK_DELAY_MAX_MS); }));
+
+auto syncRightSetting = Setting<int>("R: %d", 0, 0, NUM_NOTE_DIVISIONS - 1,
+                                     SIMPLE_LAMBDA(int i, i + 1),
+                                     SIMPLE_LAMBDA(int i, i - 1),
+                                     SIMPLE_LAMBDA(int, updateDelayTimes()), NULL,
+                                     DISPLAY_LAMBDA(int i, { printDivision(gfx, "R", i, FEEDBACK_DELAY_MAX_MS); }));
 
 //
 
@@ -165,28 +325,287 @@ auto filterResSetting = Setting("FRes: %d%%", 0.7f, 0.0f, 4.0f,
                                 PUBLISH_METHOD(feedbackFilter.setFilterRes, float),
                                 PERCENT_CONVERSION);
 
-// auto reverbSetting = Setting("Reverb: %d%%", 0.2f, 0.0f, 1.0f,
-//                              SIMPLE_LAMBDA(float f, f + 0.05f),
-//                              SIMPLE_LAMBDA(float f, f - 0.05f),
-//                              PUBLISH_METHOD(reverbFilter.time, float),
-//                              PERCENT_CONVERSION);
+auto reverbSetting = Setting("Reverb: %d%%", 0.2f, 0.0f, 1.0f,
+                             SIMPLE_LAMBDA(float f, f + 0.05f),
+                             SIMPLE_LAMBDA(float f, f - 0.05f),
+                             PUBLISH_METHOD(reverbFilter.mix, float),
+                             PERCENT_CONVERSION);
+
+auto reverbTimeSetting = Setting<float>("Time: %ds", 1.5f, 0.2f, 6.0f,
+                                        SIMPLE_LAMBDA(float f, f + 0.1f),
+                                        SIMPLE_LAMBDA(float f, f - 0.1f),
+                                        PUBLISH_METHOD(reverbFilter.time, float), NULL,
+                                        DISPLAY_LAMBDA(float f, {
+                                          int tenths = (int)(f * 10.0f + 0.5f);
+                                          gfx.printf("Time: %d.%ds", tenths / 10, tenths % 10);
+                                        }));
+
+// LFO rates in tenths of a Hz
+#define RATE_DISPLAY(label) DISPLAY_LAMBDA(float f, {            \
+  int tenths = (int)(f * 10.0f + 0.5f);                          \
+  gfx.printf(label ": %d.%dHz", tenths / 10, tenths % 10);       \
+})
+
+auto vocoderSetting = Setting("Vocoder: %d%%", 0.0f, 0.0f, 1.0f,
+                              SIMPLE_LAMBDA(float f, f + 0.05f),
+                              SIMPLE_LAMBDA(float f, f - 0.05f),
+                              PUBLISH_METHOD(vocoderFilter.mix, float),
+                              PERCENT_CONVERSION);
+
+// 8 bands, or 4 when the CPU is short
+auto vocoderBandsSetting = Setting<int>("Bands: %d", VOCODER_MAX_BANDS, 4, VOCODER_MAX_BANDS,
+                                        SIMPLE_LAMBDA(int i, i + 4),
+                                        SIMPLE_LAMBDA(int i, i - 4),
+                                        PUBLISH_METHOD(vocoderFilter.bands, int));
+
+auto foldSetting = Setting("Fold: %d%%", 0.0f, 0.0f, 1.0f,
+                           SIMPLE_LAMBDA(float f, f + 0.05f),
+                           SIMPLE_LAMBDA(float f, f - 0.05f),
+                           PUBLISH_METHOD(wavefolderFilter.mix, float),
+                           PERCENT_CONVERSION);
+
+auto foldDriveSetting = Setting("Drive: %d%%", 1.0f, 0.25f, 4.0f,
+                                SIMPLE_LAMBDA(float f, f + 0.05f),
+                                SIMPLE_LAMBDA(float f, f - 0.05f),
+                                PUBLISH_METHOD(wavefolderFilter.drive, float),
+                                PERCENT_CONVERSION);
+
+auto ringSetting = Setting("Ring: %d%%", 0.0f, 0.0f, 1.0f,
+                           SIMPLE_LAMBDA(float f, f + 0.05f),
+                           SIMPLE_LAMBDA(float f, f - 0.05f),
+                           PUBLISH_METHOD(ringModFilter.mix, float),
+                           PERCENT_CONVERSION);
+
+// 0 follows the lowest held key
+auto ringCarrierSetting = Setting<int>("Car: %dHz", 0, 0, 4000,
+                                       SIMPLE_LAMBDA(int i, i < 30 ? 30 : i * 115 / 100),
+                                       SIMPLE_LAMBDA(int i, i <= 30 ? 0 : i * 100 / 115),
+                                       SIMPLE_LAMBDA(int i, ringModFilter.carrier(i)), NULL,
+                                       DISPLAY_LAMBDA(int i, {
+                                         if (i == 0)
+                                           gfx.print("Car: key");
+                                         else
+                                           gfx.printf("Car: %dHz", i);
+                                       }));
+
+auto wahSetting = Setting("Wah: %d%%", 0.0f, 0.0f, 1.0f,
+                          SIMPLE_LAMBDA(float f, f + 0.05f),
+                          SIMPLE_LAMBDA(float f, f - 0.05f),
+                          PUBLISH_METHOD(autoWahFilter.mix, float),
+                          PERCENT_CONVERSION);
+
+auto wahSensitivitySetting = Setting<int>("Sens: %ddB", -12, -40, 0,
+                                          SIMPLE_LAMBDA(int i, i + 2),
+                                          SIMPLE_LAMBDA(int i, i - 2),
+                                          PUBLISH_METHOD(autoWahFilter.sensitivity, int));
+
+auto wahResonanceSetting = Setting<float>("Q: %d", 3.0f, 0.7f, 8.0f,
+                                          SIMPLE_LAMBDA(float f, f + 0.25f),
+                                          SIMPLE_LAMBDA(float f, f - 0.25f),
+                                          PUBLISH_METHOD(autoWahFilter.resonance, float), NULL,
+                                          DISPLAY_LAMBDA(float f, {
+                                            int tenths = (int)(f * 10.0f + 0.5f);
+                                            gfx.printf("Q: %d.%d", tenths / 10, tenths % 10);
+                                          }));
+
+auto wahReleaseSetting = Setting<int>("Rel: %dms", 150, 30, 1000,
+                                      SIMPLE_LAMBDA(int i, i * 120 / 100),
+                                      SIMPLE_LAMBDA(int i, i * 100 / 120),
+                                      SIMPLE_LAMBDA(int i, autoWahFilter.release(i / 1000.0f)));
+
+auto phaserSetting = Setting("Phaser: %d%%", 0.0f, 0.0f, 1.0f,
+                             SIMPLE_LAMBDA(float f, f + 0.05f),
+                             SIMPLE_LAMBDA(float f, f - 0.05f),
+                             PUBLISH_METHOD(phaserFilter.depth, float),
+                             PERCENT_CONVERSION);
+
+auto phaserRateSetting = Setting<float>("Rate: %d", 0.4f, 0.1f, 8.0f,
+                                        SIMPLE_LAMBDA(float f, f * 1.2f),
+                                        SIMPLE_LAMBDA(float f, f / 1.2f),
+                                        PUBLISH_METHOD(phaserFilter.rate, float), NULL,
+                                        RATE_DISPLAY("Rate"));
+
+auto phaserStagesSetting = Setting("Stages: %d", 4, 2, PHASER_MAX_STAGES,
+                                   SIMPLE_LAMBDA(int i, i + 2),
+                                   SIMPLE_LAMBDA(int i, i - 2),
+                                   PUBLISH_METHOD(phaserFilter.stages, int));
+
+auto phaserFeedbackSetting = Setting("FB: %d%%", 0.3f, 0.0f, 0.9f,
+                                     SIMPLE_LAMBDA(float f, f + 0.05f),
+                                     SIMPLE_LAMBDA(float f, f - 0.05f),
+                                     PUBLISH_METHOD(phaserFilter.feedback, float),
+                                     PERCENT_CONVERSION);
+
+auto tremoloSetting = Setting("Trem: %d%%", 0.0f, 0.0f, 1.0f,
+                              SIMPLE_LAMBDA(float f, f + 0.05f),
+                              SIMPLE_LAMBDA(float f, f - 0.05f),
+                              PUBLISH_METHOD(tremoloFilter.depth, float),
+                              PERCENT_CONVERSION);
+
+auto tremoloRateSetting = Setting<float>("Rate: %d", 4.0f, 0.1f, 16.0f,
+                                         SIMPLE_LAMBDA(float f, f * 1.2f),
+                                         SIMPLE_LAMBDA(float f, f / 1.2f),
+                                         PUBLISH_METHOD(tremoloFilter.rate, float), NULL,
+                                         RATE_DISPLAY("Rate"));
+
+auto tremoloPanSetting = Setting("Pan: %d%%", 0.0f, 0.0f, 1.0f,
+                                 SIMPLE_LAMBDA(float f, f + 0.05f),
+                                 SIMPLE_LAMBDA(float f, f - 0.05f),
+                                 PUBLISH_METHOD(tremoloFilter.pan, float),
+                                 PERCENT_CONVERSION);
+
+auto tremoloShapeSetting = Setting("Square: %d", 1, 1, 8,
+                                   SIMPLE_LAMBDA(int i, i + 1),
+                                   SIMPLE_LAMBDA(int i, i - 1),
+                                   PUBLISH_METHOD(tremoloFilter.shape, int));
+
+auto bodySetting = Setting("Body: %d%%", 0.0f, 0.0f, 1.0f,
+                           SIMPLE_LAMBDA(float f, f + 0.05f),
+                           SIMPLE_LAMBDA(float f, f - 0.05f),
+                           PUBLISH_METHOD(bodyFilter.mix, float),
+                           PERCENT_CONVERSION);
+
+auto bodyTypeSetting = Setting<int>("IR: %d", 0, 0, IMPULSE_RESPONSE_COUNT - 1,
+                                    SIMPLE_LAMBDA(int i, i + 1),
+                                    SIMPLE_LAMBDA(int i, i - 1),
+                                    PUBLISH_METHOD(bodyFilter.impulse, int), NULL,
+                                    DISPLAY_LAMBDA(int i, { gfx.printf("IR: %s", IMPULSE_RESPONSES[i]->name); }));
+
+auto resonatorSetting = Setting("Strings: %d%%", 0.0f, 0.0f, 1.0f,
+                                SIMPLE_LAMBDA(float f, f + 0.05f),
+                                SIMPLE_LAMBDA(float f, f - 0.05f),
+                                PUBLISH_METHOD(resonatorFilter.mix, float),
+                                PERCENT_CONVERSION);
+
+auto resonatorDecaySetting = Setting<float>("Ring: %ds", 2.0f, 0.2f, 8.0f,
+                                            SIMPLE_LAMBDA(float f, f + 0.2f),
+                                            SIMPLE_LAMBDA(float f, f - 0.2f),
+                                            PUBLISH_METHOD(resonatorFilter.decay, float), NULL,
+                                            DISPLAY_LAMBDA(float f, {
+                                              int tenths = (int)(f * 10.0f + 0.5f);
+                                              gfx.printf("Ring: %d.%ds", tenths / 10, tenths % 10);
+                                            }));
+
+const char *MOD_MODE_NAMES[] = {"off", "flange", "vibrato"};
 
-auto flangeSetting = Setting("Flange: %d", false, false, true,
-                             SIMPLE_LAMBDA(bool b, !b),
-                             SIMPLE_LAMBDA(bool b, !b),
-                             PUBLISH_METHOD(flangeFilter.enable, bool));
+auto modSetting = Setting<int>("Mod: %d", MOD_DELAY_OFF, MOD_DELAY_OFF, MOD_DELAY_MODE_COUNT - 1,
+                               SIMPLE_LAMBDA(int i, i + 1),
+                               SIMPLE_LAMBDA(int i, i - 1),
+                               PUBLISH_METHOD(insertRack.mode, int), NULL,
+                               DISPLAY_LAMBDA(int i, { gfx.printf("%s", MOD_MODE_NAMES[i]); }));
 
-auto chorusSetting = Setting("Chorus: %d", 1, 0, 10,
+auto chorusSetting = Setting("Chorus: %d", 1, 0, MOD_DELAY_MAX_VOICES,
                              SIMPLE_LAMBDA(int i, i + 1),
                              SIMPLE_LAMBDA(int i, i - 1),
-                             PUBLISH_METHOD(chorusFilter.voices, int));
+                             PUBLISH_METHOD(insertRack.voices, int));
+
+// master eq, one slide per band. The templates give each band its own
+// captureless publisher.
+template <uint8_t Band>
+Setting<int> eqFrequencySetting(int hz, int minHz, int maxHz)
+{
+  return Setting<int>("Freq: %dHz", hz, minHz, maxHz,
+                      SIMPLE_LAMBDA(int i, i * 115 / 100 + 1),
+                      SIMPLE_LAMBDA(int i, i * 100 / 115),
+                      SIMPLE_LAMBDA(int i, eqFilter.frequency(Band, i)));
+}
+
+template <uint8_t Band>
+Setting<int> eqGainSetting()
+{
+  return Setting<int>("Gain: %ddB", 0, -12, 12,
+                      SIMPLE_LAMBDA(int i, i + 1),
+                      SIMPLE_LAMBDA(int i, i - 1),
+                      SIMPLE_LAMBDA(int i, eqFilter.gain(Band, i)));
+}
+
+template <uint8_t Band>
+Setting<float> eqQSetting()
+{
+  return Setting<float>("Q: %d", 1.0f, 0.3f, 8.0f,
+                        SIMPLE_LAMBDA(float f, f * 1.2f),
+                        SIMPLE_LAMBDA(float f, f / 1.2f),
+                        SIMPLE_LAMBDA(float f, eqFilter.q(Band, f)), NULL,
+                        DISPLAY_LAMBDA(float f, {
+                          int tenths = (int)(f * 10.0f + 0.5f);
+                          gfx.printf("Q: %d.%d", tenths / 10, tenths % 10);
+                        }));
+}
+
+auto eqLowFreqSetting = eqFrequencySetting<0>(120, 30, 500);
+auto eqLowGainSetting = eqGainSetting<0>();
+auto eqMid1FreqSetting = eqFrequencySetting<1>(500, 100, 4000);
+auto eqMid1GainSetting = eqGainSetting<1>();
+auto eqMid2FreqSetting = eqFrequencySetting<2>(2500, 500, 12000);
+auto eqMid2GainSetting = eqGainSetting<2>();
+auto eqHighFreqSetting = eqFrequencySetting<3>(8000, 2000, 16000);
+auto eqHighGainSetting = eqGainSetting<3>();
+auto eqMid1QSetting = eqQSetting<1>();
+auto eqMid2QSetting = eqQSetting<2>();
+
+/// @brief Edits the order of a filter chain or an fx rack. Turn to pick a
+/// slot, press to grab what's in it, turn to carry it along, press again
+/// to let go.
+template <typename Chain>
+class ChainOrderSetting : public ISetting
+{
+  Chain &chain;
+  int slot = 0;
+  bool grabbed = false;
+
+public:
+  ChainOrderSetting(Chain &chain_) : chain(chain_) {}
+
+  void step(int delta)
+  {
+    int to = slot + delta;
+    if (to < 0 || to >= chain.size())
+      return;
+    if (grabbed)
+      chain.move(slot, to);
+    slot = to;
+  }
+
+  void increment() { step(1); }
+  void decrement() { step(-1); }
+  void publish() {}
+  void begin() {}
+
+  bool buttonDown()
+  {
+    grabbed = !grabbed;
+    return true;
+  }
+
+  void display(Adafruit_GFX &gfx)
+  {
+    if (chain.size() == 0)
+    {
+      gfx.print("empty");
+      return;
+    }
+    gfx.printf(grabbed ? "%d: [%s]" : "%d: %s", slot + 1, chain.nameAt(slot));
+  }
+};
+
+auto insertOrderSetting = ChainOrderSetting(synthinstance.getInserts());
+auto rackOrderSetting = ChainOrderSetting(insertRack.rack);
 
 auto presetSlide = PresetSlide(
     Preset("flat", {
       wetDrySetting.set(0);
+      reverbSetting.set(0);
+      resonatorSetting.reset();
+      bodySetting.reset();
+      vocoderSetting.reset();
+      foldSetting.reset();
+      ringSetting.reset();
+      wahSetting.reset();
+      phaserSetting.reset();
+      tremoloSetting.reset();
       crusherBitsSetting.reset();
       crusherSampleRateSetting.reset();
-      flangeSetting.reset();
+      modSetting.reset();
       chorusSetting.reset();
     }),
     Preset("default", {
@@ -194,18 +613,24 @@ auto presetSlide = PresetSlide(
       crusherSampleRateSetting.reset();
       driveSetting.reset();
       wetDrySetting.reset();
+      syncLeftSetting.reset();
+      syncRightSetting.reset();
       delayRightSetting.reset();
       delayLeftSetting.reset();
       feedbackSetting.reset();
       crossFeedbackSetting.reset();
       filterFreqSetting.reset();
       filterResSetting.reset();
-      flangeSetting.reset();
+      modSetting.reset();
       chorusSetting.reset();
+      reverbSetting.reset();
+      reverbTimeSetting.reset();
     }),
     Preset("whine", {
       driveSetting.set(4.0);
       wetDrySetting.set(0.6);
+      syncLeftSetting.reset();
+      syncRightSetting.reset();
       delayLeftSetting.set(64);
       delayRightSetting.set(88);
       feedbackSetting.set(0.29);
@@ -217,6 +642,8 @@ auto presetSlide = PresetSlide(
       crusherBitsSetting.set(3);
       driveSetting.set(4.0);
       wetDrySetting.set(0.6);
+      syncLeftSetting.reset();
+      syncRightSetting.reset();
       delayLeftSetting.set(64);
       delayRightSetting.set(88);
       feedbackSetting.set(0.09);
@@ -227,14 +654,41 @@ auto presetSlide = PresetSlide(
 
 auto menu = Menu(display,
                  Slide(volumeSetting, voiceSetting, "main"),
+                 Slide(sendSetting, returnSetting, "send"),
+                 Slide(inputModeSetting, inputLevelSetting, "input"),
+                 Slide(trackSetting, trackGateSetting, "pitch track"),
                  Slide(scalePatternSetting, scaleRootSetting, "scale"),
+                 Slide(modalPresetSetting, modalDecaySetting, "mallets"),
+                 Slide(fmPresetSetting, fmBrightnessSetting, "fm"),
+                 Slide(drumTuningSetting, drumLevelSetting, "drums"),
                  Slide(crusherBitsSetting, crusherSampleRateSetting, "bit crusher"),
 
                  Slide(driveSetting, wetDrySetting, "drive"),
                  Slide(delayLeftSetting, delayRightSetting, "delay"),
+                 Slide(syncLeftSetting, syncRightSetting, "delay sync"),
+                 Slide(tempoSetting, tapTempoSetting, "tempo"),
+                 Slide(freezeSliceSetting, freezeLatchSetting, "freeze"),
                  Slide(feedbackSetting, crossFeedbackSetting, "feedback"),
                  Slide(filterFreqSetting, filterResSetting, "filter"),
-                 Slide(flangeSetting, chorusSetting, "flange"),
+                 Slide(modSetting, chorusSetting, "modulation"),
+                 Slide(reverbSetting, reverbTimeSetting, "reverb"),
+                 Slide(vocoderSetting, vocoderBandsSetting, "vocoder"),
+                 Slide(foldSetting, foldDriveSetting, "wavefolder"),
+                 Slide(ringSetting, ringCarrierSetting, "ring mod"),
+                 Slide(wahSetting, wahSensitivitySetting, "auto-wah"),
+                 Slide(wahResonanceSetting, wahReleaseSetting, "wah tone"),
+                 Slide(phaserSetting, phaserRateSetting, "phaser"),
+                 Slide(phaserStagesSetting, phaserFeedbackSetting, "phaser tone"),
+                 Slide(tremoloSetting, tremoloRateSetting, "tremolo"),
+                 Slide(tremoloPanSetting, tremoloShapeSetting, "auto-pan"),
+                 Slide(bodySetting, bodyTypeSetting, "body"),
+                 Slide(resonatorSetting, resonatorDecaySetting, "resonator"),
+                 Slide(eqLowFreqSetting, eqLowGainSetting, "eq low"),
+                 Slide(eqMid1FreqSetting, eqMid1GainSetting, "eq mid 1"),
+                 Slide(eqMid2FreqSetting, eqMid2GainSetting, "eq mid 2"),
+                 Slide(eqHighFreqSetting, eqHighGainSetting, "eq high"),
+                 Slide(eqMid1QSetting, eqMid2QSetting, "eq q"),
+                 Slide(insertOrderSetting, rackOrderSetting, "fx order"),
                  presetSlide.getSlide());
 
 class EncoderLeft : public EncoderControl
@@ -261,6 +715,34 @@ public:
 EncoderLeft encoder1;
 EncoderRight encoder2;
 
+/// @brief push delay times to the feedback filter: synced channels follow
+/// the tempo clock, free ones use their millisecond setting
+void updateDelayTimes()
+{
+  float left = tempoClock.divisionMs(syncLeftSetting.get(), FEEDBACK_DELAY_MAX_MS);
+  float right = tempoClock.divisionMs(syncRightSetting.get(), FEEDBACK_DELAY_MAX_MS);
+  feedbackFilter.setDelayLeft(left > 0 ? left : delayLeftSetting.get());
+  feedbackFilter.setDelayRight(right > 0 ? right : delayRightSetting.get());
+}
+
+/// @brief show a sync division, and what actually plays when it had to
+/// be halved to fit in maxMs at this tempo, e.g. "L: 1/4 (1/16)"
+void printDivision(Adafruit_GFX &gfx, const char *label, int division, float maxMs)
+{
+  char played[12];
+  tempoClock.playedName(division, maxMs, played, sizeof(played));
+  if (strcmp(played, NOTE_DIVISIONS[division].name) == 0)
+    gfx.printf("%s: %s", label, played);
+  else
+    gfx.printf("%s: %s (%s)", label, NOTE_DIVISIONS[division].name, played);
+}
+
+void updateFreezeSlice()
+{
+  float ms = tempoClock.divisionMs(freezeSliceSetting.get(), FREEZE_MAX_MS);
+  freezeFilter.setSliceLength(ms > 0 ? ms : FREEZE_MAX_MS);
+}
+
 void setup()
 {
 
@@ -270,7 +752,9 @@ void setup()
   trellis.begin();
   trellis.setBrightness(255);
 
-  AudioMemory(200); // Increased mainly to support the delay effects
+  // Delay lines have their own fixed buffers, so the pool only has to
+  // cover blocks in flight through the voice and filter graph.
+  AudioMemory(AUDIO_MEMORY_BLOCKS);
 
   // Initialize processor and memory measurements
   AudioProcessorUsageMaxReset();
@@ -281,16 +765,31 @@ void setup()
   synthinstance.begin();
 
   // setup all filters
-  synthinstance.pushFilter(flangeFilter);
-  synthinstance.pushFilter(chorusFilter);
-  synthinstance.pushFilter(feedbackFilter);
-  synthinstance.pushFilter(bitCrusherFilter);
-  synthinstance.pushFilter(limiterFilter);
-  synthinstance.pushFilter(gainFilter);
+  // inserts on the dry path
+  // the audio input is the vocoder's modulator, the synth its carrier
+  vocoderFilter.modulator(synthinstance.getInput(), 0);
+  synthinstance.pushFilter(bodyFilter);
+  synthinstance.pushFilter(vocoderFilter);
+  synthinstance.pushFilter(autoWahFilter);
+  synthinstance.pushFilter(wavefolderFilter);
+  synthinstance.pushFilter(ringModFilter);
+  synthinstance.pushFilter(insertRack);
+  synthinstance.pushFilter(phaserFilter);
+  synthinstance.pushFilter(tremoloFilter);
+  synthinstance.pushFilter(resonatorFilter);
+
+  // time based effects share the send bus
+  synthinstance.pushSendFilter(feedbackFilter);
+  synthinstance.pushSendFilter(reverbFilter);
+
+  // master bus, after the returns
+  synthinstance.pushMasterFilter(freezeFilter);
+  // eq goes before the limiter so boosts can't clip the output
+  synthinstance.pushMasterFilter(eqFilter);
+  synthinstance.pushMasterFilter(outputFilter);
 
   // finally, connect the final output to sound out
-  patchOutLeft = new (bpol) AudioConnection(synthinstance.getOutputLeft(), 0, audioOut, 0);
-  patchOutRight = new (bpor) AudioConnection(synthinstance.getOutputRight(), 0, audioOut, 1);
+  synthinstance.connectOutput(audioOut);
 
   // Serial.println("synth started");
 
@@ -320,11 +819,13 @@ void setup()
 void noteOn(int num)
 {
   synthinstance.noteOn(num);
+  ringModFilter.track(synthinstance.lowestHeldFrequency());
 }
 
 void noteOff(int num)
 {
   synthinstance.noteOff(num);
+  ringModFilter.track(synthinstance.lowestHeldFrequency());
 }
 
 void loop()
@@ -360,6 +861,12 @@ void loop()
   encoder1.loop();
   encoder2.loop();
 
+  synthinstance.updateFilters();
+  synthinstance.trackPitch();
+
+  // holding both encoder buttons freezes the output, as does the latch
+  freezeFilter.hold(freezeLatched || (encoder1.isHeld() && encoder2.isHeld()));
+
   if (presetSlide.tick())
   {
     menu.display();
@@ -388,6 +895,15 @@ void monitorUsage()
     Serial.print(AudioProcessorUsageMax());
     Serial.println("%)");
 
+    // the chains run their filters' nodes, so this is what the effects cost
+    Serial.print("FX CPU: ");
+    Serial.print(synthinstance.getInserts().processorUsage());
+    Serial.print("% + ");
+    Serial.print(synthinstance.getSends().processorUsage());
+    Serial.print("% + ");
+    Serial.print(synthinstance.getMaster().processorUsage());
+    Serial.println("% (inserts + sends + master)");
+
     lastPrint = now;
   }
 }
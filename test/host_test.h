@@ -0,0 +1,132 @@
+#pragma once
+
+// A few checks and test nodes shared by the host tests. Each test is its
+// own executable; main() returns the number of failed checks.
+
+#include <Arduino.h>
+#include <AudioStream.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(cond)                                                    \
+    do                                                                 \
+    {                                                                  \
+        if (!(cond))                                                   \
+        {                                                              \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                \
+        }                                                              \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tolerance)                                              \
+    do                                                                           \
+    {                                                                            \
+        double a_ = (a), b_ = (b);                                               \
+        if (!(fabs(a_ - b_) <= (tolerance)))                                     \
+        {                                                                        \
+            printf("%s:%d: %s = %g, expected %g +- %g\n", __FILE__, __LINE__, #a, \
+                   a_, b_, (double)(tolerance));                                 \
+            failures++;                                                          \
+        }                                                                        \
+    } while (0)
+
+/// @brief run a test function, printing its name
+#define RUN(test)               \
+    do                          \
+    {                           \
+        printf("%s\n", #test); \
+        test();                 \
+    } while (0)
+
+/// @brief nanoseconds per call of f, best of a few runs
+template <typename F>
+double nanosecondsPer(F f, int calls)
+{
+    double best = 1e30;
+    for (int run = 0; run < 5; run++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < calls; i++)
+            f();
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / calls;
+        if (ns < best)
+            best = ns;
+    }
+    return best;
+}
+
+/// @brief A stereo source for a graph under test: sends whatever is in
+/// left and right each update, and nothing once they run out.
+class TestSource : public AudioStream
+{
+public:
+    TestSource(void) : AudioStream(0, NULL) {}
+
+    std::vector<int16_t> left;
+    std::vector<int16_t> right;
+    size_t position = 0;
+
+    virtual void update(void)
+    {
+        if (position + AUDIO_BLOCK_SAMPLES > left.size())
+            return;
+        audio_block_t *l = allocate();
+        audio_block_t *r = allocate();
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        {
+            l->data[i] = left[position + i];
+            r->data[i] = right.size() > position + i ? right[position + i] : left[position + i];
+        }
+        position += AUDIO_BLOCK_SAMPLES;
+        transmit(l, 0);
+        transmit(r, 1);
+        release(l);
+        release(r);
+    }
+};
+
+/// @brief Records what reaches its two inputs, a block of zeros for any
+/// update that brought nothing.
+class TestSink : public AudioStream
+{
+public:
+    TestSink(void) : AudioStream(2, inputQueueArray) {}
+
+    std::vector<int16_t> left;
+    std::vector<int16_t> right;
+
+    virtual void update(void)
+    {
+        record(receiveReadOnly(0), left);
+        record(receiveReadOnly(1), right);
+    }
+
+    /// @brief rms of a channel over [from, to) samples
+    static double rms(const std::vector<int16_t> &x, size_t from, size_t to)
+    {
+        double sum = 0;
+        for (size_t i = from; i < to && i < x.size(); i++)
+            sum += (double)x[i] * x[i];
+        return to > from ? sqrt(sum / (to - from)) : 0.0;
+    }
+
+private:
+    audio_block_t *inputQueueArray[2];
+
+    void record(audio_block_t *block, std::vector<int16_t> &out)
+    {
+        if (block)
+        {
+            out.insert(out.end(), block->data, block->data + AUDIO_BLOCK_SAMPLES);
+            release(block);
+        }
+        else
+        {
+            out.insert(out.end(), AUDIO_BLOCK_SAMPLES, 0);
+        }
+    }
+};
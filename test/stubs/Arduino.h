@@ -0,0 +1,35 @@
+#pragma once
+
+// Just enough of the Arduino core for the DSP sources to build on a host.
+// __SAMD51__ is left undefined, so the portable (non CMSIS) paths are the
+// ones under test.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define INPUT_PULLUP 2
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+struct HostSerial
+{
+    void begin(int) {}
+    template <typename... A>
+    void printf(const char *, A...) {}
+    template <typename T>
+    void print(T) {}
+    template <typename T>
+    void println(T) {}
+    void println() {}
+};
+extern HostSerial Serial;
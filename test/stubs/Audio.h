@@ -0,0 +1,192 @@
+#pragma once
+
+// The audio library nodes the sources use. AudioMixer4 works like the
+// library's; the rest are inert, sized roughly like the real ones so
+// sizeof() based RAM accounting stays honest.
+
+#include <AudioStream.h>
+
+#define FLANGE_DELAY_PASSTHRU -1
+
+enum
+{
+    WAVEFORM_SINE,
+    WAVEFORM_SAWTOOTH,
+    WAVEFORM_SQUARE,
+    WAVEFORM_TRIANGLE
+};
+
+class AudioMixer4 : public AudioStream
+{
+public:
+    AudioMixer4(void) : AudioStream(4, inputQueueArray)
+    {
+        for (int i = 0; i < 4; i++)
+            multiplier[i] = 65536;
+    }
+
+    void gain(unsigned int channel, float gain)
+    {
+        if (channel >= 4)
+            return;
+        gain = constrain(gain, -32767.0f, 32767.0f);
+        multiplier[channel] = (int32_t)(gain * 65536.0f);
+    }
+
+    virtual void update(void)
+    {
+        audio_block_t *out = NULL;
+        for (int channel = 0; channel < 4; channel++)
+        {
+            audio_block_t *in = receiveReadOnly(channel);
+            if (!in)
+                continue;
+            if (!out)
+            {
+                out = allocate();
+                memset(out->data, 0, sizeof(out->data));
+            }
+            for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+            {
+                int32_t sum = out->data[i] + (int32_t)(((int64_t)in->data[i] * multiplier[channel]) >> 16);
+                out->data[i] = constrain(sum, -32768, 32767);
+            }
+            release(in);
+        }
+        if (out)
+        {
+            transmit(out);
+            release(out);
+        }
+    }
+
+private:
+    int32_t multiplier[4];
+    audio_block_t *inputQueueArray[4];
+};
+
+/// @brief a node that swallows its input and sends nothing
+template <int N>
+class InertNode : public AudioStream
+{
+public:
+    InertNode(void) : AudioStream(N, inputQueueArray) {}
+
+    virtual void update(void)
+    {
+        for (int i = 0; i < N; i++)
+            release(receiveReadOnly(i));
+    }
+
+private:
+    audio_block_t *inputQueueArray[N ? N : 1];
+};
+
+class AudioSynthWaveform : public InertNode<0>
+{
+    uint32_t state[12];
+
+public:
+    void begin(short) {}
+    void begin(float, float, short) {}
+    void amplitude(float) {}
+    void frequency(float) {}
+    void offset(float) {}
+    void pulseWidth(float) {}
+};
+
+class AudioSynthWaveformModulated : public InertNode<2>
+{
+    uint32_t state[16];
+};
+
+class AudioEffectEnvelope : public InertNode<1>
+{
+    uint32_t state[16];
+
+public:
+    void noteOn() {}
+    void noteOff() {}
+    void delay(float) {}
+    void attack(float) {}
+    void hold(float) {}
+    void decay(float) {}
+    void sustain(float) {}
+    void release(float) {}
+    void releaseNoteOn(float) {}
+    bool isActive() { return false; }
+};
+
+class AudioFilterStateVariable : public InertNode<2>
+{
+    uint32_t state[8];
+
+public:
+    void frequency(float) {}
+    void resonance(float) {}
+    void octaveControl(float) {}
+};
+
+class AudioFilterBiquad : public InertNode<1>
+{
+    int32_t definition[32];
+
+public:
+    void setLowpass(uint32_t, float, float = 0.7071f) {}
+    void setHighpass(uint32_t, float, float = 0.7071f) {}
+    void setBandpass(uint32_t, float, float = 1.0f) {}
+};
+
+// the real node keeps a 536 sample string
+class AudioSynthKarplusStrong : public InertNode<0>
+{
+    int16_t buffer[536];
+    uint32_t state[4];
+
+public:
+    void noteOn(float, float) {}
+    void noteOff(float) {}
+};
+
+class AudioEffectBitcrusher : public InertNode<1>
+{
+public:
+    void bits(uint8_t) {}
+    void sampleRate(float) {}
+};
+
+class AudioEffectFlange : public InertNode<1>
+{
+public:
+    bool begin(short *, int, int, int, float) { return true; }
+    bool voices(int, int, float) { return true; }
+};
+
+class AudioEffectChorus : public InertNode<1>
+{
+public:
+    bool begin(short *, int, int) { return true; }
+    void voices(int) {}
+};
+
+class AudioEffectDelay : public InertNode<1>
+{
+public:
+    void delay(uint8_t, float) {}
+    void disable(uint8_t) {}
+};
+
+class AudioAnalyzeRMS : public InertNode<1>
+{
+public:
+    bool available() { return false; }
+    float read() { return 0.0f; }
+};
+
+class AudioOutputAnalogStereo : public InertNode<2>
+{
+};
+
+class AudioInputAnalogStereo : public InertNode<0>
+{
+};
@@ -0,0 +1,166 @@
+#include <AudioStream.h>
+#include <chrono>
+
+HostSerial Serial;
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+unsigned long millis()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long) {}
+
+uint16_t AudioStream::memory_used = 0;
+uint16_t AudioStream::memory_used_max = 0;
+AudioStream *AudioStream::first_update = NULL;
+
+AudioStream::AudioStream(unsigned char ninput, audio_block_t **iqueue)
+    : num_inputs(ninput), inputQueue(iqueue)
+{
+    for (int i = 0; i < num_inputs; i++)
+        inputQueue[i] = NULL;
+
+    // update order is construction order
+    if (!first_update)
+    {
+        first_update = this;
+    }
+    else
+    {
+        AudioStream *p = first_update;
+        while (p->next_update)
+            p = p->next_update;
+        p->next_update = this;
+    }
+}
+
+AudioStream::~AudioStream()
+{
+    for (AudioStream **p = &first_update; *p; p = &(*p)->next_update)
+    {
+        if (*p == this)
+        {
+            *p = next_update;
+            break;
+        }
+    }
+    for (int i = 0; i < num_inputs; i++)
+        release(inputQueue[i]);
+}
+
+void AudioStream::update_all(void)
+{
+    for (AudioStream *p = first_update; p; p = p->next_update)
+    {
+        if (p->active)
+            p->update();
+    }
+}
+
+audio_block_t *AudioStream::allocate(void)
+{
+    audio_block_t *block = new audio_block_t();
+    block->ref_count = 1;
+    memory_used++;
+    if (memory_used > memory_used_max)
+        memory_used_max = memory_used;
+    return block;
+}
+
+void AudioStream::release(audio_block_t *block)
+{
+    if (!block)
+        return;
+    if (--block->ref_count == 0)
+    {
+        delete block;
+        memory_used--;
+    }
+}
+
+void AudioStream::transmit(audio_block_t *block, unsigned char index)
+{
+    for (AudioConnection *c = destination_list; c; c = c->next_dest)
+    {
+        if (c->src_index != index)
+            continue;
+        if (!c->dst.inputQueue[c->dest_index])
+        {
+            c->dst.inputQueue[c->dest_index] = block;
+            block->ref_count++;
+        }
+    }
+}
+
+audio_block_t *AudioStream::receiveReadOnly(unsigned int index)
+{
+    if (index >= num_inputs)
+        return NULL;
+    audio_block_t *in = inputQueue[index];
+    inputQueue[index] = NULL;
+    return in;
+}
+
+audio_block_t *AudioStream::receiveWritable(unsigned int index)
+{
+    audio_block_t *in = receiveReadOnly(index);
+    if (in && in->ref_count > 1)
+    {
+        audio_block_t *p = allocate();
+        memcpy(p->data, in->data, sizeof(p->data));
+        in->ref_count--;
+        in = p;
+    }
+    return in;
+}
+
+AudioConnection::AudioConnection(AudioStream &source, unsigned char sourceOutput,
+                                 AudioStream &destination, unsigned char destinationInput)
+    : src(source), dst(destination), src_index(sourceOutput), dest_index(destinationInput)
+{
+    connect();
+}
+
+void AudioConnection::connect()
+{
+    if (isConnected || dest_index >= dst.num_inputs)
+        return;
+    AudioConnection **p = &src.destination_list;
+    while (*p)
+        p = &(*p)->next_dest;
+    *p = this;
+    next_dest = NULL;
+    src.active = true;
+    dst.active = true;
+    src.numConnections++;
+    dst.numConnections++;
+    isConnected = true;
+}
+
+void AudioConnection::disconnect()
+{
+    if (!isConnected)
+        return;
+    for (AudioConnection **p = &src.destination_list; *p; p = &(*p)->next_dest)
+    {
+        if (*p == this)
+        {
+            *p = next_dest;
+            break;
+        }
+    }
+    if (--src.numConnections == 0)
+        src.active = false;
+    if (--dst.numConnections == 0)
+        dst.active = false;
+    AudioStream::release(dst.inputQueue[dest_index]);
+    dst.inputQueue[dest_index] = NULL;
+    isConnected = false;
+}
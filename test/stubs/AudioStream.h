@@ -0,0 +1,89 @@
+#pragma once
+
+// A host version of the audio library's update graph: nodes, connections,
+// reference counted blocks and the update pass, behaving like the Teensy
+// core's AudioStream. Blocks come from the heap rather than a fixed pool,
+// and the pass runs when a test calls AudioStream::update_all().
+
+#include <Arduino.h>
+
+#define AUDIO_BLOCK_SAMPLES 128
+#define AUDIO_SAMPLE_RATE 44100
+#define AUDIO_SAMPLE_RATE_EXACT 44100.0f
+
+typedef struct audio_block_struct
+{
+    uint8_t ref_count;
+    uint8_t reserved1;
+    uint16_t memory_pool_index;
+    int16_t data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+class AudioStream;
+
+class AudioConnection
+{
+public:
+    AudioConnection(AudioStream &source, AudioStream &destination)
+        : AudioConnection(source, 0, destination, 0) {}
+    AudioConnection(AudioStream &source, unsigned char sourceOutput,
+                    AudioStream &destination, unsigned char destinationInput);
+    ~AudioConnection() { disconnect(); }
+
+    void connect();
+    void disconnect();
+
+private:
+    AudioStream &src;
+    AudioStream &dst;
+    unsigned char src_index;
+    unsigned char dest_index;
+    AudioConnection *next_dest = NULL;
+    bool isConnected = false;
+    friend class AudioStream;
+};
+
+#define AudioMemory(num) ((void)(num))
+#define AudioNoInterrupts() ((void)0)
+#define AudioInterrupts() ((void)0)
+#define AudioProcessorUsage() (0.0f)
+#define AudioProcessorUsageMax() (0.0f)
+#define AudioProcessorUsageMaxReset() ((void)0)
+#define AudioMemoryUsage() (AudioStream::memory_used)
+#define AudioMemoryUsageMax() (AudioStream::memory_used_max)
+#define AudioMemoryUsageMaxReset() (AudioStream::memory_used_max = AudioStream::memory_used)
+
+class AudioStream
+{
+public:
+    AudioStream(unsigned char ninput, audio_block_t **iqueue);
+    virtual ~AudioStream();
+
+    bool isActive(void) { return active; }
+    float processorUsage(void) { return 0.0f; }
+    float processorUsageMax(void) { return 0.0f; }
+
+    static uint16_t memory_used;
+    static uint16_t memory_used_max;
+
+    /// @brief one update pass over every active node, in construction order
+    static void update_all(void);
+
+protected:
+    bool active = false;
+    unsigned char num_inputs;
+    static audio_block_t *allocate(void);
+    static void release(audio_block_t *block);
+    void transmit(audio_block_t *block, unsigned char index = 0);
+    audio_block_t *receiveReadOnly(unsigned int index = 0);
+    audio_block_t *receiveWritable(unsigned int index = 0);
+    uint8_t numConnections = 0;
+    friend class AudioConnection;
+
+private:
+    virtual void update(void) = 0;
+    audio_block_t **inputQueue;
+    AudioConnection *destination_list = NULL;
+    AudioStream *next_update = NULL;
+    static AudioStream *first_update;
+};
@@ -0,0 +1,56 @@
+// The body filter: its wet output against a direct convolution with the
+// same IR, for both IRs. The cost per block on this host is printed for
+// reference.
+
+#include "host_test.h"
+#include "fx_convolution.h"
+
+static const size_t FRAMES = 60 * AUDIO_BLOCK_SAMPLES;
+
+static void testAgainstDirect()
+{
+    std::vector<float> x(FRAMES);
+    uint32_t seed = 7;
+    for (size_t i = 0; i < FRAMES; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        x[i] = 8000.0f * ((int32_t)seed / 2147483648.0f) + 6000.0f * sinf(i * 0.01f);
+    }
+
+    for (const ImpulseResponse *ir : IMPULSE_RESPONSES)
+    {
+        static ConvolutionProcessor body;
+        body.impulse(*ir);
+        body.mix(1.0f);
+        std::vector<float> left = x, right = x;
+        body.process(left.data(), right.data(), FRAMES);
+
+        // after the IR has filled, so every output sums all of it
+        double error = 0, signal = 0;
+        for (size_t n = ir->length; n < FRAMES; n++)
+        {
+            double y = 0;
+            for (size_t k = 0; k < ir->length; k++)
+                y += (double)ir->samples[k] * ir->scale * x[n - k];
+            error += (left[n] - y) * (left[n] - y);
+            signal += y * y;
+        }
+        double db = 10.0 * log10(error / signal);
+        printf("  %s: %u taps, error %.1fdB\n", ir->name, ir->length, db);
+        CHECK(ir->length * 1000.0 / AUDIO_SAMPLE_RATE_EXACT >= 50.0);
+        CHECK(db < -75.0);
+        CHECK(left == right);
+
+        float block[AUDIO_BLOCK_SAMPLES] = {};
+        double ns = nanosecondsPer([&]
+                                   { body.process(block, block, AUDIO_BLOCK_SAMPLES); },
+                                   100);
+        printf("  %.1fus a block\n", ns / 1000.0);
+    }
+}
+
+int main()
+{
+    RUN(testAgainstDirect);
+    return failures;
+}
@@ -0,0 +1,81 @@
+// The drum kit decodes samples the way wav2sketch encodes them: a ramp
+// encoded with its encoder comes back within one u-law step, and silence
+// stays silent.
+
+#include "host_test.h"
+#include "play_drum_kit.h"
+
+// wav2sketch's u-law encoder
+static uint8_t encode(int16_t audio)
+{
+    uint32_t mag = audio >= 0 ? audio : -(int32_t)audio;
+    uint8_t neg = audio >= 0 ? 0 : 0x80;
+    mag += 128;
+    if (mag > 0x7fff)
+        mag = 0x7fff;
+    for (int e = 7; e >= 1; e--)
+        if (mag >= (0x80u << e))
+            return neg | (e << 4) | ((mag >> (e + 3)) & 0x0f);
+    return neg | ((mag >> 3) & 0x0f);
+}
+
+// a format 0x01 sample of the given audio, laid out as wav2sketch does
+static std::vector<unsigned int> sketch(const std::vector<int16_t> &audio)
+{
+    std::vector<unsigned int> words(1 + (audio.size() + 3) / 4, 0);
+    words[0] = 0x01u << 24 | (unsigned int)audio.size();
+    for (size_t i = 0; i < audio.size(); i++)
+        words[1 + i / 4] |= (unsigned int)encode(audio[i]) << (8 * (i % 4));
+    return words;
+}
+
+static std::vector<int16_t> play(const std::vector<int16_t> &audio)
+{
+    std::vector<unsigned int> sample = sketch(audio);
+    AudioPlayDrumKit kit;
+    TestSink sink;
+    AudioConnection c1(kit, 0, sink, 0);
+
+    kit.trigger(sample.data(), 1.0f, 1.0f, 0);
+    for (size_t b = 0; b <= audio.size() / AUDIO_BLOCK_SAMPLES; b++)
+        AudioStream::update_all();
+    return sink.left;
+}
+
+static void testRoundTrip()
+{
+    std::vector<int16_t> ramp;
+    for (int32_t x = -32000; x <= 32000; x += 50)
+        ramp.push_back((int16_t)x);
+
+    std::vector<int16_t> out = play(ramp);
+    CHECK(out.size() >= ramp.size());
+    double worst = 0;
+    for (size_t i = 0; i + 1 < ramp.size(); i++)
+    {
+        // the step at this level, 1/16 of its segment
+        double step = std::max(8.0, fabs((double)ramp[i]) / 16.0);
+        worst = std::max(worst, fabs(out[i] - ramp[i]) / step);
+    }
+    printf("  worst error %.2f steps\n", worst);
+    CHECK(worst <= 1.0);
+}
+
+static void testSilence()
+{
+    std::vector<int16_t> zeros(4 * AUDIO_BLOCK_SAMPLES, 0);
+    std::vector<int16_t> out = play(zeros);
+    int worst = 0;
+    for (size_t i = 0; i + 1 < zeros.size(); i++)
+        worst = std::max(worst, abs(out[i]));
+    printf("  loudest decoded silence %d\n", worst);
+    CHECK(worst <= 4);
+}
+
+int main()
+{
+    RUN(testRoundTrip);
+    RUN(testSilence);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
@@ -0,0 +1,156 @@
+// fast_math.h against libm: the worst case error over each function's
+// stated domain must be within what its comment says, and the cost next
+// to libm's on this host is printed for reference.
+
+#include "host_test.h"
+#include "fast_math.h"
+
+// the bounds documented in fast_math.h
+static const double LOG2_ABS = 1.33e-3;
+static const double EXP2_REL = 5.3e-6;
+static const double EXP_REL = 4.5e-6;
+static const double DB_ABS = 0.008;
+static const double DB_TO_UNIT_REL = 3.8e-6;
+static const double SINE_Q15_LSB = 1.6;
+static const double SIN_PHASE_ABS = 1.8e-5;
+static const double SIN_ABS_10 = 1.8e-5;
+static const double SIN_ABS_100 = 2.5e-5;
+static const double TANH_ABS = 9.7e-5;
+static const double RATIO_REL = 5.3e-6;
+
+static const int STEPS = 2000000;
+
+template <typename F>
+static double sweep(double from, double to, F error)
+{
+    double worst = 0;
+    for (int i = 0; i <= STEPS; i++)
+    {
+        double e = error(from + (to - from) * i / STEPS);
+        if (e > worst)
+            worst = e;
+    }
+    return worst;
+}
+
+static double relative(double approx, double exact) { return fabs(approx - exact) / fabs(exact); }
+
+static void report(const char *name, double measured, double documented)
+{
+    printf("  %-22s %.3g (documented %.3g)\n", name, measured, documented);
+    CHECK(measured <= documented);
+}
+
+static void testLog2()
+{
+    // log spaced so every octave gets the same number of points
+    double worst = sweep(log(1e-6), log(1e6), [](double lx)
+                         { float x = (float)exp(lx);
+                           return fabs(fast_log2f(x) - log2((double)x)); });
+    report("fast_log2f", worst, LOG2_ABS);
+
+    worst = sweep(log(1e-5), log(1.0), [](double lx)
+                  { float x = (float)exp(lx);
+                    return fabs(unitToDb(x) - 20.0 * log10((double)x)); });
+    report("unitToDb", worst, DB_ABS);
+}
+
+static void testExp()
+{
+    double worst = sweep(-100, 100, [](double x)
+                         { return relative(fast_exp2f((float)x), exp2(x)); });
+    report("fast_exp2f", worst, EXP2_REL);
+    CHECK(fast_exp2f(-127.0f) == 0.0f);
+
+    worst = sweep(-20, 20, [](double x)
+                  { return relative(fast_expf((float)x), exp(x)); });
+    report("fast_expf", worst, EXP_REL);
+
+    worst = sweep(-110, 24, [](double db)
+                  { return relative(dbToUnit((float)db), pow(10.0, db / 20.0)); });
+    report("dbToUnit", worst, DB_TO_UNIT_REL);
+
+    worst = sweep(-48, 48, [](double st)
+                  { return relative(semitonesToRatio((float)st), exp2(st / 12.0)); });
+    report("semitonesToRatio", worst, RATIO_REL);
+
+    worst = sweep(0, 127, [](double note)
+                  { return relative(noteToFrequency((float)note), 440.0 * exp2((note - 69.0) / 12.0)); });
+    report("noteToFrequency", worst, RATIO_REL);
+}
+
+static void testSine()
+{
+    double worstQ15 = 0, worstPhase = 0;
+    for (uint64_t p = 0; p < (1ull << 32); p += 997)
+    {
+        double exact = sin(p * (2.0 * M_PI / 4294967296.0));
+        worstQ15 = std::max(worstQ15, fabs(sine_q15((uint32_t)p) - 32767.0 * exact));
+        worstPhase = std::max(worstPhase, fabs(fast_sin_phase((uint32_t)p) - exact));
+    }
+    report("sine_q15 (LSB)", worstQ15, SINE_Q15_LSB);
+    report("fast_sin_phase", worstPhase, SIN_PHASE_ABS);
+
+    double worst = sweep(-10, 10, [](double x)
+                         { return fabs(fast_sinf((float)x) - sin(x)); });
+    report("fast_sinf |x| < 10", worst, SIN_ABS_10);
+
+    worst = sweep(-100, 100, [](double x)
+                  { return std::max(fabs(fast_sinf((float)x) - sin(x)),
+                                    fabs(fast_cosf((float)x) - cos(x))); });
+    report("fast_sinf/cosf |x| < 100", worst, SIN_ABS_100);
+}
+
+static void testTanh()
+{
+    double worst = sweep(-10, 10, [](double x)
+                         { return fabs(fast_tanhf((float)x) - tanh(x)); });
+    report("fast_tanhf", worst, TANH_ABS);
+}
+
+static void testPhaseIncrement()
+{
+    CHECK(frequencyToPhaseIncrement(FAST_MATH_SAMPLE_RATE / 4) == 0x40000000u);
+    CHECK_NEAR(noteToPhaseIncrement(69.0f), 440.0 * 4294967296.0 / FAST_MATH_SAMPLE_RATE, 256.0);
+}
+
+// every benchmarked result is stored here, so the calls can't be
+// optimized away
+volatile float sink;
+
+// not a pass/fail: the cost of each next to libm on this machine
+static void benchmark()
+{
+    float x = 0.1f;
+    auto row = [](const char *name, double fast, double libm)
+    { printf("  %-12s %5.2f ns  libm %5.2f ns\n", name, fast, libm); };
+
+    const int calls = 1000000;
+    row("exp2", nanosecondsPer([&]
+                               { sink = fast_exp2f(x); x += 1e-5f; }, calls),
+        nanosecondsPer([&]
+                       { sink = exp2f(x); x += 1e-5f; }, calls));
+    row("log2", nanosecondsPer([&]
+                               { sink = fast_log2f(x); x += 1e-5f; }, calls),
+        nanosecondsPer([&]
+                       { sink = log2f(x); x += 1e-5f; }, calls));
+    row("sin", nanosecondsPer([&]
+                              { sink = fast_sinf(x); x += 1e-5f; }, calls),
+        nanosecondsPer([&]
+                       { sink = sinf(x); x += 1e-5f; }, calls));
+    row("tanh", nanosecondsPer([&]
+                               { sink = fast_tanhf(x); x += 1e-5f; }, calls),
+        nanosecondsPer([&]
+                       { sink = tanhf(x); x += 1e-5f; }, calls));
+}
+
+int main()
+{
+    RUN(testLog2);
+    RUN(testExp);
+    RUN(testSine);
+    RUN(testTanh);
+    RUN(testPhaseIncrement);
+    RUN(benchmark);
+    return failures;
+}
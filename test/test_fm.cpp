@@ -0,0 +1,97 @@
+// The FM voice: sideband levels against the Bessel functions, and that a
+// released note stops costing anything. The cost per block on this host
+// is printed for reference.
+
+#include "host_test.h"
+#include "synth_fm.h"
+#include <cmath>
+
+static const FmPreset STEADY = {"steady", 0.25f, 1.0f, {0.001f, 1.0f, 1.0f, 0.01f}, {0.001f, 1.0f, 1.0f, 0.01f}};
+
+/// @brief level of a component of a recording, at full scale = 1
+static double level(const std::vector<int16_t> &x, size_t from, double hz)
+{
+    size_t n = x.size() - from;
+    double ci = 0, cq = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        double window = 0.5 - 0.5 * cos(2.0 * M_PI * i / n);
+        double w = 2.0 * M_PI * hz * (from + i) / AUDIO_SAMPLE_RATE_EXACT;
+        ci += window * x[from + i] * cos(w);
+        cq += window * x[from + i] * sin(w);
+    }
+    return sqrt(ci * ci + cq * cq) * 4.0 / n / 32767.0;
+}
+
+// 1kHz carrier, 250Hz modulator: the carrier carries J0 of the index and
+// the first sidebands J1
+static void testSidebands()
+{
+    for (float index : {0.0f, 1.0f, 2.405f})
+    {
+        AudioSynthFm fm;
+        TestSink sink;
+        AudioConnection c(fm, 0, sink, 0);
+        fm.preset(STEADY);
+        fm.indexScale(index);
+        fm.frequency(1000.0f);
+        fm.amplitude(1.0f);
+        fm.noteOn();
+        for (int b = 0; b < 400; b++)
+            AudioStream::update_all();
+
+        size_t settled = 20 * AUDIO_BLOCK_SAMPLES;
+        double carrier = level(sink.left, settled, 1000.0);
+        double upper = level(sink.left, settled, 1250.0);
+        double lower = level(sink.left, settled, 750.0);
+        printf("  index %.3f: carrier %.4f (J0 %.4f), sidebands %.4f %.4f (J1 %.4f)\n", index, carrier,
+               fabs(std::cyl_bessel_j(0.0, index)), upper, lower, fabs(std::cyl_bessel_j(1.0, index)));
+        CHECK_NEAR(carrier, fabs(std::cyl_bessel_j(0.0, index)), 0.01);
+        CHECK_NEAR(upper, fabs(std::cyl_bessel_j(1.0, index)), 0.01);
+        CHECK_NEAR(lower, fabs(std::cyl_bessel_j(1.0, index)), 0.01);
+    }
+}
+
+// a percussive patch goes idle once it dies away, and sends nothing after
+static void testIdle()
+{
+    AudioSynthFm fm;
+    TestSink sink;
+    AudioConnection c(fm, 0, sink, 0);
+    fm.preset(FM_PRESETS[0]);
+    fm.frequency(440.0f);
+    fm.noteOn();
+    fm.noteOff();
+    // release is 0.4s to 60dB, and it stops 80dB down
+    for (int b = 0; b < 1000; b++)
+        AudioStream::update_all();
+
+    size_t last = sink.left.size() - 10 * AUDIO_BLOCK_SAMPLES;
+    CHECK(TestSink::rms(sink.left, last, sink.left.size()) == 0.0);
+    CHECK(AudioStream::memory_used == 0);
+}
+
+// not a pass/fail: one voice's update on this machine, sounding and idle
+static void benchmark()
+{
+    AudioSynthFm fm;
+    TestSink sink;
+    AudioConnection c(fm, 0, sink, 0);
+    fm.preset(STEADY);
+    fm.frequency(440.0f);
+    fm.noteOn();
+    double sounding = nanosecondsPer([&]
+                                     { fm.update(); sink.update(); sink.left.clear(); }, 20000);
+    fm.stop();
+    double idle = nanosecondsPer([&]
+                                 { fm.update(); sink.update(); sink.left.clear(); }, 20000);
+    printf("  sounding %.0f ns a block, idle %.0f ns (including the test sink)\n", sounding, idle);
+}
+
+int main()
+{
+    RUN(testSidebands);
+    RUN(testIdle);
+    RUN(benchmark);
+    return failures;
+}
@@ -0,0 +1,54 @@
+// The freeze: looping a slice, and changing the slice length while it
+// loops, never jumps the output by more than a smooth sine could.
+
+#include "host_test.h"
+#include "effect_freeze.h"
+
+static void testSliceChange()
+{
+    static int16_t buffer[2 * 8192];
+    TestSource source;
+    AudioEffectFreeze freeze;
+    TestSink sink;
+    AudioConnection c1(source, 0, freeze, 0);
+    AudioConnection c2(source, 1, freeze, 1);
+    AudioConnection c3(freeze, 0, sink, 0);
+    AudioConnection c4(freeze, 1, sink, 1);
+
+    // 110Hz moves at most ~150 per sample; the crossfades add up to
+    // 2 * 10000 / FREEZE_CROSSFADE_SAMPLES
+    const size_t blocks = 400;
+    for (size_t i = 0; i < blocks * AUDIO_BLOCK_SAMPLES; i++)
+        source.left.push_back((int16_t)(10000.0f * sinf(i * 2.0f * 3.14159265f * 110.0f / AUDIO_SAMPLE_RATE_EXACT)));
+
+    freeze.begin(buffer, 8192);
+    freeze.sliceLength(60);
+    for (size_t b = 0; b < blocks; b++)
+    {
+        if (b == 100)
+            freeze.hold(true);
+        // a few changes, landing at different points in the loop
+        if (b == 150)
+            freeze.sliceLength(35);
+        if (b == 200)
+            freeze.sliceLength(90);
+        if (b == 260)
+            freeze.sliceLength(25);
+        if (b == 350)
+            freeze.hold(false);
+        AudioStream::update_all();
+    }
+
+    int worst = 0;
+    for (size_t i = 1; i < sink.left.size(); i++)
+        worst = std::max(worst, abs(sink.left[i] - sink.left[i - 1]));
+    printf("  largest step %d\n", worst);
+    CHECK(worst < 250);
+}
+
+int main()
+{
+    RUN(testSliceChange);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
@@ -0,0 +1,121 @@
+// The pitch tracker on steady tones: how close it gets across its range,
+// what it does above the range, and that noise and quiet input read as
+// unpitched.
+
+#include "host_test.h"
+#include "analyze_pitch.h"
+
+enum Shape
+{
+    SINE,
+    SAW
+};
+
+/// @brief every estimate made over 30 blocks of a tone, once the history
+/// has filled
+static std::vector<float> track(float hz, Shape shape, float amplitude = 8000.0f, float gate = -100.0f)
+{
+    TestSource source;
+    AudioAnalyzePitch pitch;
+    AudioConnection c(source, 0, pitch, 0);
+    pitch.gate(gate);
+
+    double phase = 0;
+    for (int i = 0; i < 30 * AUDIO_BLOCK_SAMPLES; i++)
+    {
+        float x = shape == SINE ? sinf(2.0f * (float)M_PI * phase) : 2.0f * (float)phase - 1.0f;
+        source.left.push_back((int16_t)(amplitude * x));
+        phase += hz / AUDIO_SAMPLE_RATE_EXACT;
+        phase -= floor(phase);
+    }
+
+    // PITCH_HISTORY decimated samples is 16 blocks
+    std::vector<float> estimates;
+    for (int b = 0; b < 30; b++)
+    {
+        AudioStream::update_all();
+        if (pitch.available() && b >= 16)
+            estimates.push_back(pitch.read());
+    }
+    return estimates;
+}
+
+/// @brief the worst relative error among the estimates
+static double worstError(const std::vector<float> &estimates, float hz)
+{
+    double worst = estimates.empty() ? 1.0 : 0.0;
+    for (float e : estimates)
+        worst = std::max(worst, (double)fabsf(e - hz) / hz);
+    return worst;
+}
+
+// every semitone from A1 to B5; the error grows towards the top as the
+// period gets down to a few decimated samples
+static void testAccuracy()
+{
+    double worstLow = 0, worstSine = 0, worstSaw = 0;
+    for (int note = 33; note <= 83; note++)
+    {
+        float hz = 440.0f * powf(2.0f, (note - 69) / 12.0f);
+        double sine = worstError(track(hz, SINE), hz);
+        double saw = worstError(track(hz, SAW), hz);
+        if (hz < 350.0f)
+            worstLow = std::max(worstLow, std::max(sine, saw));
+        worstSine = std::max(worstSine, sine);
+        worstSaw = std::max(worstSaw, saw);
+    }
+    printf("  under 350Hz %.2f%%, sines %.2f%%, saws %.2f%%\n",
+           100.0 * worstLow, 100.0 * worstSine, 100.0 * worstSaw);
+    CHECK(worstLow < 0.0025);
+    CHECK(worstSine < 0.005);
+    CHECK(worstSaw < 0.01);
+}
+
+// above ~1kHz it reads nothing rather than an octave low
+static void testAboveRange()
+{
+    int wrong = 0;
+    for (float hz = 1000.0f; hz < 4000.0f; hz *= 1.02f)
+    {
+        for (Shape shape : {SINE, SAW})
+        {
+            for (float estimate : track(hz, shape))
+                wrong += estimate != 0 && fabsf(estimate - hz) > 0.01f * hz;
+        }
+    }
+    CHECK(wrong == 0);
+}
+
+static void testUnpitched()
+{
+    TestSource source;
+    AudioAnalyzePitch pitch;
+    AudioConnection c(source, 0, pitch, 0);
+    uint32_t seed = 1;
+    for (int i = 0; i < 30 * AUDIO_BLOCK_SAMPLES; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        source.left.push_back((int16_t)((int32_t)seed >> 19));
+    }
+    int pitched = 0;
+    for (int b = 0; b < 30; b++)
+    {
+        AudioStream::update_all();
+        if (pitch.available() && b >= 16)
+            pitched += pitch.read() != 0;
+    }
+    CHECK(pitched == 0);
+
+    // a tone under the gate, and the same tone over it
+    CHECK(worstError(track(220.0f, SINE, 50.0f, -40.0f), 220.0f) == 1.0);
+    CHECK(worstError(track(220.0f, SINE, 500.0f, -40.0f), 220.0f) < 0.002);
+}
+
+int main()
+{
+    RUN(testAccuracy);
+    RUN(testAboveRange);
+    RUN(testUnpitched);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
@@ -0,0 +1,132 @@
+// PooledLayer: 32 keys over one row of voices. A key gets a free voice,
+// takes back its own when it comes round again, takes the voice released
+// longest ago before any other, and only steals a held voice when all of
+// them are held, the oldest first.
+
+#include "host_test.h"
+#include "layer.h"
+
+class FakeNote : public INote
+{
+public:
+    AudioMixer4 out;
+    float frequency = 0;
+    float startedAt = 0;
+    int ons = 0;
+    bool sounding = false;
+
+    void begin() override {}
+    void noteOn() override
+    {
+        ons++;
+        sounding = true;
+        startedAt = frequency;
+    }
+    void noteOff() override { sounding = false; }
+    void enable() override {}
+    void disable() override { sounding = false; }
+    void park(bool) override {}
+    void setFrequency(float freq) override { frequency = freq; }
+    AudioStream &getOutputLeft() override { return out; }
+    AudioStream &getOutputRight() override { return out; }
+};
+
+class TestLayer : public PooledLayer<FakeNote>
+{
+public:
+    FakeNote &voice(size_t i) { return voices.notes[i]; }
+
+    int sounding()
+    {
+        int n = 0;
+        for_all_notes([&n](FakeNote &note)
+                      { n += note.sounding; });
+        return n;
+    }
+};
+
+static float scale[TestLayer::KEYS];
+
+static void testTuning()
+{
+    TestLayer layer;
+    layer.setScale(scale);
+    layer.noteOn(31);
+    CHECK(layer.voice(0).startedAt == scale[31]);
+    layer.noteOn(5);
+    CHECK(layer.voice(1).startedAt == scale[5]);
+    layer.noteOff(31);
+    CHECK(!layer.voice(0).sounding);
+    CHECK(layer.voice(1).sounding);
+}
+
+static void testReuse()
+{
+    TestLayer layer;
+    layer.setScale(scale);
+    for (int key = 0; key < 4; key++)
+    {
+        layer.noteOn(key);
+        layer.noteOff(key);
+    }
+    // key 1 again gets its own voice back, not the one free longest
+    layer.noteOn(1);
+    CHECK(layer.voice(1).ons == 2);
+    // a new key gets a voice nobody has used
+    layer.noteOn(20);
+    CHECK(layer.voice(4).ons == 1);
+}
+
+static void testReleaseOrder()
+{
+    TestLayer layer;
+    layer.setScale(scale);
+    for (int key = 0; key < (int)TestLayer::VOICES; key++)
+        layer.noteOn(key);
+    // released in a different order to the one they started in
+    layer.noteOff(5);
+    layer.noteOff(2);
+    layer.noteOff(6);
+
+    // the tail that has rung longest goes first, not the oldest start
+    layer.noteOn(20);
+    CHECK(layer.voice(5).startedAt == scale[20]);
+    layer.noteOn(21);
+    CHECK(layer.voice(2).startedAt == scale[21]);
+    layer.noteOn(22);
+    CHECK(layer.voice(6).startedAt == scale[22]);
+}
+
+static void testSteal()
+{
+    TestLayer layer;
+    layer.setScale(scale);
+    for (int key = 0; key < (int)TestLayer::VOICES; key++)
+        layer.noteOn(key);
+    CHECK(layer.sounding() == (int)TestLayer::VOICES);
+
+    // one released voice is taken before any held one
+    layer.noteOff(3);
+    layer.noteOn(10);
+    CHECK(layer.voice(3).startedAt == scale[10]);
+
+    // all held: the one held longest goes
+    layer.noteOn(11);
+    CHECK(layer.voice(0).startedAt == scale[11]);
+    // and its old key no longer stops it
+    layer.noteOff(0);
+    CHECK(layer.voice(0).sounding);
+    layer.noteOff(11);
+    CHECK(!layer.voice(0).sounding);
+}
+
+int main()
+{
+    for (size_t i = 0; i < TestLayer::KEYS; i++)
+        scale[i] = 100.0f + i;
+    RUN(testTuning);
+    RUN(testReuse);
+    RUN(testReleaseOrder);
+    RUN(testSteal);
+    return failures;
+}
@@ -0,0 +1,343 @@
+// The kernel interface: a kernel gives the same output whatever size of
+// chunks it is fed in, and the AudioStream adapters and the fx rack don't
+// change it. The rack fades processors in and out rather than jumping,
+// the phaser is only neutral once it is dry, and the feedback delay,
+// whose lines run at half rate, puts a click back where it was set to on
+// either phase of the lines.
+
+#include "host_test.h"
+#include "effect_fx_rack.h"
+#include "effect_kernel.h"
+#include "fx_basic.h"
+#include "fx_dynamics.h"
+#include "fx_feedback_delay.h"
+#include "fx_phaser.h"
+#include "play_memory_variable.h"
+
+static const size_t FRAMES = 40 * AUDIO_BLOCK_SAMPLES;
+
+// a burst of loud noise over a quiet tone, so the dynamics have work to do
+static std::vector<float> testSignal()
+{
+    std::vector<float> x(FRAMES);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < FRAMES; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        float noise = (int32_t)seed / 2147483648.0f;
+        x[i] = 2000.0f * sinf(i * 0.05f) + (i > FRAMES / 4 && i < FRAMES / 2 ? 20000.0f * noise : 0.0f);
+    }
+    return x;
+}
+
+template <typename F>
+static void inChunks(size_t chunk, F process)
+{
+    for (size_t i = 0; i < FRAMES; i += chunk)
+        process(i, std::min(chunk, FRAMES - i));
+}
+
+static void testDynamicsChunking()
+{
+    std::vector<float> in = testSignal();
+    std::vector<float> whole(FRAMES), chunked(FRAMES);
+
+    DynamicsProcessor a, b;
+    a.process(in.data(), whole.data(), FRAMES);
+    inChunks(37, [&](size_t at, size_t n)
+             { b.process(in.data() + at, chunked.data() + at, n); });
+
+    CHECK(memcmp(whole.data(), chunked.data(), FRAMES * sizeof(float)) == 0);
+    // and it did something
+    CHECK(whole != in);
+}
+
+static void testFeedbackDelayChunking()
+{
+    static int16_t arenaA[2 * 4096], arenaB[2 * 4096];
+    std::vector<float> in = testSignal();
+    std::vector<float> leftA = in, rightA = in, leftB = in, rightB = in;
+
+    FeedbackDelayProcessor a, b;
+    a.begin(arenaA, 4096);
+    b.begin(arenaB, 4096);
+    for (FeedbackDelayProcessor *p : {&a, &b})
+    {
+        p->reset();
+        p->delay(0, 30.0f);
+        p->delay(1, 45.0f);
+        p->feedback(0.6f);
+        p->drive(2.0f);
+    }
+
+    a.process(leftA.data(), rightA.data(), FRAMES);
+    inChunks(37, [&](size_t at, size_t n)
+             { b.process(leftB.data() + at, rightB.data() + at, n); });
+
+    CHECK(leftA == leftB);
+    CHECK(rightA == rightB);
+}
+
+// where the echo of a click at `at` peaks, delayed by 100ms + `extra`
+// samples
+static size_t echoPeak(size_t at, float extra)
+{
+    static int16_t arena[2 * 4096];
+    std::vector<float> left(FRAMES), right(FRAMES);
+    left[at] = right[at] = 20000.0f;
+
+    FeedbackDelayProcessor p;
+    p.begin(arena, 4096);
+    p.reset();
+    p.delay(0, 100.0f + extra * (1000.0f / AUDIO_SAMPLE_RATE_EXACT));
+    p.feedback(0);
+    p.crossFeedback(0);
+    p.frequency(20000.0f);
+    p.wetDry(1.0f);
+    p.process(left.data(), right.data(), FRAMES);
+
+    size_t peak = 0;
+    for (size_t i = 0; i < FRAMES; i++)
+        if (fabsf(left[i]) > fabsf(left[peak]))
+            peak = i;
+    return peak - at;
+}
+
+static void testFeedbackDelayTime()
+{
+    size_t target = (size_t)(0.1f * AUDIO_SAMPLE_RATE_EXACT + 0.5f);
+    for (size_t at = 0; at < 2; at++)
+        for (int extra = 0; extra < 2; extra++)
+        {
+            size_t peak = echoPeak(at, extra);
+            printf("  click at %zu, +%d: echo after %zu samples, set %zu\n", at, extra, peak, target + extra);
+            CHECK(peak >= target + extra && peak <= target + extra + 1);
+        }
+}
+
+static void testPlayerChunking()
+{
+    std::vector<int16_t> sample(3000);
+    for (size_t i = 0; i < sample.size(); i++)
+        sample[i] = (int16_t)(10000.0f * sinf(i * 0.02f));
+
+    VariableRatePlayer a, b;
+    std::vector<float> whole(FRAMES), chunked(FRAMES);
+    for (VariableRatePlayer *p : {&a, &b})
+    {
+        p->setSpeed(1.37f);
+        p->play(sample.data(), sample.size());
+    }
+    a.process(whole.data(), FRAMES);
+    inChunks(37, [&](size_t at, size_t n)
+             { b.process(chunked.data() + at, n); });
+
+    CHECK(whole == chunked);
+    CHECK(!a.isPlaying());
+}
+
+// the mono adapter in a graph gives what the bare kernel gives
+static void testMonoAdapter()
+{
+    std::vector<float> in = testSignal();
+    TestSource source;
+    AudioEffectMonoKernel<DynamicsProcessor> node;
+    TestSink sink;
+    AudioConnection c1(source, 0, node, 0);
+    AudioConnection c2(node, 0, sink, 0);
+
+    for (size_t i = 0; i < FRAMES; i++)
+        source.left.push_back((int16_t)in[i]);
+    for (size_t b = 0; b < FRAMES / AUDIO_BLOCK_SAMPLES; b++)
+        AudioStream::update_all();
+
+    DynamicsProcessor kernel;
+    std::vector<float> x(source.left.begin(), source.left.end()), expected(FRAMES);
+    kernel.process(x.data(), expected.data(), FRAMES);
+
+    CHECK(sink.left.size() == FRAMES);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < FRAMES; i++)
+        mismatches += sink.left[i] != saturate16(expected[i]);
+    CHECK(mismatches == 0);
+}
+
+// a window moving in steps reads the same level as one moving per sample
+static void testRmsWindow()
+{
+    RmsWindow<4410> exact;
+    RmsWindow<4410, 49> stepped;
+    for (int i = 0; i < 44100; i++)
+    {
+        float x = 16384.0f * sinf(i * 0.0713f);
+        exact.push(x);
+        stepped.push(x);
+    }
+    // a sine at half scale is -9.03dB rms
+    CHECK_NEAR(exact.db(), -9.03, 0.02);
+    CHECK_NEAR(stepped.db(), exact.db(), 0.02);
+
+    for (int i = 0; i < 4410; i++)
+    {
+        exact.push(0);
+        stepped.push(0);
+    }
+    CHECK(exact.db() == MIN_DB);
+    CHECK(stepped.db() == MIN_DB);
+}
+
+// a neutral stereo kernel forwards its input blocks untouched
+static void testStereoAdapterNeutral()
+{
+    TestSource source;
+    AudioEffectStereoKernel<GainProcessor> node;
+    TestSink sink;
+    AudioConnection c1(source, 0, node, 0);
+    AudioConnection c2(source, 1, node, 1);
+    AudioConnection c3(node, 0, sink, 0);
+    AudioConnection c4(node, 1, sink, 1);
+
+    for (size_t i = 0; i < 4 * AUDIO_BLOCK_SAMPLES; i++)
+    {
+        source.left.push_back((int16_t)(i * 7));
+        source.right.push_back((int16_t)(-(int)i * 5));
+    }
+    for (int b = 0; b < 4; b++)
+        AudioStream::update_all();
+
+    CHECK(sink.left == source.left);
+    CHECK(sink.right == source.right);
+
+    node.gain(0.5f);
+    source.position = 0;
+    for (int b = 0; b < 4; b++)
+        AudioStream::update_all();
+    CHECK(sink.left[4 * AUDIO_BLOCK_SAMPLES + 100] == source.left[100] / 2);
+}
+
+// a reorder goes through dry rather than dropping out
+static void testRackReorder()
+{
+    TestSource source;
+    AudioEffectFxRack rack;
+    TestSink sink;
+    AudioConnection c1(source, 0, rack, 0);
+    AudioConnection c2(source, 1, rack, 1);
+    AudioConnection c3(rack, 0, sink, 0);
+    AudioConnection c4(rack, 1, sink, 1);
+
+    GainProcessor a, b;
+    a.gain(0.5f);
+    b.gain(0.8f);
+    rack.add(a);
+    rack.add(b);
+
+    source.left.assign(8 * AUDIO_BLOCK_SAMPLES, 8000);
+    for (int i = 0; i < 8; i++)
+    {
+        if (i == 2)
+            rack.move(0, 1);
+        AudioStream::update_all();
+    }
+
+    int16_t lowest = *std::min_element(sink.left.begin(), sink.left.end());
+    printf("  lowest through the reorder %d\n", lowest);
+    CHECK(lowest >= 3199);
+    CHECK(sink.left.back() == 3200);
+    CHECK(strcmp(rack.nameAt(0), "gain") == 0);
+}
+
+// a gain that glides to its setting, and calls itself neutral as soon as
+// the setting is unity, like a processor with smoothed controls
+class GlidingGain : public StereoProcessor
+{
+public:
+    float target = 0.5f;
+    float current = 0.5f;
+
+    void process(float *left, float *right, size_t frames)
+    {
+        for (size_t i = 0; i < frames; i++)
+        {
+            current += (target - current) * 0.002f;
+            left[i] *= current;
+            right[i] *= current;
+        }
+    }
+    bool isNeutral() { return target == 1.0f; }
+    const char *name() { return "glide"; }
+};
+
+// a processor going neutral, or waking up, fades rather than jumping
+static void testRackNeutralFade()
+{
+    TestSource source;
+    AudioEffectFxRack rack;
+    TestSink sink;
+    AudioConnection c1(source, 0, rack, 0);
+    AudioConnection c2(source, 1, rack, 1);
+    AudioConnection c3(rack, 0, sink, 0);
+    AudioConnection c4(rack, 1, sink, 1);
+
+    GlidingGain glide;
+    rack.add(glide);
+
+    source.left.assign(12 * AUDIO_BLOCK_SAMPLES, 8000);
+    for (int i = 0; i < 12; i++)
+    {
+        if (i == 3)
+            glide.target = 1.0f;
+        if (i == 7)
+        {
+            glide.target = 0.5f;
+            glide.current = 0.5f;
+        }
+        AudioStream::update_all();
+    }
+
+    int worst = 0;
+    for (size_t i = 1; i < sink.left.size(); i++)
+        worst = std::max(worst, abs(sink.left[i] - sink.left[i - 1]));
+    printf("  largest step %d\n", worst);
+    CHECK(sink.left[3 * AUDIO_BLOCK_SAMPLES - 1] == 4000);
+    CHECK(sink.left[5 * AUDIO_BLOCK_SAMPLES] == 8000);
+    CHECK(sink.left.back() == 4000);
+    CHECK(worst < 100);
+}
+
+// at zero depth the phaser only calls itself neutral once it passes its
+// input through untouched
+static void testPhaserNeutral()
+{
+    PhaserProcessor phaser;
+    phaser.depth(0.5f);
+    std::vector<float> in = testSignal();
+    std::vector<float> left = in, right = in;
+    CHECK(!phaser.isNeutral());
+    phaser.process(left.data(), right.data(), 4 * AUDIO_BLOCK_SAMPLES);
+
+    phaser.depth(0.0f);
+    CHECK(!phaser.isNeutral());
+    size_t at = 4 * AUDIO_BLOCK_SAMPLES;
+    phaser.process(left.data() + at, right.data() + at, AUDIO_BLOCK_SAMPLES);
+    CHECK(phaser.isNeutral());
+    // the block before was still notched, the last sample of the fade dry
+    CHECK(left[at - 1] != in[at - 1]);
+    CHECK(left[at + AUDIO_BLOCK_SAMPLES - 1] == in[at + AUDIO_BLOCK_SAMPLES - 1]);
+}
+
+int main()
+{
+    RUN(testDynamicsChunking);
+    RUN(testFeedbackDelayChunking);
+    RUN(testFeedbackDelayTime);
+    RUN(testPlayerChunking);
+    RUN(testRmsWindow);
+    RUN(testMonoAdapter);
+    RUN(testStereoAdapterNeutral);
+    RUN(testRackReorder);
+    RUN(testRackNeutralFade);
+    RUN(testPhaserNeutral);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
@@ -0,0 +1,80 @@
+// The reverb tail has to die away to digital silence once the input
+// stops, rather than sitting on a small limit cycle in the fixed-point
+// loop. The cost per block on this host is printed for reference.
+
+#include "host_test.h"
+#include "effect_reverb.h"
+
+static void testTailDecaysToSilence()
+{
+    TestSource source;
+    AudioEffectFdnReverb reverb;
+    TestSink sink;
+    AudioConnection c1(source, 0, reverb, 0);
+    AudioConnection c2(source, 1, reverb, 1);
+    AudioConnection c3(reverb, 0, sink, 0);
+    AudioConnection c4(reverb, 1, sink, 1);
+
+    reverb.time(2.0f);
+    reverb.damping(0.3f);
+    reverb.mix(1.0f);
+
+    // a short burst of noise, then nothing
+    uint32_t seed = 1;
+    for (int i = 0; i < 20 * AUDIO_BLOCK_SAMPLES; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        source.left.push_back((int16_t)((int32_t)seed >> 18));
+    }
+    source.right = source.left;
+
+    // 2s to 60dB down, so 10s is far past anything audible
+    const int blocks = (int)(10.0f * AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES);
+    for (int b = 0; b < blocks; b++)
+        AudioStream::update_all();
+
+    size_t burst = 20 * AUDIO_BLOCK_SAMPLES;
+    CHECK(TestSink::rms(sink.left, burst, burst + 4410) > 100.0);
+
+    // the last second is exactly zero on both sides
+    size_t end = sink.left.size();
+    size_t from = end - (size_t)AUDIO_SAMPLE_RATE_EXACT;
+    int worst = 0;
+    for (size_t i = from; i < end; i++)
+        worst = std::max(worst, std::max(abs(sink.left[i]), abs(sink.right[i])));
+    printf("  largest sample in the last second: %d\n", worst);
+    CHECK(worst == 0);
+}
+
+static void benchmark()
+{
+    TestSource source;
+    AudioEffectFdnReverb reverb;
+    TestSink sink;
+    AudioConnection c1(source, 0, reverb, 0);
+    AudioConnection c2(source, 1, reverb, 1);
+    AudioConnection c3(reverb, 0, sink, 0);
+    AudioConnection c4(reverb, 1, sink, 1);
+    reverb.mix(0.3f);
+
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++)
+        source.left.push_back((int16_t)(8000.0f * sinf(i * 0.1f)));
+    double ns = nanosecondsPer([&]
+                               {
+                                   source.position = 0;
+                                   source.update();
+                                   reverb.update();
+                                   sink.update();
+                                   sink.left.clear();
+                                   sink.right.clear(); },
+                               20000);
+    printf("  %.0f ns a block (including the test source and sink)\n", ns);
+}
+
+int main()
+{
+    RUN(testTailDecaysToSilence);
+    RUN(benchmark);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
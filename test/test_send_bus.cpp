@@ -0,0 +1,122 @@
+// The send bus: its effects run in parallel off the send mix and their
+// wet returns are summed, so each one hears the source and not the
+// others.
+
+#include "host_test.h"
+#include "filter_chain.h"
+
+static const int SAMPLES_PER_MS = (int)(AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+
+// ~80KB with the delay arena, so made with new
+struct SendBus
+{
+    FeeedbackFilter delayFilter;
+    ReverbFilter reverbFilter;
+    TestSource source;
+    FilterChain sends{source, source, 1, true};
+    AudioMixer4 returnLeft;
+    AudioMixer4 returnRight;
+    TestSink sink;
+    AudioConnection c1{returnLeft, 0, sink, 0};
+    AudioConnection c2{returnRight, 0, sink, 1};
+
+    SendBus()
+    {
+        sends.push(delayFilter);
+        sends.push(reverbFilter);
+        sends.connectTo(returnLeft, 0, returnRight, 0);
+
+        // 20ms of noise, then nothing
+        uint32_t seed = 1;
+        for (int i = 0; i < 20 * SAMPLES_PER_MS; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            source.left.push_back((int16_t)((int32_t)seed >> 18));
+        }
+    }
+
+    void run(int ms)
+    {
+        for (int b = 0; b < ms * SAMPLES_PER_MS / AUDIO_BLOCK_SAMPLES; b++)
+        {
+            sends.loop();
+            AudioStream::update_all();
+        }
+    }
+
+    // after the push, which sets the defaults
+    void setDelay(float wet)
+    {
+        delayFilter.setDelayLeft(300);
+        delayFilter.setDelayRight(300);
+        delayFilter.setFeedback(0.0f);
+        delayFilter.setCrossFeedback(0.0f);
+        delayFilter.setWetDryMix(wet);
+    }
+
+    /// @brief rms of the left return between two times in ms
+    double level(int from, int to)
+    {
+        return TestSink::rms(sink.left, from * SAMPLES_PER_MS, to * SAMPLES_PER_MS);
+    }
+};
+
+// the reverb hears the burst straight away rather than only once it
+// comes out of the delay 300ms later
+static void testParallel()
+{
+    SendBus *bus = new SendBus;
+    bus->setDelay(0.7f);
+    bus->reverbFilter.mix(0.5f);
+    bus->run(600);
+
+    double early = bus->level(20, 250);
+    double echo = bus->level(300, 320);
+    printf("  reverb before the echo %.1f, echo %.1f\n", early, echo);
+    CHECK(early > 150.0);
+    CHECK(echo > early);
+    delete bus;
+}
+
+// a neutral delay is routed around without taking the reverb with it
+static void testDelayBypassed()
+{
+    SendBus *bus = new SendBus;
+    bus->setDelay(0.0f);
+    bus->reverbFilter.mix(0.5f);
+    bus->run(600);
+
+    CHECK(bus->delayFilter.wantsBypass());
+    double early = bus->level(20, 250);
+    double echo = bus->level(300, 320);
+    printf("  reverb %.1f, where the echo would be %.1f\n", early, echo);
+    CHECK(early > 150.0);
+    CHECK(echo < early);
+    delete bus;
+}
+
+// and the other way round
+static void testReverbBypassed()
+{
+    SendBus *bus = new SendBus;
+    bus->setDelay(0.7f);
+    bus->reverbFilter.mix(0.0f);
+    bus->run(600);
+
+    CHECK(bus->reverbFilter.wantsBypass());
+    double early = bus->level(40, 250);
+    double echo = bus->level(300, 320);
+    printf("  before the echo %.1f, echo %.1f\n", early, echo);
+    CHECK(early < 1.0);
+    CHECK(echo > 300.0);
+    delete bus;
+}
+
+int main()
+{
+    RUN(testParallel);
+    RUN(testDelayBypassed);
+    RUN(testReverbBypassed);
+    CHECK(AudioStream::memory_used == 0);
+    return failures;
+}
@@ -0,0 +1,84 @@
+// The soft clipper's small signal response: the passband figures in
+// fx_soft_clip.h are measured here, along with its latency and the
+// aliasing it's there to keep out.
+
+#include "host_test.h"
+#include "fx_soft_clip.h"
+
+static const float FS = AUDIO_SAMPLE_RATE_EXACT;
+
+/// @brief gain in dB of the clipper at `hz` for a sine of `amplitude`,
+/// and the level in dB (relative to that amplitude) at `otherHz`
+static double gainDb(float hz, float amplitude, float otherHz = 0, double *other = NULL)
+{
+    SoftClipper clipper;
+    clipper.reset();
+    const int settle = 1000;
+    const int n = 44100;
+    double ci = 0, cq = 0, oi = 0, oq = 0;
+    for (int i = 0; i < settle + n; i++)
+    {
+        float y = clipper.tick(amplitude * sinf(2.0f * (float)M_PI * hz * i / FS));
+        if (i < settle)
+            continue;
+        double window = 0.5 - 0.5 * cos(2.0 * M_PI * (i - settle) / n);
+        ci += window * y * cos(2.0 * M_PI * hz * i / FS);
+        cq += window * y * sin(2.0 * M_PI * hz * i / FS);
+        oi += window * y * cos(2.0 * M_PI * otherHz * i / FS);
+        oq += window * y * sin(2.0 * M_PI * otherHz * i / FS);
+    }
+    // a Hann window sums to n/2, and the projection halves again
+    double scale = 4.0 / n / amplitude;
+    if (other)
+        *other = 20.0 * log10(sqrt(oi * oi + oq * oq) * scale + 1e-12);
+    return 20.0 * log10(sqrt(ci * ci + cq * cq) * scale);
+}
+
+static void testPassband()
+{
+    for (float hz : {100.0f, 1000.0f, 5000.0f, 10000.0f, 14000.0f})
+        CHECK_NEAR(gainDb(hz, 2000.0f), 0.0, 0.05);
+    CHECK_NEAR(gainDb(16000.0f, 2000.0f), -0.2, 0.05);
+    CHECK_NEAR(gainDb(18000.0f, 2000.0f), -1.4, 0.05);
+    CHECK_NEAR(gainDb(20000.0f, 2000.0f), -4.1, 0.05);
+}
+
+// 2.5dB into compression the third harmonic of a high tone folds back
+// well down; at the rails it doesn't
+static void testAliasing()
+{
+    for (float hz : {10000.0f, 12000.0f, 15000.0f})
+    {
+        float alias = fabsf(3 * hz - FS);
+        double level;
+        double gain = gainDb(hz, 40000.0f, alias, &level);
+        printf("  %5.0f Hz, %.1f dB compression: alias at %5.0f Hz %.1f dB\n", hz, -gain, alias, level);
+        CHECK(level < -70.0);
+    }
+}
+
+static void testLatency()
+{
+    SoftClipper clipper;
+    clipper.reset();
+    int peak = 0;
+    float largest = 0;
+    for (int i = 0; i < 32; i++)
+    {
+        float y = clipper.tick(i == 0 ? 2000.0f : 0.0f);
+        if (fabsf(y) > largest)
+        {
+            largest = fabsf(y);
+            peak = i;
+        }
+    }
+    CHECK(peak == SOFT_CLIP_LATENCY);
+}
+
+int main()
+{
+    RUN(testPassband);
+    RUN(testAliasing);
+    RUN(testLatency);
+    return failures;
+}
@@ -0,0 +1,51 @@
+// The tempo clock: a division too long for an effect's buffer is halved
+// until it fits, and its played name says so.
+
+#include "host_test.h"
+#include "tempo_clock.h"
+
+static size_t find(const char *name)
+{
+    for (size_t i = 0; i < NUM_NOTE_DIVISIONS; i++)
+        if (strcmp(NOTE_DIVISIONS[i].name, name) == 0)
+            return i;
+    return 0;
+}
+
+static std::string played(const TempoClock &clock, const char *division, float maxMs)
+{
+    char name[12];
+    clock.playedName(find(division), maxMs, name, sizeof(name));
+    return name;
+}
+
+static void testHalving()
+{
+    TempoClock clock(60.0f);
+    // 1000ms beats into 400ms: halved twice
+    CHECK_NEAR(clock.divisionMs(find("1/4"), 400), 250.0f, 0.01f);
+    CHECK(clock.divisionHalvings(find("1/4"), 400) == 2);
+    CHECK(clock.divisionHalvings(find("1/16"), 400) == 0);
+    CHECK(clock.divisionMs(find("free"), 400) == 0);
+}
+
+static void testPlayedName()
+{
+    TempoClock clock(60.0f);
+    CHECK(played(clock, "1/4", 400) == "1/16");
+    CHECK(played(clock, "1/8.", 400) == "1/16.");
+    CHECK(played(clock, "1/4T", 400) == "1/8T");
+    CHECK(played(clock, "1/16", 400) == "1/16");
+    CHECK(played(clock, "free", 400) == "free");
+
+    clock.setBpm(120.0f);
+    CHECK(played(clock, "1/4", 400) == "1/8");
+    CHECK(played(clock, "1/8", 400) == "1/8");
+}
+
+int main()
+{
+    RUN(testHalving);
+    RUN(testPlayedName);
+    return failures;
+}